@@ -15,9 +15,12 @@
 #include "../MCAL/Timers/TIMER1/TIMER1.h"
 #include "../MCAL/Timers/TIMER2/TIMER2.h"
 #include "../MCAL/Timers/TIMER3/TIMER3.h"
+#include "../MCAL/Timers/SWTIMER/SWTIMER.h"
+#include "../MCAL/Timers/TIME/TIME.h"
 #include "../MCAL/CCP/CCP1/CCP1.h"
 #include "../MCAL/EUSART/EUSART.h"
 #include "../MCAL/SPI/SPI.h"
+#include "../MCAL/I2C/I2C.h"
 
 #include "../ECUAL/LCD/LCD.h"
 #include "../ECUAL/LED/LED.h"
@@ -0,0 +1,254 @@
+/**
+ * @file BENCH.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "BENCH.h"
+#include "../MCAL/mcu_registers.h"
+
+#if !defined(__XC8)
+#include <stdio.h>
+#include <time.h>
+#endif
+
+#define BENCH_OVERFLOW                      0xFFFFFFFFUL
+
+/* TIMER1 on FOSC / 4, no prescaler, 16-bit read/write mode */
+#define BENCH_CounterStop()                 (T1CON = 0x00)
+#define BENCH_CounterStart()                (T1CON = 0x81)
+
+#if defined(__XC8)
+static EUSART_InitTypeDef BENCH_Console = {
+    .Mode = EUSART_MODE_TX,
+    .TxDataFrame = EUSART_TX_DATA_FRAME_8BIT,
+    .Parity = EUSART_NO_PARITY,
+    .BrgResolution = EUSART_BRG_RESOLUTION_16BIT,
+    .BrgSpeed = EUSART_BRG_SPEED_HIGH
+};
+#endif
+
+static uint32 BENCH_Overhead = 0;
+
+static void BENCH_Empty(void);
+static uint32 BENCH_Measure(void (* const Run)(void));
+static void BENCH_PutChar(const char Char);
+static void BENCH_PutString(const char *String);
+static void BENCH_PutPadded(const char *String, const uint8 Width);
+static void BENCH_PutNumber(uint32 Number, const uint8 Width);
+
+int main(void)
+{
+    uint8 loc_case = 0;
+    uint8 loc_iteration = 0;
+    uint32 loc_cycles = 0;
+    uint32 loc_total = 0;
+    boolean loc_overflow = FALSE;
+
+#if defined(__XC8)
+    (void)EUSART_Init(&BENCH_Console, BENCH_BAUDRATE);
+#else
+    uint32 loc_accesses = 0;
+    uint32 loc_nanoseconds = 0;
+    struct timespec loc_start, loc_end;
+
+    SIM_Reset();
+#endif
+
+    BENCH_Overhead = BENCH_Measure(BENCH_Empty);
+
+    BENCH_PutString("PIC18F4620 driver benchmark " BENCH_OPTIMIZATION "\r\n");
+
+#if defined(__XC8)
+    BENCH_PutString("| Function                         |   Cycles |\r\n");
+    BENCH_PutString("|----------------------------------|----------|\r\n");
+#else
+    /* TIMER1 only advances by the cycles SIM charges for the modelled SFR accesses, not by instruction cycles */
+    BENCH_PutString("| Function                         | SIM TMR1 | SFR accesses |  Host ns |\r\n");
+    BENCH_PutString("|----------------------------------|----------|--------------|----------|\r\n");
+#endif
+
+    for (loc_case = 0; loc_case < BENCH_NumberOfCases; loc_case++)
+    {
+        if (NULL_PTR != BENCH_Cases[loc_case].Setup)
+        {
+            BENCH_Cases[loc_case].Setup();
+        }
+
+        loc_total = 0;
+        loc_overflow = FALSE;
+
+#if !defined(__XC8)
+        loc_accesses = 0;
+        loc_nanoseconds = 0;
+#endif
+
+        for (loc_iteration = 0; loc_iteration < BENCH_ITERATIONS; loc_iteration++)
+        {
+            loc_cycles = BENCH_Measure(BENCH_Cases[loc_case].Run);
+
+            if (BENCH_OVERFLOW == loc_cycles)
+            {
+                loc_overflow = TRUE;
+            }
+            else
+            {
+                loc_total += loc_cycles;
+            }
+
+#if !defined(__XC8)
+            /* Access and host time figures are taken around the bare call, without the TIMER1 bookkeeping */
+            loc_cycles = SIM_GetAccessCount();
+            clock_gettime(CLOCK_MONOTONIC, &loc_start);
+            BENCH_Cases[loc_case].Run();
+            clock_gettime(CLOCK_MONOTONIC, &loc_end);
+            loc_accesses += SIM_GetAccessCount() - loc_cycles;
+            loc_nanoseconds += (uint32)(((loc_end.tv_sec - loc_start.tv_sec) * 1000000000L) +
+                                        (loc_end.tv_nsec - loc_start.tv_nsec));
+#endif
+        }
+
+        BENCH_PutString("| ");
+        BENCH_PutPadded(BENCH_Cases[loc_case].Name, 32);
+        BENCH_PutString(" | ");
+
+        if (TRUE == loc_overflow)
+        {
+            BENCH_PutPadded("overflow", 8);
+        }
+        else
+        {
+            BENCH_PutNumber(loc_total / BENCH_ITERATIONS, 8);
+        }
+
+#if !defined(__XC8)
+        BENCH_PutString(" | ");
+        BENCH_PutNumber(loc_accesses / BENCH_ITERATIONS, 12);
+        BENCH_PutString(" | ");
+        BENCH_PutNumber(loc_nanoseconds / BENCH_ITERATIONS, 8);
+#endif
+
+        BENCH_PutString(" |\r\n");
+    }
+
+    BENCH_Done();
+
+#if defined(__XC8)
+    while (1);
+#endif
+
+    return 0;
+}
+
+void BENCH_Done(void)
+{
+#if !defined(__XC8)
+    (void)fflush(stdout);
+#endif
+}
+
+static void BENCH_Empty(void)
+{
+
+}
+
+static uint32 BENCH_Measure(void (* const Run)(void))
+{
+    uint32 loc_cycles = 0;
+    uint8 loc_low = 0;
+
+    BENCH_CounterStop();
+    TMR1H = 0;
+    TMR1L = 0;
+    PIR1bits.TMR1IF = 0;
+    BENCH_CounterStart();
+
+    Run();
+
+    /* Reading TMR1L latches TMR1H in 16-bit read/write mode */
+    loc_low = (uint8)TMR1L;
+    loc_cycles = ((uint32)TMR1H << 8) | loc_low;
+    BENCH_CounterStop();
+
+    /* A single overflow is accounted for, a second one cannot be told apart */
+    if (1 == PIR1bits.TMR1IF)
+    {
+        loc_cycles += 0x10000UL;
+    }
+
+    if (loc_cycles >= (0x20000UL - 1UL))
+    {
+        loc_cycles = BENCH_OVERFLOW;
+    }
+    else if (loc_cycles >= BENCH_Overhead)
+    {
+        loc_cycles -= BENCH_Overhead;
+    }
+    else
+    {
+        loc_cycles = 0;
+    }
+
+    return loc_cycles;
+}
+
+static void BENCH_PutChar(const char Char)
+{
+#if defined(__XC8)
+    (void)EUSART_SendDataFrameBlocking(&BENCH_Console, (uint16)Char);
+#else
+    /* Host terminals only need the line feed */
+    if ('\r' != Char)
+    {
+        (void)putchar(Char);
+    }
+#endif
+}
+
+static void BENCH_PutString(const char *String)
+{
+    while ('\0' != *String)
+    {
+        BENCH_PutChar(*String++);
+    }
+}
+
+static void BENCH_PutPadded(const char *String, const uint8 Width)
+{
+    uint8 loc_length = 0;
+
+    while ('\0' != String[loc_length])
+    {
+        BENCH_PutChar(String[loc_length++]);
+    }
+
+    for (; loc_length < Width; loc_length++)
+    {
+        BENCH_PutChar(' ');
+    }
+}
+
+static void BENCH_PutNumber(uint32 Number, const uint8 Width)
+{
+    char loc_digits[10];
+    uint8 loc_count = 0;
+    uint8 loc_index = 0;
+
+    do
+    {
+        loc_digits[loc_count++] = (char)('0' + (Number % 10));
+        Number /= 10;
+
+    } while (0 != Number);
+
+    for (loc_index = loc_count; loc_index < Width; loc_index++)
+    {
+        BENCH_PutChar(' ');
+    }
+
+    while (loc_count > 0)
+    {
+        BENCH_PutChar(loc_digits[--loc_count]);
+    }
+}
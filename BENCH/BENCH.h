@@ -0,0 +1,58 @@
+/**
+ * @file BENCH.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Driver Micro-Benchmarks
+ *
+ * The benchmark firmware calls every benchmarked driver API a fixed number of times and measures each call with
+ * TIMER1 (FOSC / 4, no prescaler, 16-bit read/write mode). On the PIC18F4620 (real part or gpsim) TIMER1 counts
+ * instruction cycles and the result table is printed on the EUSART. On the host simulator the table is printed on
+ * stdout, and TIMER1 only counts the cycles SIM charges (SIM_CYCLES_PER_ACCESS per modelled SFR access, plus the
+ * delays), so it is reported as "SIM TMR1" next to the number of SFR accesses and the host time per call.
+ *
+ * @note Code running on plain simulated memory (PORT, LAT, TRIS, RAM) costs nothing in the SIM TMR1 column.
+ *
+ * @note TIMER1 is reserved by the benchmark, the TIMER1 driver is therefore not benchmarked.
+ * @note Calls lasting more than 131071 cycles overflow the measurement and are reported as such.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include "../APP/app.h"
+#include "../MCAL/ADC/ADC.h"
+
+/**
+ * @brief Number of measured calls per benchmark, the reported figures are averages.
+ */
+#define BENCH_ITERATIONS                    8
+
+/**
+ * @brief Baud rate of the EUSART the result table is printed on (PIC builds).
+ */
+#define BENCH_BAUDRATE                      9600
+
+#ifndef BENCH_OPTIMIZATION
+#define BENCH_OPTIMIZATION                  ""
+#endif
+
+typedef struct
+{
+    const char *Name;
+    void (*Setup)(void);
+    void (*Run)(void);
+
+} BENCH_CaseTypeDef;
+
+extern const BENCH_CaseTypeDef BENCH_Cases[];
+extern const uint8 BENCH_NumberOfCases;
+
+/**
+ * @brief Marks the end of the benchmark run, used as a breakpoint by the simulator scripts.
+ */
+void BENCH_Done(void);
+
+#endif /* _BENCH_H_ */
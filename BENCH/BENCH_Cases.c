@@ -0,0 +1,306 @@
+/**
+ * @file BENCH_Cases.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "BENCH.h"
+#include "../MCAL/Interrupts/Interrupts_Private.h"
+#include "../MCAL/Interrupts/Interrupts_Handler.h"
+
+#define BENCH_PIN                           GPIO_PIN(D, 0)
+
+static GPIO_InitTypeDef BENCH_Pin = GPIO_PIN_CHANNEL(BENCH_PIN, GPIO_OUTPUT, GPIO_LOW);
+static GPIO_LogicTypeDef BENCH_Logic = GPIO_LOW;
+
+static GPIO_BusTypeDef BENCH_Bus = {
+    .Pins = {
+        GPIO_PIN_CHANNEL(GPIO_PIN(D, 4), GPIO_OUTPUT, GPIO_LOW), GPIO_PIN_CHANNEL(GPIO_PIN(D, 5), GPIO_OUTPUT, GPIO_LOW),
+        GPIO_PIN_CHANNEL(GPIO_PIN(D, 6), GPIO_OUTPUT, GPIO_LOW), GPIO_PIN_CHANNEL(GPIO_PIN(D, 7), GPIO_OUTPUT, GPIO_LOW),
+    },
+    .Width = 4
+};
+static uint8 BENCH_BusValue = 0;
+
+static LED_InitTypeDef BENCH_Led = {
+    .Channel = {.Port = GPIO_PORTD, .Pin = GPIO_PIN1, .Direction = GPIO_OUTPUT, .Logic = GPIO_LOW},
+    .Configuration = LED_ACTIVE_HIGH
+};
+
+static LCD_InitTypeDef BENCH_Lcd = {
+    .Mode = LCD_MODE_4BIT,
+    .Display = {.Rows = 2, .Columns = 16},
+    .RS = {.Port = GPIO_PORTB, .Pin = GPIO_PIN0, .Direction = GPIO_OUTPUT},
+    .RW = {.Port = GPIO_PORTB, .Pin = GPIO_PIN1, .Direction = GPIO_OUTPUT},
+    .E  = {.Port = GPIO_PORTB, .Pin = GPIO_PIN2, .Direction = GPIO_OUTPUT},
+    .D  = {
+        [4] = {.Port = GPIO_PORTB, .Pin = GPIO_PIN4, .Direction = GPIO_OUTPUT},
+        [5] = {.Port = GPIO_PORTB, .Pin = GPIO_PIN5, .Direction = GPIO_OUTPUT},
+        [6] = {.Port = GPIO_PORTB, .Pin = GPIO_PIN6, .Direction = GPIO_OUTPUT},
+        [7] = {.Port = GPIO_PORTB, .Pin = GPIO_PIN7, .Direction = GPIO_OUTPUT},
+    }
+};
+
+static uint8 BENCH_LcdChar = 'A';
+
+static SPI_InitTypeDef BENCH_Spi = {
+    .Mode = SPI_MODE_MASTER_PRESCALER_4,
+    .SampleTime = SPI_SAMPLE_TIME_MIDDLE_OF_DATA,
+    .SetupTime = SPI_SETUP_TIME_LEADING_EDGE,
+    .ClockPolarity = SPI_CLOCK_POLARITY_LOW
+};
+static uint8 BENCH_SpiData = 0;
+static uint8 BENCH_SpiBuffer[16] = {0};
+
+static EUSART_InitTypeDef BENCH_Eusart = {
+    .Mode = EUSART_MODE_TXRX,
+    .TxDataFrame = EUSART_TX_DATA_FRAME_8BIT,
+    .RxDataFrame = EUSART_RX_DATA_FRAME_8BIT,
+    .Parity = EUSART_NO_PARITY,
+    .BrgResolution = EUSART_BRG_RESOLUTION_16BIT,
+    .BrgSpeed = EUSART_BRG_SPEED_HIGH
+};
+
+static ADC_InitTypeDef BENCH_Adc = {
+    .ChannelConfiguration = ADC_ALL_CHANNELS_ANALOG,
+    .Vref = ADC_VREF_INTERNAL,
+    .AquisitionTime = ADC_AQT_2TAD,
+    .Prescaler = ADC_PRESCALER_8,
+    .ResultAlignment = ADC_ALIGN_RIGHT
+};
+static ADC_ValueTypeDef BENCH_AdcValue = 0;
+static const ADC_ChannelTypeDef BENCH_AdcChannels[] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
+static const ADC_ScanTypeDef BENCH_AdcScan = {
+    .Channels = BENCH_AdcChannels,
+    .NumberOfChannels = 4,
+    .Mode = ADC_SCAN_CONTINUOUS,
+    .ScanCompleteHandler = NULL_PTR
+};
+static ADC_ValueTypeDef BENCH_AdcResults[4];
+/* TIMER1 is reserved by the benchmark, the sample clock runs on TIMER3 */
+static const ADC_TriggerTypeDef BENCH_AdcTrigger = {
+    .Channel = ADC_CHANNEL_0,
+    .Timer = ADC_TRIGGER_TIMER3,
+    .SampleRate = 10000
+};
+
+static uint8 BENCH_EepromData = 0;
+static uint8 BENCH_EepromBlock[16] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                      0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF};
+
+static void BENCH_Timer0Handler(void);
+static TIMER0_InitTypeDef BENCH_Timer0 = {
+    .Resolution = TIMER0_RESOLUTION_16BIT,
+    .Mode = TIMER0_MODE_TIMER,
+    .Prescaler = TIMER0_PRESCALER_8,
+    .InterruptHandler = BENCH_Timer0Handler
+};
+static uint16 BENCH_Timer0Value = 0;
+static uint32 BENCH_Timestamp = 0;
+
+static TIMER2_InitTypeDef BENCH_Timer2 = {
+    .Mode = TIMER2_MODE_NORMAL,
+    .Prescaler = TIMER2_PRESCALER_4,
+    .Postscaler = TIMER2_NO_POSTSCALER
+};
+
+static CCP1_InitTypeDef BENCH_Ccp1 = {
+    .Mode = CCP1_MODE_PWM,
+    .TIMER2Ptr = &BENCH_Timer2,
+    .InterruptHandler = NULL_PTR
+};
+
+static void BENCH_InterruptSetup(void)
+{
+#if !defined(__XC8)
+#if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    SIM_SetInterruptVectors(HighPriorityInterruptHandler, LowPriorityInterruptHandler);
+#else
+    SIM_SetInterruptVectors(InterruptHandler, NULL_PTR);
+#endif
+#endif
+}
+
+/* The EEPROM write complete interrupt is the last source of the dispatch order, every enabled source is tested */
+static void BENCH_InterruptDispatch(void)
+{
+    __INTI_EEPROM_EnableInterrupt();
+    INTI_EnableInterrupts();
+
+    PIR2bits.EEIF = 1;
+
+    INTI_DisableInterrupts();
+    __INTI_EEPROM_DisableInterrupt();
+}
+
+static void BENCH_GpioSetup(void)                   { (void)GPIO_InitChannel(&BENCH_Pin); }
+static void BENCH_GpioSetChannelLogic(void)         { (void)GPIO_SetChannelLogic(&BENCH_Pin, GPIO_HIGH); }
+static void BENCH_GpioToggleChannelLogic(void)      { (void)GPIO_ToggleChannelLogic(&BENCH_Pin); }
+static void BENCH_GpioGetChannelLogic(void)         { (void)GPIO_GetChannelLogic(&BENCH_Pin, &BENCH_Logic); }
+static void BENCH_GpioPinHigh(void)                 { GPIO_PIN_HIGH(BENCH_PIN); }
+static void BENCH_GpioPinToggle(void)               { GPIO_PIN_TOGGLE(BENCH_PIN); }
+static void BENCH_GpioPinRead(void)                 { BENCH_Logic = GPIO_PIN_READ(BENCH_PIN); }
+static void BENCH_GpioWritePortMasked(void)         { (void)GPIO_WritePortMasked(GPIO_PORTD, 0xF0, ++BENCH_BusValue << 4); }
+
+static void BENCH_GpioBusSetup(void)                { (void)GPIO_BusInit(&BENCH_Bus); }
+static void BENCH_GpioBusWrite(void)                { (void)GPIO_BusWrite(&BENCH_Bus, ++BENCH_BusValue); }
+
+static void BENCH_LedSetup(void)                    { (void)LED_Init(&BENCH_Led); }
+static void BENCH_LedToggle(void)                   { (void)LED_Toggle(&BENCH_Led); }
+
+static void BENCH_LcdSetup(void)                    { (void)LCD_Init(&BENCH_Lcd); }
+static void BENCH_LcdWriteChar(void)                { (void)LCD_WriteChar(&BENCH_Lcd, 'A'); }
+static void BENCH_LcdFrameBufferSetup(void)         { (void)LCD_FrameBuffer_Init(&BENCH_Lcd); }
+static void BENCH_LcdFrameBufferWriteChar(void)     { (void)LCD_FrameBuffer_WriteChar(0, 0, ++BENCH_LcdChar); }
+static void BENCH_LcdFrameBufferRefresh(void)       { (void)LCD_FrameBuffer_Refresh(); }
+
+static void BENCH_SpiSetup(void)                    { (void)SPI_Init(&BENCH_Spi); }
+static void BENCH_SpiSendData(void)                 { (void)SPI_SendData(&BENCH_Spi, 0xA5); }
+static void BENCH_SpiExchangeData(void)             { (void)SPI_ExchangeData(&BENCH_Spi, 0xA5, &BENCH_SpiData); }
+static void BENCH_SpiWriteBuffer(void)              { (void)SPI_WriteBuffer(&BENCH_Spi, BENCH_SpiBuffer, 16); }
+static void BENCH_SpiTransferBuffer(void)           { (void)SPI_TransferBuffer(&BENCH_Spi, BENCH_SpiBuffer, BENCH_SpiBuffer, 16); }
+
+static void BENCH_EusartSetup(void)                 { (void)EUSART_Init(&BENCH_Eusart, 115200); }
+static void BENCH_EusartSendDataFrameBlocking(void) { (void)EUSART_SendDataFrameBlocking(&BENCH_Eusart, 'A'); }
+static void BENCH_EusartSendDataFrameNonBlocking(void) { (void)EUSART_SendDataFrameNonBlocking(&BENCH_Eusart, 'A'); }
+static void BENCH_EusartTxIsr(void)                 { EUSART_TX_ISR(); }
+
+static void BENCH_AdcSetup(void)                    { (void)ADC_Init(&BENCH_Adc); }
+static void BENCH_AdcStartConversion(void)          { (void)ADC_StartConversion(ADC_CHANNEL_0); }
+static void BENCH_AdcRead(void)                     { (void)ADC_Read(&BENCH_Adc, &BENCH_AdcValue); }
+static void BENCH_AdcScanSetup(void)                { (void)ADC_StartScan(&BENCH_Adc, &BENCH_AdcScan); }
+static void BENCH_AdcIsr(void)                      { ADC_ISR(); }
+static void BENCH_AdcGetScanResults(void)           { (void)ADC_GetScanResults(BENCH_AdcResults); }
+static void BENCH_AdcTriggerSetup(void)             { (void)ADC_StopScan(); (void)ADC_StartTriggeredSampling(&BENCH_Adc, &BENCH_AdcTrigger); }
+static void BENCH_AdcReadSample(void)               { (void)ADC_ReadSample(&BENCH_AdcValue); }
+
+static void BENCH_EepromReadByte(void)              { (void)EEPROM_ReadByte(0x0010, &BENCH_EepromData); }
+static void BENCH_EepromWriteByte(void)             { (void)EEPROM_WriteByte(0x0010, ++BENCH_EepromData); }
+static void BENCH_EepromWriteByteNonBlocking(void)  { (void)EEPROM_WriteByteNonBlocking(0x0011, ++BENCH_EepromData); }
+static void BENCH_EepromFlush(void)                 { (void)EEPROM_Flush(); }
+static void BENCH_EepromReadBlock(void)             { (void)EEPROM_ReadBlock(0x0020, BENCH_EepromBlock, 16); }
+static void BENCH_EepromWriteBlock(void)            { (void)EEPROM_WriteBlock(0x0020, BENCH_EepromBlock, 16); }
+
+static void BENCH_SwtimerHandler(void)              { }
+static void BENCH_SwtimerStart(void)                { (void)SWTIMER_Start(0, 100, SWTIMER_MODE_PERIODIC, BENCH_SwtimerHandler); }
+static void BENCH_SwtimerRestart(void)              { (void)SWTIMER_Restart(0); }
+static void BENCH_SwtimerTick(void)                 { SWTIMER_Tick(); }
+
+/* Every other timer armed, spread over the levels of the wheel */
+static void BENCH_SwtimerSetup(void)
+{
+    SWTIMER_IdTypeDef loc_id = 0;
+
+    (void)SWTIMER_Init();
+
+    for (loc_id = 1; loc_id < SWTIMER_NUMBER_OF_TIMERS; loc_id++)
+    {
+        (void)SWTIMER_Start(loc_id, (uint32)loc_id * loc_id * loc_id * 7U, SWTIMER_MODE_PERIODIC, BENCH_SwtimerHandler);
+    }
+}
+
+/* TIMER1 is already running for the benchmark, the time base is read without being initialized */
+static void BENCH_TimeGetMicros(void)               { BENCH_Timestamp = TIME_GetMicros(); }
+
+static void BENCH_Timer0Setup(void)                 { (void)TIMER0_Init(&BENCH_Timer0); (void)TIMER0_StartTimer(&BENCH_Timer0, 1000); }
+static void BENCH_Timer0Handler(void)               { }
+static void BENCH_Timer0Isr(void)                   { TIMER0_ISR(); }
+static void BENCH_Timer0WriteCounterValue(void)     { (void)TIMER0_WriteCounterValue(&BENCH_Timer0, 0x1234); }
+static void BENCH_Timer0ReadCounterValue(void)      { (void)TIMER0_ReadCounterValue(&BENCH_Timer0, &BENCH_Timer0Value); }
+
+static void BENCH_Ccp1Setup(void)                   { (void)CCP1_Init(&BENCH_Ccp1); (void)CCP1_PWM_SetFrequency(&BENCH_Ccp1, 5000); }
+static void BENCH_Ccp1PwmSetFrequency(void)         { (void)CCP1_PWM_SetFrequency(&BENCH_Ccp1, 20000); }
+static void BENCH_Ccp1PwmSetDutyCycle(void)         { (void)CCP1_PWM_SetDutyCycle(&BENCH_Ccp1, 50); }
+static void BENCH_Ccp1PwmSetDutyCycleRaw(void)      { (void)CCP1_PWM_SetDutyCycleRaw(&BENCH_Ccp1, 200); }
+static void BENCH_Ccp1PwmSetDutyCycleQ15(void)      { (void)CCP1_PWM_SetDutyCycleQ15(&BENCH_Ccp1, 0x4000); }
+
+static uint8 BENCH_Text[FORMAT_BUFFER_SIZE];
+
+/* The conversion LCD_WriteInt() used before FORMAT, one 32-bit division and modulo per digit */
+static void BENCH_DivideIntToString(void)
+{
+    sint32 loc_value = -1234567890L;
+    uint8 loc_length = 0;
+    uint8 loc_index = 0;
+    uint8 loc_swap = 0;
+
+    BENCH_Text[loc_length++] = '-';
+    loc_value = -loc_value;
+
+    while (loc_value > 0)
+    {
+        BENCH_Text[loc_length++] = ((loc_value % 10) + '0');
+        loc_value /= 10;
+    }
+
+    BENCH_Text[loc_length] = '\0';
+
+    for (loc_index = 1; loc_index < (loc_length - loc_index); loc_index++)
+    {
+        loc_swap = BENCH_Text[loc_index];
+        BENCH_Text[loc_index] = BENCH_Text[loc_length - loc_index];
+        BENCH_Text[loc_length - loc_index] = loc_swap;
+    }
+}
+
+static void BENCH_FormatSint32(void)                { (void)FORMAT_Sint32(-1234567890L, 0, ' ', BENCH_Text, NULL_PTR); }
+static void BENCH_FormatUint16(void)                { (void)FORMAT_Uint16(54321U, 0, ' ', BENCH_Text, NULL_PTR); }
+static void BENCH_FormatHex(void)                   { (void)FORMAT_Hex(0xBEEF1234UL, 8, BENCH_Text, NULL_PTR); }
+static void BENCH_FormatFixed(void)                 { (void)FORMAT_Fixed(-0x5A82L, 15, 4, 0, ' ', BENCH_Text, NULL_PTR); }
+
+const BENCH_CaseTypeDef BENCH_Cases[] =
+{
+    /* Runs first, no other interrupt source is enabled yet */
+    {"InterruptHandler (last source)",  BENCH_InterruptSetup,   BENCH_InterruptDispatch},
+    {"GPIO_SetChannelLogic",            BENCH_GpioSetup,        BENCH_GpioSetChannelLogic},
+    {"GPIO_ToggleChannelLogic",         NULL_PTR,               BENCH_GpioToggleChannelLogic},
+    {"GPIO_GetChannelLogic",            NULL_PTR,               BENCH_GpioGetChannelLogic},
+    {"GPIO_PIN_HIGH",                   NULL_PTR,               BENCH_GpioPinHigh},
+    {"GPIO_PIN_TOGGLE",                 NULL_PTR,               BENCH_GpioPinToggle},
+    {"GPIO_PIN_READ",                   NULL_PTR,               BENCH_GpioPinRead},
+    {"GPIO_WritePortMasked",            NULL_PTR,               BENCH_GpioWritePortMasked},
+    {"GPIO_BusWrite",                   BENCH_GpioBusSetup,     BENCH_GpioBusWrite},
+    {"LED_Toggle",                      BENCH_LedSetup,         BENCH_LedToggle},
+    {"LCD_WriteChar",                   BENCH_LcdSetup,         BENCH_LcdWriteChar},
+    {"LCD_FrameBuffer_WriteChar",       BENCH_LcdFrameBufferSetup, BENCH_LcdFrameBufferWriteChar},
+    /* The whole display is still to be sent, every call makes a transfer */
+    {"LCD_FrameBuffer_Refresh",         NULL_PTR,               BENCH_LcdFrameBufferRefresh},
+    {"SPI_SendData",                    BENCH_SpiSetup,         BENCH_SpiSendData},
+    {"SPI_ExchangeData",                NULL_PTR,               BENCH_SpiExchangeData},
+    {"SPI_WriteBuffer (16 bytes)",      NULL_PTR,               BENCH_SpiWriteBuffer},
+    {"SPI_TransferBuffer (16 bytes)",   NULL_PTR,               BENCH_SpiTransferBuffer},
+    {"EUSART_SendDataFrameBlocking",    BENCH_EusartSetup,      BENCH_EusartSendDataFrameBlocking},
+    /* Every frame queued by the first case is sent by the second one, the transmit buffer ends up empty */
+    {"EUSART_SendDataFrameNonBlocking", NULL_PTR,               BENCH_EusartSendDataFrameNonBlocking},
+    {"EUSART_TX_ISR",                   NULL_PTR,               BENCH_EusartTxIsr},
+    {"ADC_StartConversion",             BENCH_AdcSetup,         BENCH_AdcStartConversion},
+    {"ADC_Read",                        NULL_PTR,               BENCH_AdcRead},
+    {"ADC_ISR",                         BENCH_AdcScanSetup,     BENCH_AdcIsr},
+    {"ADC_GetScanResults",              NULL_PTR,               BENCH_AdcGetScanResults},
+    {"ADC_ISR (triggered sampling)",    BENCH_AdcTriggerSetup,  BENCH_AdcIsr},
+    {"ADC_ReadSample",                  NULL_PTR,               BENCH_AdcReadSample},
+    {"EEPROM_ReadByte",                 NULL_PTR,               BENCH_EepromReadByte},
+    {"EEPROM_WriteByte",                NULL_PTR,               BENCH_EepromWriteByte},
+    {"EEPROM_WriteByteNonBlocking",     BENCH_EepromFlush,      BENCH_EepromWriteByteNonBlocking},
+    {"EEPROM_ReadBlock",                BENCH_EepromFlush,      BENCH_EepromReadBlock},
+    {"EEPROM_WriteBlock (16 unchanged)", BENCH_EepromWriteBlock, BENCH_EepromWriteBlock},
+    {"SWTIMER_Start",                   BENCH_SwtimerSetup,     BENCH_SwtimerStart},
+    {"SWTIMER_Restart",                 NULL_PTR,               BENCH_SwtimerRestart},
+    {"SWTIMER_Tick",                    NULL_PTR,               BENCH_SwtimerTick},
+    {"TIME_GetMicros",                  NULL_PTR,               BENCH_TimeGetMicros},
+    {"TIMER0_ISR",                      BENCH_Timer0Setup,      BENCH_Timer0Isr},
+    {"TIMER0_WriteCounterValue",        NULL_PTR,               BENCH_Timer0WriteCounterValue},
+    {"TIMER0_ReadCounterValue",         NULL_PTR,               BENCH_Timer0ReadCounterValue},
+    {"CCP1_PWM_SetFrequency",           BENCH_Ccp1Setup,        BENCH_Ccp1PwmSetFrequency},
+    {"CCP1_PWM_SetDutyCycle",           NULL_PTR,               BENCH_Ccp1PwmSetDutyCycle},
+    {"CCP1_PWM_SetDutyCycleRaw",        NULL_PTR,               BENCH_Ccp1PwmSetDutyCycleRaw},
+    {"CCP1_PWM_SetDutyCycleQ15",        NULL_PTR,               BENCH_Ccp1PwmSetDutyCycleQ15},
+    {"intToString (/ 10 per digit)",    NULL_PTR,               BENCH_DivideIntToString},
+    {"FORMAT_Sint32 (10 digits)",       NULL_PTR,               BENCH_FormatSint32},
+    {"FORMAT_Uint16",                   NULL_PTR,               BENCH_FormatUint16},
+    {"FORMAT_Hex (8 digits)",           NULL_PTR,               BENCH_FormatHex},
+    {"FORMAT_Fixed (Q15, 4 decimals)",  NULL_PTR,               BENCH_FormatFixed},
+};
+
+const uint8 BENCH_NumberOfCases = (uint8)(sizeof(BENCH_Cases) / sizeof(BENCH_Cases[0]));
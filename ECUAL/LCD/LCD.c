@@ -1,25 +1,56 @@
 /**
  * @file LCD.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 25.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "LCD.h"
 
-static const uint8 RowOffsets[4] = {0x00, 0x40, 0x10, 0x50};
+/* Execution times of the HD44780 at its slowest oscillator, clear display and return home take the long one */
+#define LCD_LONG_COMMAND_DELAY_MS           2
+#define LCD_COMMAND_DELAY_US                50
 
-static Std_ReturnType LCD_SendHighNibble(const LCD_InitTypeDef * const InitPtr, const uint8 Data);
-static Std_ReturnType LCD_SendLowNibble(const LCD_InitTypeDef * const InitPtr, const uint8 Data);
-static Std_ReturnType LCD_SendEnable(const LCD_InitTypeDef * const InitPtr);
+static const uint8 RowOffsets[4] = {0x00, 0x40, 0x10, 0x50};
 
-static void LCD_reverseString(uint8 * const str, const uint8 length);
-static void LCD_intToString(sint32 Data, uint8 * const buffer);
-static void LCD_floatToString(float32 Data, uint8 * const buffer, uint8 precision);
+/* Data pins in order on a single port, written with one port access. A zero mask means they are written pin by pin */
+typedef struct
+{
+    uint8 Port;
+    uint8 Shift;
+    uint8 Mask;
+
+} LCD_DataPortTypeDef;
+
+static void LCD_GetDataPort(const LCD_InitTypeDef * const InitPtr, LCD_DataPortTypeDef * const loc_port_ret);
+static Std_ReturnType LCD_WriteDataPins(const LCD_InitTypeDef * const InitPtr,
+                                        const LCD_DataPortTypeDef * const loc_port, const uint8 loc_bits);
+static Std_ReturnType LCD_SetDataDirection(const LCD_InitTypeDef * const InitPtr,
+                                           const LCD_DataPortTypeDef * const loc_port,
+                                           const GPIO_DirectionTypeDef loc_direction);
+static Std_ReturnType LCD_Latch(const LCD_InitTypeDef * const InitPtr);
+static Std_ReturnType LCD_Transfer(const LCD_InitTypeDef * const InitPtr, const GPIO_LogicTypeDef loc_rs,
+                                   const uint8 loc_data);
+static Std_ReturnType LCD_WaitReady(const LCD_InitTypeDef * const InitPtr, const boolean loc_long);
+
+#if (LCD_FRAME_BUFFER_FEATURE == STD_ON)
+#define LCD_FRAME_BUFFER_CELLS              (LCD_FRAME_BUFFER_ROWS * LCD_FRAME_BUFFER_COLUMNS)
+#define LCD_FRAME_BUFFER_NO_ADDRESS         0xFF
+
+static const LCD_InitTypeDef *LCD_FrameLcd = NULL_PTR;
+static uint8 LCD_FrameCells[LCD_FRAME_BUFFER_CELLS];
+static uint8 LCD_FrameDirty[(LCD_FRAME_BUFFER_CELLS + 7) / 8];
+static uint8 LCD_FrameCount = 0;
+static uint8 LCD_FrameScan = 0;
+static uint8 LCD_FrameAddress = LCD_FRAME_BUFFER_NO_ADDRESS;
+
+static void LCD_FrameBufferPut(const uint8 loc_cell, const uint8 loc_data);
+#endif
 
 Std_ReturnType LCD_Init(const LCD_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
+    LCD_DataPortTypeDef loc_port;
 
     if (NULL_PTR != InitPtr)
     {
@@ -27,27 +58,28 @@ Std_ReturnType LCD_Init(const LCD_InitTypeDef * const InitPtr)
         loc_ret |= GPIO_SetChannelDirection(&(InitPtr->RW), GPIO_OUTPUT);
         loc_ret |= GPIO_SetChannelDirection(&(InitPtr->E),  GPIO_OUTPUT);
 
-        uint8 loc_counter = (LCD_MODE_4BIT == InitPtr->Mode) ? 4 : 0;
-        for (; loc_counter < 8; ++loc_counter)
-        {
-            loc_ret |= GPIO_SetChannelDirection(&(InitPtr->D[loc_counter]),  GPIO_OUTPUT);
-        }
+        LCD_GetDataPort(InitPtr, &loc_port);
+        loc_ret |= LCD_SetDataDirection(InitPtr, &loc_port, GPIO_OUTPUT);
 
+        // The busy flag cannot be read before the interface is set, the function set commands are timed.
         switch (InitPtr->Mode)
         {
             case LCD_MODE_4BIT:
                 DELAY_MS(15);
-                loc_ret |= LCD_SendCommand(InitPtr, LCD_COMMAND_RETURN_HOME);
-                loc_ret |= LCD_SendCommand(InitPtr, LCD_COMMAND_4BIT_MODE_2LINE);
+                loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, LCD_COMMAND_RETURN_HOME);
+                DELAY_MS(LCD_LONG_COMMAND_DELAY_MS);
+                loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, LCD_COMMAND_4BIT_MODE_2LINE);
+                DELAY_US(LCD_COMMAND_DELAY_US);
                 break;
 
             case LCD_MODE_8BIT:
                 DELAY_MS(15);
-                loc_ret |= LCD_SendCommand(InitPtr, LCD_COMMAND_8BIT_MODE_2LINE);
+                loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, LCD_COMMAND_8BIT_MODE_2LINE);
                 DELAY_MS(5);
-                loc_ret |= LCD_SendCommand(InitPtr, LCD_COMMAND_8BIT_MODE_2LINE);
+                loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, LCD_COMMAND_8BIT_MODE_2LINE);
                 DELAY_US(100);
-                loc_ret |= LCD_SendCommand(InitPtr, LCD_COMMAND_8BIT_MODE_2LINE);
+                loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, LCD_COMMAND_8BIT_MODE_2LINE);
+                DELAY_US(LCD_COMMAND_DELAY_US);
                 break;
 
             default:
@@ -75,33 +107,8 @@ Std_ReturnType LCD_SendCommand(const LCD_InitTypeDef * const InitPtr, const LCD_
 
     if (NULL_PTR != InitPtr)
     {
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RW), GPIO_LOW);   
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RS), GPIO_LOW);  
-
-        switch (InitPtr->Mode)
-        {
-            case LCD_MODE_4BIT:
-
-                loc_ret |= LCD_SendHighNibble(InitPtr, Command);
-                loc_ret |= LCD_SendEnable(InitPtr);
-                loc_ret |= LCD_SendLowNibble(InitPtr, Command);
-                loc_ret |= LCD_SendEnable(InitPtr);
-
-                break;
-
-            case LCD_MODE_8BIT:
-
-                for (uint8 loc_counter = 0; loc_counter < 8; ++loc_counter)
-                {
-                    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->D[loc_counter]), ((Command >> loc_counter) & 1));
-                }
-                loc_ret |= LCD_SendEnable(InitPtr);
-
-                break;
-
-            default:
-                loc_ret = E_NOT_OK;
-        } 
+        loc_ret |= LCD_Transfer(InitPtr, GPIO_LOW, Command);
+        loc_ret |= LCD_WaitReady(InitPtr, (Command < LCD_COMMAND_DECREMENT_CURSOR) ? TRUE : FALSE);
     }
     else
     {
@@ -117,33 +124,8 @@ Std_ReturnType LCD_WriteChar(const LCD_InitTypeDef * const InitPtr, const uint8
 
     if (NULL_PTR != InitPtr)
     {
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RW), GPIO_LOW);   
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RS), GPIO_HIGH);  
-
-        switch (InitPtr->Mode)
-        {
-            case LCD_MODE_4BIT:
-
-                loc_ret |= LCD_SendHighNibble(InitPtr, Data);
-                loc_ret |= LCD_SendEnable(InitPtr);
-                loc_ret |= LCD_SendLowNibble(InitPtr, Data);
-                loc_ret |= LCD_SendEnable(InitPtr);
-
-                break;
-
-            case LCD_MODE_8BIT:
-
-                for (uint8 loc_counter = 0; loc_counter < 8; ++loc_counter)
-                {
-                    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->D[loc_counter]), ((Data >> loc_counter) & 1));
-                }
-                loc_ret |= LCD_SendEnable(InitPtr);
-
-                break;
-
-            default:
-                loc_ret = E_NOT_OK;
-        } 
+        loc_ret |= LCD_Transfer(InitPtr, GPIO_HIGH, Data);
+        loc_ret |= LCD_WaitReady(InitPtr, FALSE);
     }
     else
     {
@@ -178,10 +160,9 @@ Std_ReturnType LCD_WriteInt(const LCD_InitTypeDef * const InitPtr, const sint32
 
     if (NULL_PTR != InitPtr)
     {
-        uint8 buffer[17];
-
-        LCD_intToString(Data, buffer);
+        uint8 buffer[FORMAT_BUFFER_SIZE];
 
+        loc_ret |= FORMAT_Sint32(Data, 0, ' ', buffer, NULL_PTR);
         loc_ret |= LCD_WriteString(InitPtr, buffer);
     }
     else
@@ -196,13 +177,30 @@ Std_ReturnType LCD_WriteFloat(const LCD_InitTypeDef * const InitPtr, const float
 {
     Std_ReturnType loc_ret = E_OK;
 
-    if (NULL_PTR != InitPtr)
+    if ((NULL_PTR != InitPtr) && (Precision <= FORMAT_MAX_DECIMALS))
     {
-        uint8 buffer[17];
-        
-        LCD_floatToString(Data, buffer, Precision);
+        uint8 buffer[FORMAT_BUFFER_SIZE];
+        float32 loc_magnitude = (Data < 0) ? -Data : Data;
+        uint32 loc_integer = (uint32)loc_magnitude;
+        float32 loc_fraction = loc_magnitude - loc_integer;
+
+        if (Data < 0)
+        {
+            loc_ret |= LCD_WriteChar(InitPtr, '-');
+        }
 
+        loc_ret |= FORMAT_Uint32(loc_integer, 0, ' ', buffer, NULL_PTR);
         loc_ret |= LCD_WriteString(InitPtr, buffer);
+
+        if (Precision > 0)
+        {
+            for (uint8 i = 0; i < Precision; ++i) loc_fraction *= 10;
+
+            // The leading zeros of the fraction are kept by the field width.
+            loc_ret |= FORMAT_Uint32((uint32)loc_fraction, Precision, '0', buffer, NULL_PTR);
+            loc_ret |= LCD_WriteChar(InitPtr, '.');
+            loc_ret |= LCD_WriteString(InitPtr, buffer);
+        }
     }
     else
     {
@@ -212,6 +210,51 @@ Std_ReturnType LCD_WriteFloat(const LCD_InitTypeDef * const InitPtr, const float
     return loc_ret;   
 }
 
+Std_ReturnType LCD_WriteHex(const LCD_InitTypeDef * const InitPtr, const uint32 Data, const uint8 Digits)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 buffer[FORMAT_BUFFER_SIZE];
+
+    if (NULL_PTR != InitPtr)
+    {
+        loc_ret |= FORMAT_Hex(Data, Digits, buffer, NULL_PTR);
+
+        if (E_OK == loc_ret)
+        {
+            loc_ret |= LCD_WriteString(InitPtr, buffer);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType LCD_WriteFixed(const LCD_InitTypeDef * const InitPtr, const sint32 Data, const uint8 FractionBits,
+                              const uint8 Decimals)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 buffer[FORMAT_BUFFER_SIZE];
+
+    if (NULL_PTR != InitPtr)
+    {
+        loc_ret |= FORMAT_Fixed(Data, FractionBits, Decimals, 0, ' ', buffer, NULL_PTR);
+
+        if (E_OK == loc_ret)
+        {
+            loc_ret |= LCD_WriteString(InitPtr, buffer);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
 Std_ReturnType LCD_SetCursor(const LCD_InitTypeDef * const InitPtr, const uint8 Row, const uint8 Column)
 {
     Std_ReturnType loc_ret = E_OK;
@@ -252,106 +295,385 @@ Std_ReturnType LCD_ClearRow(const LCD_InitTypeDef * const InitPtr, const uint8 R
     return loc_ret;
 }
 
-static Std_ReturnType LCD_SendHighNibble(const LCD_InitTypeDef * const InitPtr, const uint8 Data)
+#if (LCD_FRAME_BUFFER_FEATURE == STD_ON)
+Std_ReturnType LCD_FrameBuffer_Init(const LCD_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
+    uint8 loc_cell = 0;
 
-    for (uint8 loc_counter = 4; loc_counter < 8; ++loc_counter)
+    if ((NULL_PTR != InitPtr) && (0 != InitPtr->Display.Rows) && (InitPtr->Display.Rows <= LCD_FRAME_BUFFER_ROWS) &&
+        (0 != InitPtr->Display.Columns) && (InitPtr->Display.Columns <= LCD_FRAME_BUFFER_COLUMNS))
     {
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->D[loc_counter]), ((Data >> loc_counter) & 0x01));
+        LCD_FrameLcd = NULL_PTR;
+        LCD_FrameCount = InitPtr->Display.Rows * InitPtr->Display.Columns;
+
+        // The cells past a smaller display must not stay marked from a previous one.
+        for (loc_cell = 0; loc_cell < sizeof(LCD_FrameDirty); loc_cell++)
+        {
+            LCD_FrameDirty[loc_cell] = 0;
+        }
+
+        for (loc_cell = 0; loc_cell < LCD_FrameCount; loc_cell++)
+        {
+            LCD_FrameCells[loc_cell] = 0x20;
+            LCD_FrameDirty[loc_cell >> 3] |= (uint8)(1 << (loc_cell & 0x07));
+        }
+
+        LCD_FrameScan = 0;
+        LCD_FrameAddress = LCD_FRAME_BUFFER_NO_ADDRESS;
+        LCD_FrameLcd = InitPtr;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
     }
 
     return loc_ret;
 }
 
-static Std_ReturnType LCD_SendLowNibble(const LCD_InitTypeDef * const InitPtr, const uint8 Data)
+Std_ReturnType LCD_FrameBuffer_WriteChar(const uint8 Row, const uint8 Column, const uint8 Data)
 {
     Std_ReturnType loc_ret = E_OK;
 
-    for (uint8 loc_counter = 0; loc_counter < 4; ++loc_counter)
+    if ((NULL_PTR != LCD_FrameLcd) && (Row < LCD_FrameLcd->Display.Rows) && (Column < LCD_FrameLcd->Display.Columns))
+    {
+        LCD_FrameBufferPut((Row * LCD_FrameLcd->Display.Columns) + Column, Data);
+    }
+    else
     {
-        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->D[loc_counter + 4]), ((Data >> loc_counter) & 0x01));
+        loc_ret = E_NOT_OK;
     }
 
-    return loc_ret;  
+    return loc_ret;
 }
 
-static Std_ReturnType LCD_SendEnable(const LCD_InitTypeDef * const InitPtr)
+Std_ReturnType LCD_FrameBuffer_WriteString(const uint8 Row, const uint8 Column, const uint8 *Data)
 {
     Std_ReturnType loc_ret = E_OK;
+    uint8 loc_cell = 0;
+    uint8 loc_end = 0;
 
-    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_HIGH);
+    if ((NULL_PTR != LCD_FrameLcd) && (NULL_PTR != Data) && (Row < LCD_FrameLcd->Display.Rows) &&
+        (Column < LCD_FrameLcd->Display.Columns))
+    {
+        loc_cell = (Row * LCD_FrameLcd->Display.Columns) + Column;
+        loc_end = (Row + 1) * LCD_FrameLcd->Display.Columns;
 
-    DELAY_US(1);
+        while ((*Data) && (loc_cell < loc_end))
+        {
+            LCD_FrameBufferPut(loc_cell++, *Data++);
+        }
 
-    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_LOW);
+        if (*Data)
+        {
+            loc_ret = E_NOT_OK;
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType LCD_FrameBuffer_ClearRow(const uint8 Row)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_cell = 0;
+    uint8 loc_end = 0;
+
+    if ((NULL_PTR != LCD_FrameLcd) && (Row < LCD_FrameLcd->Display.Rows))
+    {
+        loc_end = (Row + 1) * LCD_FrameLcd->Display.Columns;
+
+        for (loc_cell = Row * LCD_FrameLcd->Display.Columns; loc_cell < loc_end; loc_cell++)
+        {
+            LCD_FrameBufferPut(loc_cell, 0x20);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType LCD_FrameBuffer_Refresh(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_cell = LCD_FrameScan;
+    uint8 loc_checked = 0;
+    uint8 loc_step = 0;
+    uint8 loc_row = 0;
+    uint8 loc_address = 0;
+
+    if (NULL_PTR != LCD_FrameLcd)
+    {
+        // The next changed cell from the last one sent, whole bytes of unchanged cells are skipped at once.
+        while ((loc_checked < LCD_FrameCount) && (0 == (LCD_FrameDirty[loc_cell >> 3] & (1 << (loc_cell & 0x07)))))
+        {
+            loc_step = 1;
+
+            if ((0 == (loc_cell & 0x07)) && (0 == LCD_FrameDirty[loc_cell >> 3]))
+            {
+                loc_step = ((LCD_FrameCount - loc_cell) < 8) ? (LCD_FrameCount - loc_cell) : 8;
+            }
+
+            loc_checked += loc_step;
+            loc_cell += loc_step;
+
+            if (loc_cell >= LCD_FrameCount)
+            {
+                loc_cell = 0;
+            }
+        }
+
+        // With the busy flag the previous transfer is waited for, otherwise the calls are spaced by the caller.
+        if ((loc_checked < LCD_FrameCount) && (LCD_WAIT_BUSY_FLAG == LCD_FrameLcd->Wait))
+        {
+            loc_ret = LCD_WaitReady(LCD_FrameLcd, FALSE);
+        }
+
+        if ((E_OK == loc_ret) && (loc_checked < LCD_FrameCount))
+        {
+            for (loc_row = 0, loc_address = loc_cell; loc_address >= LCD_FrameLcd->Display.Columns; loc_row++)
+            {
+                loc_address -= LCD_FrameLcd->Display.Columns;
+            }
+
+            loc_address += RowOffsets[loc_row];
+
+            if (loc_address != LCD_FrameAddress)
+            {
+                loc_ret = LCD_Transfer(LCD_FrameLcd, GPIO_LOW, (LCD_COMMAND_DDRAM_BASE | loc_address));
+                LCD_FrameAddress = loc_address;
+                LCD_FrameScan = loc_cell;
+            }
+            else
+            {
+                // Cleared before the cell is read, a write in between marks it again.
+                LCD_FrameDirty[loc_cell >> 3] &= (uint8)~(1 << (loc_cell & 0x07));
+
+                loc_ret = LCD_Transfer(LCD_FrameLcd, GPIO_HIGH, LCD_FrameCells[loc_cell]);
+                LCD_FrameAddress = loc_address + 1;
+                LCD_FrameScan = ((loc_cell + 1) < LCD_FrameCount) ? (loc_cell + 1) : 0;
+            }
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
 
-    DELAY_MS(2);
+    return loc_ret;
+}
+
+Std_ReturnType LCD_FrameBuffer_IsIdle(boolean * const Idle_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+    uint8 loc_dirty = 0;
+
+    if ((NULL_PTR != LCD_FrameLcd) && (NULL_PTR != Idle_ret))
+    {
+        for (loc_index = 0; loc_index < sizeof(LCD_FrameDirty); loc_index++)
+        {
+            loc_dirty |= LCD_FrameDirty[loc_index];
+        }
+
+        *Idle_ret = (0 == loc_dirty) ? TRUE : FALSE;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
 
     return loc_ret;
 }
 
-static void LCD_reverseString(uint8 * const str, const uint8 length) 
+static void LCD_FrameBufferPut(const uint8 loc_cell, const uint8 loc_data)
 {
-    uint8 start = 0;
-    uint8 end = length - 1;
-    
-    while (start < end) 
+    // The cell is written before it is marked, so a refresh in between cannot leave it unsent.
+    if (LCD_FrameCells[loc_cell] != loc_data)
     {
-        str[start]   ^= str[end];
-        str[end]     ^= str[start];
-        str[start++] ^= str[end--];
+        LCD_FrameCells[loc_cell] = loc_data;
+        LCD_FrameDirty[loc_cell >> 3] |= (uint8)(1 << (loc_cell & 0x07));
     }
 }
+#endif
 
-static void LCD_intToString(sint32 Data, uint8 * const buffer) 
+/* Checks whether D4..D7 in 4-bit mode or D0..D7 in 8-bit mode are in order on a single port */
+static void LCD_GetDataPort(const LCD_InitTypeDef * const InitPtr, LCD_DataPortTypeDef * const loc_port_ret)
 {
-    uint8 i = 0;
-    boolean isNegative = 0;
-    
-    if (0 == Data) 
+    uint8 loc_first = (LCD_MODE_4BIT == InitPtr->Mode) ? 4 : 0;
+    uint8 loc_counter = loc_first + 1;
+
+    while ((loc_counter < 8) && (InitPtr->D[loc_counter].Port == InitPtr->D[loc_first].Port) &&
+           (InitPtr->D[loc_counter].Pin == (InitPtr->D[loc_first].Pin + (loc_counter - loc_first))))
     {
-        buffer[i++] = '0';
-        buffer[i] = '\0';
+        loc_counter++;
+    }
 
-        return;
+    loc_port_ret->Port = InitPtr->D[loc_first].Port;
+    loc_port_ret->Shift = InitPtr->D[loc_first].Pin;
+
+    if ((8 == loc_counter) && (loc_port_ret->Port < NUMBER_OF_PORTS))
+    {
+        loc_port_ret->Mask = (uint8)(((1U << (8 - loc_first)) - 1U) << loc_port_ret->Shift);
     }
-    
-    if (Data < 0) 
+    else
     {
-        isNegative = 1;
-        Data = -Data;
+        loc_port_ret->Mask = 0;
     }
-    
-    while (Data > 0) 
+}
+
+/* Drives D4..D7 in 4-bit mode or D0..D7 in 8-bit mode, bit 0 of loc_bits on the lowest one */
+static Std_ReturnType LCD_WriteDataPins(const LCD_InitTypeDef * const InitPtr,
+                                        const LCD_DataPortTypeDef * const loc_port, const uint8 loc_bits)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_counter = (LCD_MODE_4BIT == InitPtr->Mode) ? 4 : 0;
+    uint8 loc_bit = 0;
+
+    if (0 != loc_port->Mask)
     {
-        buffer[i++] = ((Data % 10) + '0');
-        Data /= 10;
+        loc_ret = GPIO_WritePortMasked(loc_port->Port, loc_port->Mask, (uint8)(loc_bits << loc_port->Shift));
+    }
+    else
+    {
+        for (; loc_counter < 8; ++loc_counter, ++loc_bit)
+        {
+            loc_ret |= GPIO_SetChannelLogic(&(InitPtr->D[loc_counter]), ((loc_bits >> loc_bit) & 0x01));
+        }
     }
-    
-    if (isNegative) buffer[i++] = '-';
 
-    buffer[i] = '\0';
-    
-    LCD_reverseString(buffer, i);
+    return loc_ret;
+}
+
+static Std_ReturnType LCD_SetDataDirection(const LCD_InitTypeDef * const InitPtr,
+                                           const LCD_DataPortTypeDef * const loc_port,
+                                           const GPIO_DirectionTypeDef loc_direction)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_counter = (LCD_MODE_4BIT == InitPtr->Mode) ? 4 : 0;
+    uint8 loc_tris = 0;
+
+    if (0 != loc_port->Mask)
+    {
+        loc_ret |= GPIO_GetPortDirection(loc_port->Port, &loc_tris);
+        loc_tris = (GPIO_INPUT == loc_direction) ? (loc_tris | loc_port->Mask) : (loc_tris & (uint8)~loc_port->Mask);
+        loc_ret |= GPIO_SetPortDirection(loc_port->Port, loc_tris);
+    }
+    else
+    {
+        for (; loc_counter < 8; ++loc_counter)
+        {
+            loc_ret |= GPIO_SetChannelDirection(&(InitPtr->D[loc_counter]), loc_direction);
+        }
+    }
+
+    return loc_ret;
 }
 
-static void LCD_floatToString(float32 Data, uint8 * const buffer, uint8 precision) 
-{   
-    sint32 intPart = (sint32)Data;
-    float32 fracPart = Data - intPart;
+static Std_ReturnType LCD_Latch(const LCD_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_HIGH);
+
+    DELAY_US(1);
+
+    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_LOW);
+
+    return loc_ret;
+}
+
+static Std_ReturnType LCD_Transfer(const LCD_InitTypeDef * const InitPtr, const GPIO_LogicTypeDef loc_rs,
+                                   const uint8 loc_data)
+{
+    Std_ReturnType loc_ret = E_OK;
+    LCD_DataPortTypeDef loc_port;
 
-    LCD_intToString(intPart, buffer);
+    LCD_GetDataPort(InitPtr, &loc_port);
 
-    uint8 i = 0;
-    while (buffer[++i]); 
+    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RW), GPIO_LOW);
+    loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RS), loc_rs);
 
-    if (precision > 0) 
+    switch (InitPtr->Mode)
     {
-        buffer[i++] = '.';
+        case LCD_MODE_4BIT:
 
-        while (precision-- > 0) fracPart *= 10;
+            loc_ret |= LCD_WriteDataPins(InitPtr, &loc_port, (loc_data >> 4));
+            loc_ret |= LCD_Latch(InitPtr);
+            loc_ret |= LCD_WriteDataPins(InitPtr, &loc_port, (loc_data & 0x0F));
+            loc_ret |= LCD_Latch(InitPtr);
 
-        LCD_intToString((fracPart < 0) ? -(sint32)fracPart : (sint32)fracPart, (buffer + i));
+            break;
+
+        case LCD_MODE_8BIT:
+
+            loc_ret |= LCD_WriteDataPins(InitPtr, &loc_port, loc_data);
+            loc_ret |= LCD_Latch(InitPtr);
+
+            break;
+
+        default:
+            loc_ret = E_NOT_OK;
     }
-}
\ No newline at end of file
+
+    return loc_ret;
+}
+static Std_ReturnType LCD_WaitReady(const LCD_InitTypeDef * const InitPtr, const boolean loc_long)
+{
+    Std_ReturnType loc_ret = E_OK;
+    GPIO_LogicTypeDef loc_busy = GPIO_HIGH;
+    uint16 loc_polls = 0;
+    LCD_DataPortTypeDef loc_port;
+
+    if (LCD_WAIT_BUSY_FLAG == InitPtr->Wait)
+    {
+        LCD_GetDataPort(InitPtr, &loc_port);
+
+        // The LCD drives the data pins while RW is high.
+        loc_ret |= LCD_SetDataDirection(InitPtr, &loc_port, GPIO_INPUT);
+
+        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RS), GPIO_LOW);
+        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RW), GPIO_HIGH);
+
+        while ((E_OK == loc_ret) && (GPIO_HIGH == loc_busy) && (loc_polls < LCD_BUSY_FLAG_TIMEOUT_POLLS))
+        {
+            loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_HIGH);
+            DELAY_US(1);
+            loc_ret |= GPIO_GetChannelLogic(&(InitPtr->D[7]), &loc_busy);
+            loc_ret |= GPIO_SetChannelLogic(&(InitPtr->E), GPIO_LOW);
+
+            // In 4-bit mode the low nibble of the address counter has to be read out as well.
+            if (LCD_MODE_4BIT == InitPtr->Mode)
+            {
+                loc_ret |= LCD_Latch(InitPtr);
+            }
+
+            loc_polls++;
+        }
+
+        loc_ret |= GPIO_SetChannelLogic(&(InitPtr->RW), GPIO_LOW);
+        loc_ret |= LCD_SetDataDirection(InitPtr, &loc_port, GPIO_OUTPUT);
+
+        if (GPIO_HIGH == loc_busy)
+        {
+            loc_ret = E_NOT_OK;
+        }
+    }
+    else if (TRUE == loc_long)
+    {
+        DELAY_MS(LCD_LONG_COMMAND_DELAY_MS);
+    }
+    else
+    {
+        DELAY_US(LCD_COMMAND_DELAY_US);
+    }
+
+    return loc_ret;
+}
@@ -14,15 +14,17 @@
  * @note The LCD interface simplifies working with LCD displays across different microcontroller families and
  *       development environments.
  * 
- * @version 0.1
- * @date 25.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _LCD_H_
 #define _LCD_H_
 
-#include <builtins.h>
+#include "../../lib/compiler.h"
 #include "../../MCAL/GPIO/GPIO.h"
+#include "LCD_Config.h"
+#include "../../lib/FORMAT/FORMAT.h"
 
 typedef enum
 {
@@ -56,6 +58,14 @@ typedef struct
     
 } LCD_DisplayTypeDef;
 
+typedef enum
+{
+    LCD_WAIT_DELAY = 0,         /* RW tied to ground, every command waits for its longest execution time */
+    LCD_WAIT_BUSY_FLAG,         /* RW connected, every command waits until the LCD clears its busy flag */
+    LCD_WAIT_LIMIT
+
+} LCD_WaitTypeDef;
+
 typedef struct
 {
     LCD_ModeTypeDef Mode;
@@ -66,6 +76,8 @@ typedef struct
     GPIO_InitTypeDef E;
     GPIO_InitTypeDef D[8];
 
+    LCD_WaitTypeDef Wait;
+
 } LCD_InitTypeDef;
 
 /**
@@ -82,6 +94,8 @@ typedef struct
  * @note This function must be called before using the LCD for any display operations.
  * @note The @param InitPtr parameter should point to a valid LCD_InitTypeDef structure containing appropriate
  *       configuration settings.
+ * @note When the data pins (D4..D7 in 4-bit mode, D0..D7 in 8-bit mode) are in order on a single port, every nibble
+ *       or byte is written with a single port access, otherwise the data pins are written pin by pin.
  */
 Std_ReturnType LCD_Init(const LCD_InitTypeDef * const InitPtr);
 
@@ -166,7 +180,7 @@ Std_ReturnType LCD_WriteInt(const LCD_InitTypeDef * const InitPtr, const sint32
  *
  * @param InitPtr Pointer to the LCD initialization structure containing configuration parameters.
  * @param Data The floating-point value to be displayed on the LCD.
- * @param Precision The number of decimal places to display.
+ * @param Precision The number of decimal places to display, up to FORMAT_MAX_DECIMALS.
  * @return Std_ReturnType Error status indicating the success of writing the floating-point value.
  *     - E_OK: The floating-point value was written successfully.
  *     - E_NOT_OK: An error occurred during floating-point display (e.g., invalid configuration or value).
@@ -178,6 +192,32 @@ Std_ReturnType LCD_WriteInt(const LCD_InitTypeDef * const InitPtr, const sint32
  */
 Std_ReturnType LCD_WriteFloat(const LCD_InitTypeDef * const InitPtr, const float32 Data, const uint8 Precision);
 
+/**
+ * @brief Write an unsigned value in upper case hexadecimal to the Liquid Crystal Display (LCD).
+ *
+ * @param InitPtr Pointer to the LCD initialization structure containing configuration parameters.
+ * @param Data The value to be displayed, only its @param Digits lowest nibbles are displayed.
+ * @param Digits The number of hexadecimal digits, from 1 to 8.
+ * @return Std_ReturnType Error status indicating the success of writing the value.
+ *     - E_OK: The value was written successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or @param Digits out of range.
+ */
+Std_ReturnType LCD_WriteHex(const LCD_InitTypeDef * const InitPtr, const uint32 Data, const uint8 Digits);
+
+/**
+ * @brief Write a Q-format fixed-point value to the Liquid Crystal Display (LCD), without floating-point math.
+ *
+ * @param InitPtr Pointer to the LCD initialization structure containing configuration parameters.
+ * @param Data The fixed-point value to be displayed, @param Data / 2^@param FractionBits.
+ * @param FractionBits The number of fraction bits of @param Data, up to FORMAT_MAX_FRACTION_BITS.
+ * @param Decimals The number of decimal places to display, rounded, up to FORMAT_MAX_DECIMALS.
+ * @return Std_ReturnType Error status indicating the success of writing the value.
+ *     - E_OK: The value was written successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or a parameter out of range.
+ */
+Std_ReturnType LCD_WriteFixed(const LCD_InitTypeDef * const InitPtr, const sint32 Data, const uint8 FractionBits,
+                              const uint8 Decimals);
+
 /**
  * @brief Set the cursor position on the Liquid Crystal Display (LCD).
  *
@@ -216,4 +256,89 @@ Std_ReturnType LCD_SetCursor(const LCD_InitTypeDef * const InitPtr, const uint8
  */
 Std_ReturnType LCD_ClearRow(const LCD_InitTypeDef * const InitPtr, const uint8 Row);
 
+#if (LCD_FRAME_BUFFER_FEATURE == STD_ON)
+
+/**
+ * @brief Attach an initialized LCD to the frame buffer.
+ *
+ * The frame buffer is a RAM copy of the display. The LCD_FrameBuffer_Write functions only update this copy and mark
+ * the cells that changed, each LCD_FrameBuffer_Refresh() call then sends one changed cell or one cursor move to the
+ * LCD. The cursor is only moved when the next changed cell does not follow the last one written.
+ *
+ * Every cell is cleared and marked as changed, so the first refresh pass overwrites the whole display.
+ *
+ * @param InitPtr Pointer to the LCD initialization structure, initialized with LCD_Init().
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The LCD was attached successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or a display larger than LCD_FRAME_BUFFER_ROWS x LCD_FRAME_BUFFER_COLUMNS.
+ *
+ * @note The direct LCD functions move the LCD cursor behind the frame buffer, call this function again after using
+ *       them on the attached LCD.
+ */
+Std_ReturnType LCD_FrameBuffer_Init(const LCD_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Write a character to the frame buffer.
+ *
+ * @param Row The row index (starting from 0) of the cell.
+ * @param Column The column index (starting from 0) of the cell.
+ * @param Data The character to be displayed.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The character was written successfully.
+ *     - E_NOT_OK: No LCD attached or the cell is outside the display.
+ */
+Std_ReturnType LCD_FrameBuffer_WriteChar(const uint8 Row, const uint8 Column, const uint8 Data);
+
+/**
+ * @brief Write a null-terminated string to the frame buffer, from a cell towards the end of its row.
+ *
+ * @param Row The row index (starting from 0) of the first cell.
+ * @param Column The column index (starting from 0) of the first cell.
+ * @param Data Pointer to the null-terminated string to be displayed.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The string was written successfully.
+ *     - E_NOT_OK: No LCD attached, NULL @param Data, the first cell is outside the display or the string was cut
+ *       at the end of the row.
+ */
+Std_ReturnType LCD_FrameBuffer_WriteString(const uint8 Row, const uint8 Column, const uint8 *Data);
+
+/**
+ * @brief Clear a row of the frame buffer.
+ *
+ * @param Row The row index (starting from 0) to be cleared.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The row was cleared successfully.
+ *     - E_NOT_OK: No LCD attached or the row is outside the display.
+ */
+Std_ReturnType LCD_FrameBuffer_ClearRow(const uint8 Row);
+
+/**
+ * @brief Send the next changed cell of the frame buffer to the LCD.
+ *
+ * Each call makes a single transfer to the LCD. In LCD_WAIT_BUSY_FLAG mode the busy flag is polled before it, until
+ * the LCD has executed the previous transfer. In LCD_WAIT_DELAY mode the call does not wait, so consecutive calls
+ * must be at least 50 us apart. Calling it from a periodic software timer (see SWTIMER_Start()) keeps the display up
+ * to date in the background.
+ *
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: A transfer was made or no cell has changed.
+ *     - E_NOT_OK: No LCD attached, the LCD stayed busy or the transfer failed.
+ *
+ * @note The frame buffer can be written while this function runs from an interrupt, the worst case is a cell sent
+ *       twice.
+ */
+Std_ReturnType LCD_FrameBuffer_Refresh(void);
+
+/**
+ * @brief Retrieve whether the LCD shows the whole frame buffer.
+ *
+ * @param Idle_ret Pointer to a boolean variable, TRUE when no cell is waiting to be sent.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The status was stored successfully.
+ *     - E_NOT_OK: No LCD attached or NULL @param Idle_ret.
+ */
+Std_ReturnType LCD_FrameBuffer_IsIdle(boolean * const Idle_ret);
+
+#endif
+
 #endif /* _LCD_H_ */
\ No newline at end of file
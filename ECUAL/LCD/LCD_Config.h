@@ -0,0 +1,59 @@
+/**
+ * @file LCD_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief LCD Display Configuration
+ *
+ * The `LCD_Config.h` header file offers a centralized location to configure the LCD display interface, such as the
+ * frame buffer, the largest display it has to hold and the busy flag timeout.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _LCD_CONFIG_H_
+#define _LCD_CONFIG_H_
+
+/**
+ * @def LCD_FRAME_BUFFER_FEATURE
+ * @brief Control macro to enable or disable the LCD frame buffer.
+ *     - STD_ON: The application writes to a RAM copy of the display, refreshed on the LCD in the background.
+ *     - STD_OFF: Only the direct LCD functions are available.
+ */
+#define LCD_FRAME_BUFFER_FEATURE                                STD_ON
+
+/**
+ * @def LCD_FRAME_BUFFER_ROWS
+ * @brief Largest number of rows of the display attached to the frame buffer (1 to 4).
+ */
+#define LCD_FRAME_BUFFER_ROWS                                   2
+
+/**
+ * @def LCD_FRAME_BUFFER_COLUMNS
+ * @brief Largest number of columns of the display attached to the frame buffer.
+ */
+#define LCD_FRAME_BUFFER_COLUMNS                                16
+
+/**
+ * @def LCD_BUSY_FLAG_TIMEOUT_POLLS
+ * @brief Number of busy flag reads after which an LCD that stays busy is reported as failed (1 to 65535).
+ */
+#define LCD_BUSY_FLAG_TIMEOUT_POLLS                             1000
+
+#if ((LCD_FRAME_BUFFER_FEATURE != STD_ON) && (LCD_FRAME_BUFFER_FEATURE != STD_OFF))
+#warning "'LCD_FRAME_BUFFER_FEATURE' not configured in LCD_Config.h"
+#endif
+
+#if ((LCD_FRAME_BUFFER_ROWS < 1) || (LCD_FRAME_BUFFER_ROWS > 4))
+#error "'LCD_FRAME_BUFFER_ROWS' must be from 1 to 4 in LCD_Config.h"
+#endif
+
+#if ((LCD_FRAME_BUFFER_COLUMNS < 1) || ((LCD_FRAME_BUFFER_ROWS * LCD_FRAME_BUFFER_COLUMNS) > 160))
+#error "'LCD_FRAME_BUFFER_COLUMNS' must be at least 1, with at most 160 cells, in LCD_Config.h"
+#endif
+
+#if ((LCD_BUSY_FLAG_TIMEOUT_POLLS < 1) || (LCD_BUSY_FLAG_TIMEOUT_POLLS > 65535))
+#error "'LCD_BUSY_FLAG_TIMEOUT_POLLS' must be from 1 to 65535 in LCD_Config.h"
+#endif
+
+#endif /* _LCD_CONFIG_H_ */
@@ -1,8 +1,8 @@
 /**
  * @file ADC.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.2
- * @date 17.08.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #include "ADC_Private.h"
@@ -28,13 +28,36 @@ static Std_ReturnType ADC_InitChannelSource(ADC_ChannelTypeDef loc_channel);
 static Std_ReturnType ADC_InitAquisitionTimePeriod(ADC_AquisitionTimeTypeDef loc_aqt);
 static Std_ReturnType ADC_InitPrescalerValue(ADC_PrescalerTypeDef loc_prescaler);
 static Std_ReturnType ADC_InitAlignment(ADC_ResultAlignmentTypeDef loc_allignment);
+static ADC_ValueTypeDef ADC_ReadResult(const ADC_ResultAlignmentTypeDef loc_allignment);
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
 static void (*ADC_InterruptHandler)(void) = NULL_PTR;
 
 static Std_ReturnType ADC_InitInterruptHandler(void (*loc_interruptHandler)(void));
 static void ADC_DeInitInterruptHandler(void);
 
+    #if (ADC_SCAN_FEATURE == STD_ON)
+    static const ADC_ScanTypeDef *ADC_Scan = NULL_PTR;
+    static ADC_ResultAlignmentTypeDef ADC_ScanAlignment = ADC_ALIGN_RIGHT;
+    static ADC_ValueTypeDef ADC_ScanBuffers[2][ADC_SCAN_MAX_CHANNELS];
+    static volatile uint8 ADC_ScanFrontBuffer = 0;
+    static volatile uint8 ADC_ScanIndex = 0;
+    static volatile boolean ADC_ScanActive = FALSE;
+    static volatile boolean ADC_ScanResultsValid = FALSE;
+    #endif
+
+    #if (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+    static ADC_TriggerTimerTypeDef ADC_TriggerTimer = ADC_TRIGGER_TIMER1;
+    static ADC_ResultAlignmentTypeDef ADC_TriggerAlignment = ADC_ALIGN_RIGHT;
+    static volatile ADC_ValueTypeDef ADC_SampleBuffer[ADC_SAMPLE_BUFFER_SIZE];
+    static volatile uint8 ADC_SampleHead = 0;
+    static volatile uint8 ADC_SampleTail = 0;
+    static volatile uint16 ADC_SampleOverflowCounter = 0;
+    static volatile boolean ADC_TriggerActive = FALSE;
+
+    static void ADC_TriggerStopTimer(void);
+    #endif
+
     #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
     static Std_ReturnType ADC_InitPriority(INTERRUPTS_PriorityTypeDef);
     static void ADC_DeInitPriority(void);
@@ -59,7 +82,7 @@ Std_ReturnType ADC_Init(const ADC_InitTypeDef * const InitPtr)
 
         loc_ret |= ADC_InitAlignment(InitPtr->ResultAlignment);
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
         INTI_ADC_EnableInterrupt();
         loc_ret |= ADC_InitInterruptHandler(InitPtr->InterruptHandler);
 
@@ -96,7 +119,7 @@ Std_ReturnType ADC_DeInit(const ADC_InitTypeDef * const InitPtr)
             loc_ret |= GPIO_DeInitChannel(&ADC_Channelx);
         }
 
-    #if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
+    #if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
         INTI_ADC_DisableInterrupt();
         ADC_DeInitInterruptHandler();
 
@@ -117,16 +140,31 @@ Std_ReturnType ADC_StartConversion(const ADC_ChannelTypeDef Channel)
 {
     Std_ReturnType loc_ret = E_OK;
 
-    loc_ret = ADC_InitChannelSource(Channel);
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_SCAN_FEATURE == STD_ON)
+    if (TRUE == ADC_ScanActive)
+    {
+        loc_ret = E_NOT_OK;
+    }
+    else
+#endif
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+    if (TRUE == ADC_TriggerActive)
+    {
+        loc_ret = E_NOT_OK;
+    }
+    else
+#endif
+    {
+        loc_ret = ADC_InitChannelSource(Channel);
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
         INTI_ADC_ClearFlag();
 #endif
         ADC_StartConverting();
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_OFF)
+        /* Single conversions stay blocking in every configuration, only the scan and trigger paths are asynchronous */
         while (ADC_isConverting());
-#endif
+    }
 
     return loc_ret;
 }
@@ -135,20 +173,168 @@ Std_ReturnType ADC_Read(const ADC_InitTypeDef * const InitPtr, ADC_ValueTypeDef
 {
     Std_ReturnType loc_ret = E_OK;
 
-    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr))
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr) && ((ADC_ALIGN_LEFT == InitPtr->ResultAlignment) || (ADC_ALIGN_RIGHT == InitPtr->ResultAlignment)))
+    {
+        *DataBufferPtr = ADC_ReadResult(InitPtr->ResultAlignment);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_SCAN_FEATURE == STD_ON)
+Std_ReturnType ADC_StartScan(const ADC_InitTypeDef * const InitPtr, const ADC_ScanTypeDef * const ScanPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != ScanPtr) && (NULL_PTR != ScanPtr->Channels) &&
+        (ScanPtr->NumberOfChannels > 0) && (ScanPtr->NumberOfChannels <= ADC_SCAN_MAX_CHANNELS) &&
+        (ScanPtr->Mode < ADC_SCAN_MODE_LIMIT) && (FALSE == ADC_ScanActive) && (FALSE == ADC_isConverting())
+    #if (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+        && (FALSE == ADC_TriggerActive)
+    #endif
+        )
+    {
+        INTI_ADC_DisableInterrupt();
+
+        /* The pins are configured once here instead of before every sample */
+        for (loc_index = 0; (loc_index < ScanPtr->NumberOfChannels) && (E_OK == loc_ret); loc_index++)
+        {
+            loc_ret = ADC_InitChannelSource(ScanPtr->Channels[loc_index]);
+        }
+
+        if (E_OK == loc_ret)
+        {
+            ADC_Scan = ScanPtr;
+            ADC_ScanAlignment = InitPtr->ResultAlignment;
+            ADC_ScanIndex = 0;
+            ADC_ScanResultsValid = FALSE;
+            ADC_ScanActive = TRUE;
+
+            ADC_SelectChannel(ScanPtr->Channels[0]);
+            INTI_ADC_ClearFlag();
+            ADC_StartConverting();
+        }
+
+        INTI_ADC_EnableInterrupt();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType ADC_StopScan(void)
+{
+    INTI_ADC_DisableInterrupt();
+
+    ADC_ScanActive = FALSE;
+    ADC_StopConverting();
+    INTI_ADC_ClearFlag();
+
+    INTI_ADC_EnableInterrupt();
+
+    return E_OK;
+}
+
+Std_ReturnType ADC_GetScanResults(ADC_ValueTypeDef * const DataBufferPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != DataBufferPtr) && (TRUE == ADC_ScanResultsValid))
+    {
+        /* Masking ADIE keeps the buffers from being swapped during the copy */
+        INTI_ADC_DisableInterrupt();
+
+        for (loc_index = 0; loc_index < ADC_Scan->NumberOfChannels; loc_index++)
+        {
+            DataBufferPtr[loc_index] = ADC_ScanBuffers[ADC_ScanFrontBuffer][loc_index];
+        }
+
+        INTI_ADC_EnableInterrupt();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+Std_ReturnType ADC_StartTriggeredSampling(const ADC_InitTypeDef * const InitPtr, const ADC_TriggerTypeDef * const TriggerPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint32 loc_cycles = 0;
+    uint32 loc_ticks = 0;
+    uint8 loc_prescaler = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != TriggerPtr) && (TriggerPtr->Timer < ADC_TRIGGER_TIMER_LIMIT) &&
+        (ADC_TRIGGER_TIME_BASE_TIMER != TriggerPtr->Timer) && (TriggerPtr->SampleRate > 0) && (FALSE == ADC_TriggerActive) && (FALSE == ADC_isConverting())
+    #if (ADC_SCAN_FEATURE == STD_ON)
+        && (FALSE == ADC_ScanActive)
+    #endif
+        )
     {
-        switch (InitPtr->ResultAlignment)
+        /* Instruction cycles per sample, then the smallest prescaler (1, 2, 4, 8) that fits them in 16 bits */
+        loc_cycles = ((uint32)(FOSC / 4UL) + (TriggerPtr->SampleRate / 2UL)) / TriggerPtr->SampleRate;
+        loc_ticks = loc_cycles;
+
+        while ((loc_prescaler < ADC_TRIGGER_MAX_PRESCALER) && (loc_ticks > 0x10000UL))
         {
-            case ADC_ALIGN_LEFT:
-                *DataBufferPtr = (ADC_ValueTypeDef)(((ADC_ResultHighRegister & 0xC0) << 2) | (ADC_ResultHighRegister << 2) | (ADC_ResultLowRegister >> 6));
-                break;
+            loc_prescaler++;
+            loc_ticks = (loc_cycles + (1UL << (loc_prescaler - 1))) >> loc_prescaler;
+        }
 
-            case ADC_ALIGN_RIGHT:
-                *DataBufferPtr = (ADC_ValueTypeDef)((ADC_ResultHighRegister << 8) | ADC_ResultLowRegister);
-                break;
+        if ((loc_ticks < 2UL) || (loc_ticks > 0x10000UL))
+        {
+            loc_ret = E_NOT_OK;
+        }
+        else
+        {
+            loc_ret = ADC_InitChannelSource(TriggerPtr->Channel);
+        }
 
-            default: 
-                loc_ret = E_NOT_OK;
+        if (E_OK == loc_ret)
+        {
+            INTI_ADC_DisableInterrupt();
+
+            ADC_TriggerDisable();
+
+            ADC_TriggerTimer = TriggerPtr->Timer;
+            ADC_TriggerAlignment = InitPtr->ResultAlignment;
+            ADC_SampleHead = 0;
+            ADC_SampleTail = 0;
+            ADC_SampleOverflowCounter = 0;
+            ADC_TriggerActive = TRUE;
+
+            /* The special event resets the timer on the tick after the match, hence the - 1 */
+            ADC_TriggerCompareHigh = (uint8)((loc_ticks - 1UL) >> 8);
+            ADC_TriggerCompareLow = (uint8)(loc_ticks - 1UL);
+
+            INTI_ADC_ClearFlag();
+            INTI_ADC_EnableInterrupt();
+
+            ADC_TriggerEnable();
+
+            if (ADC_TRIGGER_TIMER1 == TriggerPtr->Timer)
+            {
+                ADC_TriggerSelectTimer1();
+                ADC_TriggerTimer1Start(loc_prescaler);
+            }
+            else
+            {
+                ADC_TriggerSelectTimer3();
+                ADC_TriggerTimer3Start(loc_prescaler);
+            }
         }
     }
     else
@@ -159,6 +345,82 @@ Std_ReturnType ADC_Read(const ADC_InitTypeDef * const InitPtr, ADC_ValueTypeDef
     return loc_ret;
 }
 
+Std_ReturnType ADC_StopTriggeredSampling(void)
+{
+    INTI_ADC_DisableInterrupt();
+
+    if (TRUE == ADC_TriggerActive)
+    {
+        ADC_TriggerDisable();
+        ADC_TriggerStopTimer();
+        ADC_TriggerActive = FALSE;
+
+        ADC_StopConverting();
+        INTI_ADC_ClearFlag();
+    }
+
+    INTI_ADC_EnableInterrupt();
+
+    return E_OK;
+}
+
+Std_ReturnType ADC_ReadSample(ADC_ValueTypeDef * const DataBufferPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != DataBufferPtr) && (ADC_SampleHead != ADC_SampleTail))
+    {
+        /* Only ADC_ISR moves the head, only this function moves the tail */
+        *DataBufferPtr = ADC_SampleBuffer[ADC_SampleTail & (ADC_SAMPLE_BUFFER_SIZE - 1)];
+        ADC_SampleTail++;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType ADC_GetSamplesAvailable(uint8 * const AvailablePtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != AvailablePtr)
+    {
+        *AvailablePtr = (uint8)(ADC_SampleHead - ADC_SampleTail);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType ADC_GetSampleOverflowCounter(uint16 * const OverflowPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != OverflowPtr)
+    {
+        /* The 16-bit counter is not read atomically, ADIE is masked meanwhile */
+        INTI_ADC_DisableInterrupt();
+
+        *OverflowPtr = ADC_SampleOverflowCounter;
+        ADC_SampleOverflowCounter = 0;
+
+        INTI_ADC_EnableInterrupt();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
 static Std_ReturnType ADC_InitAnalogDigitalChannels(ADC_ChannelConfigTypeDef loc_channelConfig)
 {
     Std_ReturnType loc_ret = E_OK;
@@ -262,21 +524,29 @@ static Std_ReturnType ADC_InitAlignment(ADC_ResultAlignmentTypeDef loc_allignmen
     return loc_ret;
 }
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
-static Std_ReturnType ADC_InitInterruptHandler(void (*loc_interruptHandler)(void))
+static ADC_ValueTypeDef ADC_ReadResult(const ADC_ResultAlignmentTypeDef loc_allignment)
 {
-    Std_ReturnType loc_ret = E_OK;
+    ADC_ValueTypeDef loc_value = 0;
 
-    if (NULL_PTR != loc_interruptHandler)
+    if (ADC_ALIGN_RIGHT == loc_allignment)
     {
-        ADC_InterruptHandler = loc_interruptHandler;
+        loc_value = (ADC_ValueTypeDef)((ADC_ResultHighRegister << 8) | ADC_ResultLowRegister);
     }
     else
     {
-        loc_ret = E_NOT_OK;
+        loc_value = (ADC_ValueTypeDef)((ADC_ResultHighRegister << 2) | (ADC_ResultLowRegister >> 6));
     }
 
-    return loc_ret;
+    return loc_value;
+}
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
+static Std_ReturnType ADC_InitInterruptHandler(void (*loc_interruptHandler)(void))
+{
+    /* A NULL handler is allowed, e.g. when the ADC is only used by the scan sequencer */
+    ADC_InterruptHandler = loc_interruptHandler;
+
+    return E_OK;
 }
 
 static void ADC_DeInitInterruptHandler(void)
@@ -306,10 +576,73 @@ static void ADC_DeInitInterruptHandler(void)
     }
     #endif
 
+    #if (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+    static void ADC_TriggerStopTimer(void)
+    {
+        if (ADC_TRIGGER_TIMER1 == ADC_TriggerTimer)
+        {
+            ADC_TriggerTimer1Stop();
+        }
+        else
+        {
+            ADC_TriggerTimer3Stop();
+        }
+    }
+    #endif
+
 void ADC_ISR(void)
 {
     INTI_ADC_ClearFlag();
 
+    #if (ADC_SCAN_FEATURE == STD_ON)
+    if (TRUE == ADC_ScanActive)
+    {
+        /* The back buffer is the one not read by ADC_GetScanResults() */
+        ADC_ScanBuffers[ADC_ScanFrontBuffer ^ 1][ADC_ScanIndex] = ADC_ReadResult(ADC_ScanAlignment);
+        ADC_ScanIndex++;
+
+        if (ADC_ScanIndex >= ADC_Scan->NumberOfChannels)
+        {
+            ADC_ScanIndex = 0;
+            ADC_ScanFrontBuffer ^= 1;
+            ADC_ScanResultsValid = TRUE;
+
+            if (ADC_SCAN_SINGLE == ADC_Scan->Mode)
+            {
+                ADC_ScanActive = FALSE;
+            }
+        }
+
+        if (TRUE == ADC_ScanActive)
+        {
+            /* The acquisition time runs between the channel switch and the conversion start (ACQT) */
+            ADC_SelectChannel(ADC_Scan->Channels[ADC_ScanIndex]);
+            ADC_StartConverting();
+        }
+
+        if ((0 == ADC_ScanIndex) && (NULL_PTR != ADC_Scan->ScanCompleteHandler))
+        {
+            ADC_Scan->ScanCompleteHandler();
+        }
+    }
+    else
+    #endif
+    #if (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+    if (TRUE == ADC_TriggerActive)
+    {
+        /* The next conversion is started by the CCP2 special event, not from here */
+        if ((uint8)(ADC_SampleHead - ADC_SampleTail) < ADC_SAMPLE_BUFFER_SIZE)
+        {
+            ADC_SampleBuffer[ADC_SampleHead & (ADC_SAMPLE_BUFFER_SIZE - 1)] = ADC_ReadResult(ADC_TriggerAlignment);
+            ADC_SampleHead++;
+        }
+        else
+        {
+            ADC_SampleOverflowCounter++;
+        }
+    }
+    else
+    #endif
     if (NULL_PTR != ADC_InterruptHandler)
     {
         ADC_InterruptHandler();
@@ -15,14 +15,15 @@
  * @note The ADC interface promotes efficient analog data processing and can be utilized across different
  *       microcontroller families and development environments.
  * 
- * @version 0.2
- * @date 17.08.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #ifndef _ADC_H_
 #define _ADC_H_
 
 #include "../Interrupts/Interrupts.h"
+#include "ADC_Config.h"
 
 typedef enum
 {
@@ -113,7 +114,7 @@ typedef struct
     ADC_PrescalerTypeDef Prescaler;
     ADC_ResultAlignmentTypeDef ResultAlignment;
 
-#if (INTERRUPTS_ADC_INTERRUPTS_FEAUTURE == STD_ON)
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
     void (*InterruptHandler)(void);
 
     #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
@@ -125,6 +126,43 @@ typedef struct
 
 typedef uint16 ADC_ValueTypeDef;
 
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_SCAN_FEATURE == STD_ON)
+typedef enum
+{
+    ADC_SCAN_SINGLE = 0,
+    ADC_SCAN_CONTINUOUS,
+    ADC_SCAN_MODE_LIMIT
+
+} ADC_ScanModeTypeDef;
+
+typedef struct
+{
+    const ADC_ChannelTypeDef *Channels;
+    uint8 NumberOfChannels;
+    ADC_ScanModeTypeDef Mode;
+    void (*ScanCompleteHandler)(void);
+
+} ADC_ScanTypeDef;
+#endif
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+typedef enum
+{
+    ADC_TRIGGER_TIMER1 = 0,
+    ADC_TRIGGER_TIMER3,
+    ADC_TRIGGER_TIMER_LIMIT
+
+} ADC_TriggerTimerTypeDef;
+
+typedef struct
+{
+    ADC_ChannelTypeDef Channel;
+    ADC_TriggerTimerTypeDef Timer;
+    uint32 SampleRate;
+
+} ADC_TriggerTypeDef;
+#endif
+
 /**
  * @brief Initialize the Analog-to-Digital Converter (ADC) module.
  *
@@ -165,14 +203,15 @@ Std_ReturnType ADC_DeInit(const ADC_InitTypeDef * const InitPtr);
  * @param Channel The ADC channel identifier where the conversion will be performed.
  * @return Std_ReturnType Error status indicating the success of starting the conversion.
  *     - E_OK: The ADC conversion was started successfully.
- *     - E_NOT_OK: An error occurred while trying to start the conversion (e.g., invalid channel).
+ *     - E_NOT_OK: An error occurred while trying to start the conversion (e.g., invalid channel, or a scan or
+ *                 triggered sampling in progress).
  *
  * @note Before calling this function, the ADC module should be initialized using the ADC_Init function.
  * @note The @param Channel parameter should correspond to a valid ADC channel identifier.
  * 
- * @note If the ADC interrupts are disabled, the function enters a blocking state until the conversion is done and
- *       the user should read the results using ADC_Read after calling this function.
- *       However if the ADC interrupts are enabled then the user should use ADC_Read in the ADC's interrupt handler.
+ * @note The function blocks until the conversion is done, the user should read the result using ADC_Read after
+ *       calling it. If the ADC interrupts are enabled the interrupt handler is also called once the conversion is
+ *       done. Non-blocking conversions are provided by the scan and triggered sampling interfaces.
  */
 Std_ReturnType ADC_StartConversion(const ADC_ChannelTypeDef Channel);
 
@@ -196,4 +235,114 @@ Std_ReturnType ADC_StartConversion(const ADC_ChannelTypeDef Channel);
  */
 Std_ReturnType ADC_Read(const ADC_InitTypeDef * const InitPtr, ADC_ValueTypeDef * const DataBufferPtr);
 
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_SCAN_FEATURE == STD_ON)
+/**
+ * @brief Start a scan of a list of ADC channels.
+ *
+ * The channels of @param ScanPtr are converted back-to-back in list order from ADC_ISR, without blocking. The pins
+ * are configured as inputs once, here, and the acquisition time is inserted by the hardware (ACQT) between the
+ * channel switch and the conversion. Completed scans are written to the back buffer of a double buffer, which then
+ * becomes the front buffer read by ADC_GetScanResults(), and the ScanCompleteHandler is called from ADC_ISR.
+ * In ADC_SCAN_CONTINUOUS mode the next scan starts right away, in ADC_SCAN_SINGLE mode the sequencer stops.
+ *
+ * @param InitPtr Pointer to the ADC initialization structure the ADC was initialized with.
+ * @param ScanPtr Pointer to the scan, it must stay valid until the scan is stopped.
+ * @return Std_ReturnType Error status indicating the success of starting the scan.
+ *     - E_OK: The scan was started successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL pointers, no channels, more than ADC_SCAN_MAX_CHANNELS channels,
+ *                 invalid channel, a scan already running or a conversion in progress).
+ *
+ * @note The ADC must be initialized with an acquisition time other than ADC_AQT_0TAD.
+ * @note The global and peripheral interrupts must be enabled.
+ */
+Std_ReturnType ADC_StartScan(const ADC_InitTypeDef * const InitPtr, const ADC_ScanTypeDef * const ScanPtr);
+
+/**
+ * @brief Stop the scan sequencer, the conversion in progress is discarded.
+ *
+ * @return Std_ReturnType Error status indicating the success of stopping the scan.
+ *     - E_OK: The scan was stopped successfully.
+ */
+Std_ReturnType ADC_StopScan(void);
+
+/**
+ * @brief Copy the results of the last completed scan.
+ *
+ * The front buffer is copied with the ADC interrupt masked, so the copy is a consistent snapshot of a single scan
+ * even when a scan completes meanwhile.
+ *
+ * @param DataBufferPtr Pointer to an array of at least NumberOfChannels values, in scan list order.
+ * @return Std_ReturnType Error status indicating the success of reading the results.
+ *     - E_OK: The results were copied successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param DataBufferPtr or no scan completed yet).
+ */
+Std_ReturnType ADC_GetScanResults(ADC_ValueTypeDef * const DataBufferPtr);
+#endif
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON) && (ADC_TRIGGERED_SAMPLING_FEATURE == STD_ON)
+/**
+ * @brief Start sampling a channel at a fixed rate, triggered by the hardware.
+ *
+ * CCP2 is put in compare mode with the trigger special event on match, using TIMER1 or TIMER3 as its time base.
+ * Each match resets the timer and starts a conversion in hardware, so the sample clock does not depend on the
+ * interrupt or main loop latency. The smallest timer prescaler that fits the period in 16 bits is used, giving a
+ * period of (CCPR2 + 1) * Prescaler instruction cycles. Each result is pushed into a ring buffer of
+ * ADC_SAMPLE_BUFFER_SIZE samples from ADC_ISR, read with ADC_ReadSample().
+ *
+ * @param InitPtr Pointer to the ADC initialization structure the ADC was initialized with.
+ * @param TriggerPtr Pointer to the channel, time base and sample rate (Hz) to use.
+ * @return Std_ReturnType Error status indicating the success of starting the sampling.
+ *     - E_OK: The sampling was started successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL pointers, invalid channel or timer, the timer of the TIME time
+ *                 base, a sample rate out of the FOSC / 4 / 524288 to FOSC / 8 range, sampling already running,
+ *                 a scan or a conversion in progress).
+ *
+ * @note CCP2 and the selected timer are reserved until ADC_StopTriggeredSampling() is called, selecting TIMER1
+ *       also gives TIMER1 to CCP1.
+ * @note The timer selected by TIME_TIMER in TIME_Config.h runs the TIME time base and is rejected, each match
+ *       would reset it. With the default TIME_TIMER1 only ADC_TRIGGER_TIMER3 is accepted.
+ * @note The period must be longer than the acquisition and conversion time, or triggers are lost.
+ * @note The global and peripheral interrupts must be enabled.
+ */
+Std_ReturnType ADC_StartTriggeredSampling(const ADC_InitTypeDef * const InitPtr, const ADC_TriggerTypeDef * const TriggerPtr);
+
+/**
+ * @brief Stop the triggered sampling, the samples already buffered can still be read.
+ *
+ * @return Std_ReturnType Error status indicating the success of stopping the sampling.
+ *     - E_OK: The sampling was stopped successfully.
+ */
+Std_ReturnType ADC_StopTriggeredSampling(void);
+
+/**
+ * @brief Pop the oldest sample from the triggered sampling ring buffer, without blocking.
+ *
+ * @param DataBufferPtr Pointer to the memory location where the sample will be stored.
+ * @return Std_ReturnType Error status indicating the success of the read operation.
+ *     - E_OK: A sample was read successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param DataBufferPtr or no sample available).
+ */
+Std_ReturnType ADC_ReadSample(ADC_ValueTypeDef * const DataBufferPtr);
+
+/**
+ * @brief Get the number of samples waiting in the triggered sampling ring buffer.
+ *
+ * @param AvailablePtr Pointer to the memory location where the number of samples will be stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The number of samples was stored successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param AvailablePtr).
+ */
+Std_ReturnType ADC_GetSamplesAvailable(uint8 * const AvailablePtr);
+
+/**
+ * @brief Read and clear the number of samples dropped because the ring buffer was full.
+ *
+ * @param OverflowPtr Pointer to the memory location where the counter will be stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The counter was read and cleared successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param OverflowPtr).
+ */
+Std_ReturnType ADC_GetSampleOverflowCounter(uint16 * const OverflowPtr);
+#endif
+
 #endif /* _ADC_H_ */
\ No newline at end of file
@@ -0,0 +1,58 @@
+/**
+ * @file ADC_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief ADC Configuration Interface
+ *
+ * The `ADC_Config.h` header file offers a centralized location to configure the optional services of the ADC
+ * module, such as the interrupt-driven scan sequencer and the hardware-triggered sampling.
+ * 
+ * @version 0.2
+ * @date 18.10.26
+ */
+
+#ifndef _ADC_CONFIG_H_
+#define _ADC_CONFIG_H_
+
+/**
+ * @def ADC_SCAN_FEATURE
+ * @brief Control macro to enable or disable the scan sequencer, requires INTERRUPTS_ADC_INTERRUPTS_FEATURE.
+ *     - STD_ON: Include the scan sequencer in the build.
+ *     - STD_OFF: Exclude the scan sequencer from the build.
+ */
+#define ADC_SCAN_FEATURE                                        STD_ON
+
+/**
+ * @def ADC_SCAN_MAX_CHANNELS
+ * @brief Maximum number of conversions of a scan, sizes both result buffers.
+ */
+#define ADC_SCAN_MAX_CHANNELS                                   13
+
+/**
+ * @def ADC_TRIGGERED_SAMPLING_FEATURE
+ * @brief Control macro to enable or disable the fixed-rate sampling triggered by the CCP2 special event,
+ *        requires INTERRUPTS_ADC_INTERRUPTS_FEATURE.
+ *     - STD_ON: Include the triggered sampling in the build, CCP2 is reserved while sampling.
+ *     - STD_OFF: Exclude the triggered sampling from the build.
+ */
+#define ADC_TRIGGERED_SAMPLING_FEATURE                          STD_ON
+
+/**
+ * @def ADC_SAMPLE_BUFFER_SIZE
+ * @brief Number of samples of the triggered sampling ring buffer, a power of two from 2 to 128.
+ */
+#define ADC_SAMPLE_BUFFER_SIZE                                  32
+
+#if ((ADC_SCAN_FEATURE != STD_ON) && (ADC_SCAN_FEATURE != STD_OFF))
+#warning "'ADC_SCAN_FEATURE' not configured in ADC_Config.h"
+#endif
+
+#if ((ADC_TRIGGERED_SAMPLING_FEATURE != STD_ON) && (ADC_TRIGGERED_SAMPLING_FEATURE != STD_OFF))
+#warning "'ADC_TRIGGERED_SAMPLING_FEATURE' not configured in ADC_Config.h"
+#endif
+
+#if ((ADC_SAMPLE_BUFFER_SIZE < 2) || (ADC_SAMPLE_BUFFER_SIZE > 128) || ((ADC_SAMPLE_BUFFER_SIZE & (ADC_SAMPLE_BUFFER_SIZE - 1)) != 0))
+#error "'ADC_SAMPLE_BUFFER_SIZE' must be a power of two from 2 to 128 in ADC_Config.h"
+#endif
+
+#endif /* _ADC_CONFIG_H_ */
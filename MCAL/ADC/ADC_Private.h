@@ -15,14 +15,16 @@
  * @note The `ADC_Private.h` interface improves code organization and maintainability by isolating internal
  *       ADC-related operations from the main public interface.
  * 
- * @version 0.1
- * @date 17.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _ADC_PRIVATE_H_
 #define _ADC_PRIVATE_H_
 
 #include "../mcu_registers.h"
+#include "../mcu_config.h"
+#include "../Timers/TIME/TIME_Config.h"
 
 #define ADC_CHANNEL_PIN                                         0
 #define ADC_CHANNEL_PORT                                        1
@@ -31,6 +33,7 @@
 #define ADC_Disable()                                           (ADCON0bits.ADON = 0)
 
 #define ADC_StartConverting()                                   (ADCON0bits.GO_nDONE = 1)
+#define ADC_StopConverting()                                    (ADCON0bits.GO_nDONE = 0)
 #define ADC_isConverting()                                      (1 == ADCON0bits.GO_nDONE)
 
 #define ADC_SelectChannel(Channel)                              (ADCON0bits.CHS = Channel)    
@@ -43,4 +46,47 @@
 #define ADC_ResultHighRegister                                  (ADRESH)
 #define ADC_ResultLowRegister                                   (ADRESL)
 
+/* Triggered sampling: CCP2 in compare mode, trigger special event on match (CCP2M = 0b1011) */
+#define ADC_TRIGGER_SPECIAL_EVENT_MODE                          0x0B
+#define ADC_TRIGGER_MAX_PRESCALER                               3
+
+/* The special event resets its timer on every match, the timer of the TIME time base cannot be used */
+#if (TIME_TIMER == TIME_TIMER1)
+#define ADC_TRIGGER_TIME_BASE_TIMER                             ADC_TRIGGER_TIMER1
+#else
+#define ADC_TRIGGER_TIME_BASE_TIMER                             ADC_TRIGGER_TIMER3
+#endif
+
+#define ADC_TriggerDisable()                                    (CCP2CONbits.CCP2M = 0)
+#define ADC_TriggerEnable()                                     (CCP2CONbits.CCP2M = ADC_TRIGGER_SPECIAL_EVENT_MODE)
+#define ADC_TriggerCompareLow                                   (CCPR2L)
+#define ADC_TriggerCompareHigh                                  (CCPR2H)
+
+/* T3CCP2:T3CCP1 = 00 gives TIMER1 to CCP2, 01 gives it TIMER3 and leaves TIMER1 to CCP1 */
+#define ADC_TriggerSelectTimer1()                               do {\
+                                                                    T3CONbits.T3CCP2 = 0;\
+                                                                    T3CONbits.T3CCP1 = 0;\
+                                                                } while (0)
+#define ADC_TriggerSelectTimer3()                               do {\
+                                                                    T3CONbits.T3CCP2 = 0;\
+                                                                    T3CONbits.T3CCP1 = 1;\
+                                                                } while (0)
+
+#define ADC_TriggerTimer1Stop()                                 (T1CONbits.TMR1ON = 0)
+#define ADC_TriggerTimer1Start(Prescaler)                       do {\
+                                                                    T1CONbits.TMR1CS = 0;\
+                                                                    T1CONbits.T1CKPS = (Prescaler);\
+                                                                    TMR1H = 0;\
+                                                                    TMR1L = 0;\
+                                                                    T1CONbits.TMR1ON = 1;\
+                                                                } while (0)
+#define ADC_TriggerTimer3Stop()                                 (T3CONbits.TMR3ON = 0)
+#define ADC_TriggerTimer3Start(Prescaler)                       do {\
+                                                                    T3CONbits.TMR3CS = 0;\
+                                                                    T3CONbits.T3CKPS = (Prescaler);\
+                                                                    TMR3H = 0;\
+                                                                    TMR3L = 0;\
+                                                                    T3CONbits.TMR3ON = 1;\
+                                                                } while (0)
+
 #endif /* _ADC_PRIVATE_H_ */
\ No newline at end of file
@@ -1,8 +1,8 @@
 /**
  * @file CCP1.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 10.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "../CCPx_Private.h"
@@ -20,6 +20,38 @@ static void CCP1_DeInitInterruptHandler(void);
     #endif
 #endif
 
+#if (CCP1_MODE == CCP1_PWM_MODE)
+static void CCP1_PWM_WriteDutyCycle(const uint16 loc_DutyCycleValue);
+#endif
+
+#if ((CCP1_MODE == CCP1_CAPTURE_MODE) && (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON))
+#if (INTERRUPTS_CCP1_INTERRUPTS_FEATURE != STD_ON)
+#error "'CCP1_CAPTURE_ENGINE_FEATURE' requires 'INTERRUPTS_CCP1_INTERRUPTS_FEATURE' in Interrupts_Config.h"
+#endif
+
+#if (TIME_TICKS_PER_SECOND > (0xFFFFFFFFUL / 1000UL))
+#error "'CCP1_CAPTURE_ENGINE_FEATURE' needs fewer than 4294967 TIME ticks per second for the frequency in mHz"
+#endif
+
+static CCPx_CaptureEngineTypeDef CCP1_Capture;
+
+static void CCP1_CaptureEdge(void);
+static void CCP1_CapturePush(CCPx_CaptureWindowTypeDef * const loc_window, const uint32 loc_sample);
+static Std_ReturnType CCP1_CaptureAverage(const CCPx_CaptureWindowTypeDef * const loc_window, const uint8 loc_edges,
+                                          uint32 * const loc_average);
+#endif
+
+#if ((CCP1_MODE == CCP1_COMPARE_MODE) && (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON))
+#if (INTERRUPTS_CCP1_INTERRUPTS_FEATURE != STD_ON)
+#error "'CCP1_COMPARE_SCHEDULER_FEATURE' requires 'INTERRUPTS_CCP1_INTERRUPTS_FEATURE' in Interrupts_Config.h"
+#endif
+
+static CCPx_SchedulerTypeDef CCP1_Scheduler;
+
+static void CCP1_SchedulerMatch(void);
+static void CCP1_SchedulerArm(void);
+#endif
+
 Std_ReturnType CCP1_Init(const CCP1_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
@@ -114,6 +146,205 @@ Std_ReturnType CCP1_ReadCapture(const CCP1_InitTypeDef * const InitPtr, uint16 *
     return loc_ret;    
 }
 
+#if (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON)
+Std_ReturnType CCP1_Capture_Start(const CCP1_InitTypeDef * const InitPtr, const CCP1_CaptureMeasurementTypeDef Measurement)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (Measurement < CCP1_CAPTURE_MEASUREMENT_LIMIT) &&
+        (__CCP1_UsesTimeBase(InitPtr->CCPxTIMERx)))
+    {
+        INTI_CCP1_DisableInterrupt();
+
+        CCP1_Capture.Periods.Sum = 0;
+        CCP1_Capture.Periods.Index = 0;
+        CCP1_Capture.Periods.Count = 0;
+        CCP1_Capture.PulseWidths.Sum = 0;
+        CCP1_Capture.PulseWidths.Index = 0;
+        CCP1_Capture.PulseWidths.Count = 0;
+        CCP1_Capture.Measurement = Measurement;
+        CCP1_Capture.Started = FALSE;
+
+        if (CCP1_CAPTURE_PULSE_WIDTH == Measurement)
+        {
+            CCP1_Capture.Edges = 1;
+            __CCP1_ConfigMode(CPP1_MODE_CAPTURE_EVERY_RISING_EDGE);
+        }
+        else
+        {
+            CCP1_Capture.Edges = __CCPx_CaptureEdges(InitPtr->Mode);
+            __CCP1_ConfigMode(InitPtr->Mode);
+        }
+
+        CCP1_Capture.Running = TRUE;
+
+        // Changing the capture mode may set a false capture flag.
+        INTI_CCP1_ClearFlag();
+        INTI_CCP1_EnableInterrupt();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Capture_Stop(const CCP1_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != InitPtr)
+    {
+        INTI_CCP1_DisableInterrupt();
+
+        CCP1_Capture.Running = FALSE;
+        __CCP1_Disable();
+
+        // A capture latched before the module was turned off must not fire once the interrupt is enabled again.
+        INTI_CCP1_ClearFlag();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Capture_GetPeriod(const CCP1_InitTypeDef * const InitPtr, uint32 * const Period_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != Period_ret))
+    {
+        loc_ret = CCP1_CaptureAverage(&CCP1_Capture.Periods, CCP1_Capture.Edges, Period_ret);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Capture_GetFrequency(const CCP1_InitTypeDef * const InitPtr, uint32 * const Frequency_mHz_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint32 loc_period = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != Frequency_mHz_ret))
+    {
+        loc_ret = CCP1_CaptureAverage(&CCP1_Capture.Periods, CCP1_Capture.Edges, &loc_period);
+
+        if ((E_OK == loc_ret) && (0 != loc_period))
+        {
+            *Frequency_mHz_ret = (TIME_TICKS_PER_SECOND * 1000UL) / loc_period;
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Capture_GetPulseWidth(const CCP1_InitTypeDef * const InitPtr, uint32 * const PulseWidth_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != PulseWidth_ret))
+    {
+        loc_ret = CCP1_CaptureAverage(&CCP1_Capture.PulseWidths, 1, PulseWidth_ret);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+static void CCP1_CaptureEdge(void)
+{
+    uint8 loc_low = (uint8)__CCP1_RegisterLow();
+    uint32 loc_timestamp = TIME_ExtendTicks((uint16)((uint16)(__CCP1_RegisterHigh() << 8) | loc_low));
+
+    if ((CCP1_CAPTURE_PULSE_WIDTH == CCP1_Capture.Measurement) && (0 == __CCP1_CaptureEdgeIsRising()))
+    {
+        // Capturing starts on a rising edge, a falling edge always follows one.
+        CCP1_CapturePush(&CCP1_Capture.PulseWidths, loc_timestamp - CCP1_Capture.LastEdge);
+    }
+    else
+    {
+        if (TRUE == CCP1_Capture.Started)
+        {
+            CCP1_CapturePush(&CCP1_Capture.Periods, loc_timestamp - CCP1_Capture.LastEdge);
+        }
+
+        CCP1_Capture.LastEdge = loc_timestamp;
+        CCP1_Capture.Started = TRUE;
+    }
+
+    if (CCP1_CAPTURE_PULSE_WIDTH == CCP1_Capture.Measurement)
+    {
+        __CCP1_ToggleCaptureEdge();
+        __CCP1_ClearFlag();
+    }
+}
+
+static void CCP1_CapturePush(CCPx_CaptureWindowTypeDef * const loc_window, const uint32 loc_sample)
+{
+    uint8 loc_slot = loc_window->Index & (CCPx_CAPTURE_WINDOW_SIZE - 1);
+
+    // A full window drops its oldest sample, the one about to be overwritten.
+    if (CCPx_CAPTURE_WINDOW_SIZE == loc_window->Count)
+    {
+        loc_window->Sum -= loc_window->Samples[loc_slot];
+    }
+    else
+    {
+        loc_window->Count++;
+    }
+
+    loc_window->Samples[loc_slot] = loc_sample;
+    loc_window->Sum += loc_sample;
+    loc_window->Index++;
+}
+
+static Std_ReturnType CCP1_CaptureAverage(const CCPx_CaptureWindowTypeDef * const loc_window, const uint8 loc_edges,
+                                          uint32 * const loc_average)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = __CCP1_InterruptStatus();
+    uint32 loc_sum = 0;
+    uint16 loc_count = 0;
+
+    __CCP1_SetInterruptStatus(0);
+
+    loc_sum = loc_window->Sum;
+    loc_count = (uint16)loc_window->Count * loc_edges;
+
+    __CCP1_SetInterruptStatus(loc_status);
+
+    if (0 != loc_count)
+    {
+        *loc_average = (loc_sum + (loc_count / 2)) / loc_count;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
 #elif (CCP1_MODE == CCP1_COMPARE_MODE)
 
 Std_ReturnType CCP1_WriteCompareValue(const CCP1_InitTypeDef * const InitPtr, const uint16 CompareValue)
@@ -133,19 +364,234 @@ Std_ReturnType CCP1_WriteCompareValue(const CCP1_InitTypeDef * const InitPtr, co
     return loc_ret;  
 }
 
+#if (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON)
+Std_ReturnType CCP1_Scheduler_Start(const CCP1_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (__CCP1_UsesTimeBase(InitPtr->CCPxTIMERx)))
+    {
+        INTI_CCP1_DisableInterrupt();
+
+        CCP1_Scheduler.Count = 0;
+        CCP1_Scheduler.Level = 0;
+        CCP1_Scheduler.Armed = FALSE;
+        CCP1_Scheduler.Running = TRUE;
+
+        // With the module off the pin follows its output latch.
+        __CCP1_WriteOutputLatch(0);
+        __CCP1_Disable();
+
+        INTI_CCP1_ClearFlag();
+        INTI_CCP1_EnableInterrupt();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Scheduler_Stop(const CCP1_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = 0;
+
+    if (NULL_PTR != InitPtr)
+    {
+        loc_status = __CCP1_InterruptStatus();
+        __CCP1_SetInterruptStatus(0);
+
+        CCP1_Scheduler.Running = FALSE;
+        CCP1_Scheduler.Count = 0;
+        CCP1_Scheduler.Armed = FALSE;
+        __CCP1_Disable();
+
+        __CCP1_SetInterruptStatus(loc_status);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Scheduler_AddEvent(const CCP1_InitTypeDef * const InitPtr, const uint32 Time,
+                                       const CCP1_EventActionTypeDef Action, void (* const Callback)(void))
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = __CCP1_InterruptStatus();
+    uint8 loc_index = 0;
+    uint8 loc_first = 0;
+    uint32 loc_now = 0;
+
+    __CCP1_SetInterruptStatus(0);
+
+    loc_now = TIME_GetTicks32();
+
+    if ((NULL_PTR != InitPtr) && (Action < CCP1_EVENT_LIMIT) && (TRUE == CCP1_Scheduler.Running) &&
+        (CCP1_Scheduler.Count < CCPx_SCHEDULER_QUEUE_SIZE) && ((sint32)(Time - loc_now) > 0))
+    {
+        // An armed event about to match, or matched already, can no longer be rescheduled behind a new one.
+        if ((TRUE == CCP1_Scheduler.Armed) &&
+            ((sint32)(CCP1_Scheduler.Events[0].Time - loc_now) <= (sint32)CCPx_SCHEDULER_MIN_LEAD_TICKS))
+        {
+            loc_first = 1;
+        }
+
+        for (loc_index = CCP1_Scheduler.Count;
+             (loc_index > loc_first) && ((sint32)(Time - CCP1_Scheduler.Events[loc_index - 1].Time) < 0);
+             loc_index--)
+        {
+            CCP1_Scheduler.Events[loc_index] = CCP1_Scheduler.Events[loc_index - 1];
+        }
+
+        CCP1_Scheduler.Events[loc_index].Time = Time;
+        CCP1_Scheduler.Events[loc_index].Callback = Callback;
+        CCP1_Scheduler.Events[loc_index].Action = (uint8)Action;
+        CCP1_Scheduler.Count++;
+
+        if (0 == loc_index)
+        {
+            CCP1_SchedulerArm();
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    __CCP1_SetInterruptStatus(loc_status);
+
+    return loc_ret;
+}
+
+Std_ReturnType CCP1_Scheduler_GetPendingEvents(const CCP1_InitTypeDef * const InitPtr, uint8 * const Pending_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != Pending_ret))
+    {
+        *Pending_ret = CCP1_Scheduler.Count;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+static void CCP1_SchedulerMatch(void)
+{
+    void (*loc_callback)(void) = NULL_PTR;
+    uint8 loc_index = 0;
+
+    if (TRUE == CCP1_Scheduler.Armed)
+    {
+        // The hardware has driven the pin, the output latch holds it once the compare mode changes.
+        CCP1_Scheduler.Level = CCP1_Scheduler.Target;
+        __CCP1_WriteOutputLatch(CCP1_Scheduler.Level);
+
+        loc_callback = CCP1_Scheduler.Events[0].Callback;
+        CCP1_Scheduler.Count--;
+
+        for (loc_index = 0; loc_index < CCP1_Scheduler.Count; loc_index++)
+        {
+            CCP1_Scheduler.Events[loc_index] = CCP1_Scheduler.Events[loc_index + 1];
+        }
+    }
+
+    CCP1_SchedulerArm();
+
+    if (NULL_PTR != loc_callback)
+    {
+        loc_callback();
+    }
+}
+
+/*
+ * Setting the pin high (low) on match drives it low (high) as soon as the mode is written, so these modes are only
+ * armed from the opposite level. Every other match uses the software interrupt mode, where the pin follows the
+ * output latch, and a toggle becomes a set high or low.
+ */
+static void CCP1_SchedulerArm(void)
+{
+    uint32 loc_now = TIME_GetTicks32();
+    uint32 loc_time = 0;
+    uint32 loc_distance = 0;
+    uint8 loc_mode = 0;
+
+    CCP1_Scheduler.Armed = FALSE;
+
+    if (0 != CCP1_Scheduler.Count)
+    {
+        loc_time = CCP1_Scheduler.Events[0].Time;
+        loc_distance = loc_time - loc_now;
+
+        if ((sint32)loc_distance < (sint32)CCPx_SCHEDULER_MIN_LEAD_TICKS)
+        {
+            loc_time = loc_now + CCPx_SCHEDULER_MIN_LEAD_TICKS;
+            loc_distance = CCPx_SCHEDULER_MIN_LEAD_TICKS;
+        }
+
+        loc_mode = CCP1_MODE_GENERATE_SW_INTERRUPT_ON_MATCH;
+
+        // Further than a timer period away, the match only brings the event closer.
+        if (loc_distance <= 0x10000UL)
+        {
+            switch (CCP1_Scheduler.Events[0].Action)
+            {
+                case CCP1_EVENT_SET_HIGH:
+                    CCP1_Scheduler.Target = 1;
+                    break;
+
+                case CCP1_EVENT_SET_LOW:
+                    CCP1_Scheduler.Target = 0;
+                    break;
+
+                case CCP1_EVENT_TOGGLE:
+                    CCP1_Scheduler.Target = CCP1_Scheduler.Level ^ 1;
+                    break;
+
+                default:
+                    CCP1_Scheduler.Target = CCP1_Scheduler.Level;
+            }
+
+            if (CCP1_Scheduler.Target != CCP1_Scheduler.Level)
+            {
+                loc_mode = (1 == CCP1_Scheduler.Target) ? CCP1_MODE_SET_PIN_HIGH_ON_MATCH : CCP1_MODE_SET_PIN_LOW_ON_MATCH;
+            }
+
+            CCP1_Scheduler.Armed = TRUE;
+        }
+
+        __CCP1_RegisterLow() = (uint8)(loc_time & 0xFF);
+        __CCP1_RegisterHigh() = (uint8)((loc_time >> 8) & 0xFF);
+    }
+
+    __CCP1_ConfigMode(loc_mode);
+}
+#endif
+
 #elif (CCP1_MODE == CCP1_PWM_MODE)
 
 Std_ReturnType CCP1_PWM_SetFrequency(const CCP1_InitTypeDef * const InitPtr, const uint32 Frequency)
 {
     Std_ReturnType loc_ret = E_OK;
 
+    TIMER2_PWMPeriodTypeDef loc_Period;
+
     if (NULL_PTR != InitPtr)
     {
-        uint8 loc_Timer2PrescalerValue = (TIMER2_NO_PRESCALER == InitPtr->TIMER2Ptr->Prescaler) ? (uint8)(1) : (uint8)(2 << InitPtr->TIMER2Ptr->Prescaler);
-        uint8 loc_Timer2PostscalerValue = InitPtr->TIMER2Ptr->Postscaler + 1;
-        uint8 loc_value = (uint8)(((uint32)FOSC / (uint32)(4 * Frequency * loc_Timer2PrescalerValue)) - 1);
-        
-        TIMER2_WriteCompareValue(InitPtr->TIMER2Ptr, loc_value);
+        loc_ret = TIMER2_SolvePWMPeriod(Frequency, &loc_Period);
+
+        if (E_OK == loc_ret)
+        {
+            loc_ret = TIMER2_ConfigPWMPeriod(InitPtr->TIMER2Ptr, &loc_Period);
+        }
     }
     else 
     {
@@ -158,14 +604,49 @@ Std_ReturnType CCP1_PWM_SetFrequency(const CCP1_InitTypeDef * const InitPtr, con
 Std_ReturnType CCP1_PWM_SetDutyCycle(const CCP1_InitTypeDef * const InitPtr, const uint8 DutyCycle)
 {
     Std_ReturnType loc_ret = E_OK;
+    uint16 loc_DutyCycleValue = 0;
 
     if ((NULL_PTR != InitPtr) && (DutyCycle <= 100))
     {
-        uint16 loc_DutyCycleValue = (uint16)(4 * (PR2 + 1) * (DutyCycle / 100.0));
+        loc_DutyCycleValue = (uint16)(((uint32)__CCPx_PWMPeriodCounts() * DutyCycle) / 100);
+
+        CCP1_PWM_WriteDutyCycle((loc_DutyCycleValue > CCPx_PWM_MAX_DUTY_COUNTS) ? CCPx_PWM_MAX_DUTY_COUNTS : loc_DutyCycleValue);
+    }
+    else 
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret; 
+}
+
+Std_ReturnType CCP1_PWM_SetDutyCycleRaw(const CCP1_InitTypeDef * const InitPtr, const uint16 DutyCycle)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (DutyCycle <= CCPx_PWM_MAX_DUTY_COUNTS))
+    {
+        CCP1_PWM_WriteDutyCycle(DutyCycle);
+    }
+    else 
+    {
+        loc_ret = E_NOT_OK;
+    }
 
-        __CCP1_SetDutyCycleLower2Bits(loc_DutyCycleValue & 0x03);
+    return loc_ret; 
+}
+
+Std_ReturnType CCP1_PWM_SetDutyCycleQ15(const CCP1_InitTypeDef * const InitPtr, const uint16 DutyCycle)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_DutyCycleValue = 0;
 
-        __CCP1_RegisterLow() = (uint8)(loc_DutyCycleValue >> 2);
+    if ((NULL_PTR != InitPtr) && (DutyCycle <= CCP1_PWM_DUTY_CYCLE_Q15_ONE))
+    {
+        loc_DutyCycleValue = (uint16)(((uint32)__CCPx_PWMPeriodCounts() * DutyCycle) >> 15);
+
+        // A full duty cycle with PR2 = 255 needs 1024 counts, the nearest the 10-bit register holds is 1023.
+        CCP1_PWM_WriteDutyCycle((loc_DutyCycleValue > CCPx_PWM_MAX_DUTY_COUNTS) ? CCPx_PWM_MAX_DUTY_COUNTS : loc_DutyCycleValue);
     }
     else 
     {
@@ -207,6 +688,13 @@ Std_ReturnType CCP1_PWM_Stop(const CCP1_InitTypeDef * const InitPtr)
 
     return loc_ret; 
 }
+
+static void CCP1_PWM_WriteDutyCycle(const uint16 loc_DutyCycleValue)
+{
+    __CCP1_SetDutyCycleLower2Bits(loc_DutyCycleValue & 0x03);
+
+    __CCP1_RegisterLow() = (uint8)(loc_DutyCycleValue >> 2);
+}
 #endif
 
 #if (INTERRUPTS_CCP1_INTERRUPTS_FEATURE == STD_ON)
@@ -214,14 +702,20 @@ static Std_ReturnType CCP1_InitInterruptHandler(const CCP1_InitTypeDef * const I
 {
     Std_ReturnType loc_ret = E_OK;
 
+#if (((CCP1_MODE == CCP1_CAPTURE_MODE) && (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON)) || \
+     ((CCP1_MODE == CCP1_COMPARE_MODE) && (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON)))
+    // The capture engine or the compare scheduler runs in the interrupt, the application handler is optional.
+    CCP1_InterruptHandler = InitPtr->InterruptHandler;
+#else
     if (NULL_PTR != InitPtr->InterruptHandler)
     {
         CCP1_InterruptHandler = InitPtr->InterruptHandler;
     }
-    else 
+    else
     {
         loc_ret = E_NOT_OK;
     }
+#endif
 
     return loc_ret;
 }
@@ -255,7 +749,21 @@ static void CCP1_DeInitInterruptHandler(void)
 void CCP1_ISR(void)
 {
     INTI_CCP1_ClearFlag();
-    
+
+#if ((CCP1_MODE == CCP1_CAPTURE_MODE) && (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON))
+    if (TRUE == CCP1_Capture.Running)
+    {
+        CCP1_CaptureEdge();
+    }
+#endif
+
+#if ((CCP1_MODE == CCP1_COMPARE_MODE) && (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON))
+    if (TRUE == CCP1_Scheduler.Running)
+    {
+        CCP1_SchedulerMatch();
+    }
+#endif
+
     if (NULL_PTR != CCP1_InterruptHandler)
     {
         CCP1_InterruptHandler();
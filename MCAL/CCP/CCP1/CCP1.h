@@ -12,8 +12,8 @@
  * @note The functions and structures defined in this header allow for flexible configuration
  *       and control of the CCP1 module on compatible microcontrollers.
  *  
- * @version 0.1
- * @date 10.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _CCP1_H_
@@ -25,11 +25,17 @@
 #include"../../Timers/TIMER1/TIMER1.h"
 #include"../../Timers/TIMER2/TIMER2.h"
 #include"../../Timers/TIMER3/TIMER3.h"
+#include "../../Timers/TIME/TIME.h"
 
 #define CCP1_CAPTURE_MODE   0x00
 #define CCP1_COMPARE_MODE   0x01
 #define CCP1_PWM_MODE       0x02
 
+/**
+ * @brief Q1.15 duty cycle of a full PWM period, see CCP1_PWM_SetDutyCycleQ15().
+ */
+#define CCP1_PWM_DUTY_CYCLE_Q15_ONE    0x8000U
+
 typedef enum
 {
 #if (CCP1_MODE == CCP1_CAPTURE_MODE)
@@ -83,6 +89,28 @@ typedef struct
 
 } CCP1_InitTypeDef;
 
+#if ((CCP1_MODE == CCP1_CAPTURE_MODE) && (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON))
+typedef enum
+{
+    CCP1_CAPTURE_PERIOD = 0,          /* Period of the edges of the capture mode */
+    CCP1_CAPTURE_PULSE_WIDTH,         /* Alternating rising and falling edges, period and high time */
+    CCP1_CAPTURE_MEASUREMENT_LIMIT
+
+} CCP1_CaptureMeasurementTypeDef;
+#endif
+
+#if ((CCP1_MODE == CCP1_COMPARE_MODE) && (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON))
+typedef enum
+{
+    CCP1_EVENT_NONE = 0,              /* Callback only, the pin is left unchanged */
+    CCP1_EVENT_SET_HIGH,
+    CCP1_EVENT_SET_LOW,
+    CCP1_EVENT_TOGGLE,
+    CCP1_EVENT_LIMIT
+
+} CCP1_EventActionTypeDef;
+#endif
+
 /**
  * @brief Initialize the CCP1 module with the provided configuration.
  *
@@ -134,6 +162,74 @@ Std_ReturnType CCP1_DeInit(const CCP1_InitTypeDef * const InitPtr);
  */
 Std_ReturnType CCP1_ReadCapture(const CCP1_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr);
 
+#if (CCP1_CAPTURE_ENGINE_FEATURE == STD_ON)
+
+/**
+ * @brief Start measuring the CCP1 input with the capture engine.
+ *
+ * Every capture is timestamped in the CCP1 interrupt on the TIME time base, which extends the 16-bit capture to
+ * 32 bits. The last CCPx_CAPTURE_WINDOW_SIZE measurements are kept and averaged.
+ *     - CCP1_CAPTURE_PERIOD: the period between the edges of the capture mode of @param InitPtr, the 4th and 16th
+ *       rising edge modes average the period over 4 or 16 input periods.
+ *     - CCP1_CAPTURE_PULSE_WIDTH: the capture edge alternates between rising and falling, the period is measured
+ *       between rising edges and the pulse width from each rising edge to the next falling edge.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param Measurement The measurement to run.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The measurement was started, the previous measurements are discarded.
+ *     - E_NOT_OK: NULL @param InitPtr, invalid @param Measurement or CCP1 does not capture the TIME timer.
+ *
+ * @note TIME_Init() must be called first, and the timer resource of @param InitPtr must select the TIME timer.
+ * @note A pulse shorter than the CCP1 interrupt latency is missed, the next falling edge is measured instead.
+ */
+Std_ReturnType CCP1_Capture_Start(const CCP1_InitTypeDef * const InitPtr, const CCP1_CaptureMeasurementTypeDef Measurement);
+
+/**
+ * @brief Stop the capture engine, disable the CCP1 module and its interrupt, the last measurements remain readable.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The measurement was stopped.
+ *     - E_NOT_OK: NULL @param InitPtr.
+ */
+Std_ReturnType CCP1_Capture_Stop(const CCP1_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Read the average period of the CCP1 input.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param Period_ret Pointer to a variable where the average period is stored, in TIME ticks.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The average period was stored successfully.
+ *     - E_NOT_OK: NULL pointer or no period measured yet.
+ */
+Std_ReturnType CCP1_Capture_GetPeriod(const CCP1_InitTypeDef * const InitPtr, uint32 * const Period_ret);
+
+/**
+ * @brief Read the average frequency of the CCP1 input.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param Frequency_mHz_ret Pointer to a variable where the average frequency is stored, in millihertz.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The average frequency was stored successfully.
+ *     - E_NOT_OK: NULL pointer or no period measured yet.
+ */
+Std_ReturnType CCP1_Capture_GetFrequency(const CCP1_InitTypeDef * const InitPtr, uint32 * const Frequency_mHz_ret);
+
+/**
+ * @brief Read the average pulse width (high time) of the CCP1 input.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param PulseWidth_ret Pointer to a variable where the average pulse width is stored, in TIME ticks.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The average pulse width was stored successfully.
+ *     - E_NOT_OK: NULL pointer or no pulse measured yet (only CCP1_CAPTURE_PULSE_WIDTH measures pulses).
+ */
+Std_ReturnType CCP1_Capture_GetPulseWidth(const CCP1_InitTypeDef * const InitPtr, uint32 * const PulseWidth_ret);
+
+#endif
+
 #elif (CCP1_MODE == CCP1_COMPARE_MODE)
 
 /**
@@ -152,20 +248,84 @@ Std_ReturnType CCP1_ReadCapture(const CCP1_InitTypeDef * const InitPtr, uint16 *
  */
 Std_ReturnType CCP1_WriteCompareValue(const CCP1_InitTypeDef * const InitPtr, const uint16 CompareValue);
 
+#if (CCP1_COMPARE_SCHEDULER_FEATURE == STD_ON)
+
+/**
+ * @brief Start the compare event scheduler of CCP1, with an empty queue and the CCP1 pin (RC2) low.
+ *
+ * The scheduler keeps the events sorted by time and arms the compare register for the next one from the CCP1
+ * interrupt. The pin is driven by the compare hardware on the match, so its timing does not depend on the interrupt
+ * latency. Events further than a timer period away are reached through intermediate matches.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The scheduler was started successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or CCP1 does not use the TIME timer.
+ *
+ * @note TIME_Init() must be called first, and the timer resource of @param InitPtr must select the TIME timer.
+ */
+Std_ReturnType CCP1_Scheduler_Start(const CCP1_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Stop the compare event scheduler of CCP1, the pending events are dropped and the pin keeps its level.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The scheduler was stopped.
+ *     - E_NOT_OK: NULL @param InitPtr.
+ */
+Std_ReturnType CCP1_Scheduler_Stop(const CCP1_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Queue a timed event on the CCP1 compare event scheduler.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param Time Time of the event on the TIME time base, see TIME_GetTicks32(), less than 2^31 ticks ahead.
+ * @param Action The pin action taken by the hardware at @param Time.
+ * @param Callback Function called from the CCP1 interrupt once the event has happened, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The event was queued successfully.
+ *     - E_NOT_OK: NULL @param InitPtr, invalid @param Action, @param Time not in the future or the queue is full.
+ *
+ * @note Callbacks may queue the next events, which is how pulse trains are generated.
+ * @note Events closer than CCPx_SCHEDULER_MIN_LEAD_TICKS to the previous one or to the time they are armed happen
+ *       CCPx_SCHEDULER_MIN_LEAD_TICKS after being armed instead.
+ */
+Std_ReturnType CCP1_Scheduler_AddEvent(const CCP1_InitTypeDef * const InitPtr, const uint32 Time,
+                                       const CCP1_EventActionTypeDef Action, void (* const Callback)(void));
+
+/**
+ * @brief Retrieve the number of events waiting in the CCP1 compare event scheduler.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param Pending_ret Pointer to a variable where the number of pending events is stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The number of events was stored successfully.
+ *     - E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType CCP1_Scheduler_GetPendingEvents(const CCP1_InitTypeDef * const InitPtr, uint8 * const Pending_ret);
+
+#endif
+
 #elif (CCP1_MODE == CCP1_PWM_MODE)
 
 /**
  * @brief Set the frequency for PWM operation of the CCP1 module.
  *
- * This function sets the frequency for PWM (Pulse-Width Modulation) operation of the CCP1 module.
+ * This function sets the frequency for PWM (Pulse-Width Modulation) operation of the CCP1 module. The TIMER2
+ * prescaler and PR2 are chosen by TIMER2_SolvePWMPeriod() for the finest duty cycle resolution, and the prescaler of
+ * the TIMER2 structure is updated accordingly.
  *
  * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
  * @param Frequency The desired PWM frequency in Hertz (Hz).
  * @return Std_ReturnType Error status indicating the success of setting the PWM frequency.
  *     - E_OK: The PWM frequency was set successfully.
- *     - E_NOT_OK: An error occurred during PWM frequency configuration (e.g., invalid configuration or frequency).
+ *     - E_NOT_OK: An error occurred during PWM frequency configuration (e.g., invalid configuration or frequency out
+ *       of the range of TIMER2).
  *
  * @note This function is intended for use when CCP1 is configured in PWM mode.
+ * @note The period is shared by CCP1 and CCP2, the duty cycles are expressed in counts of the period and must be set
+ *       again after a frequency change.
  */
 Std_ReturnType CCP1_PWM_SetFrequency(const CCP1_InitTypeDef * const InitPtr, const uint32 Frequency);
 
@@ -185,6 +345,39 @@ Std_ReturnType CCP1_PWM_SetFrequency(const CCP1_InitTypeDef * const InitPtr, con
  */
 Std_ReturnType CCP1_PWM_SetDutyCycle(const CCP1_InitTypeDef * const InitPtr, const uint8 DutyCycle);
 
+/**
+ * @brief Set the duty cycle for PWM operation of the CCP1 module as a raw 10-bit count.
+ *
+ * The duty cycle is expressed in the units of the CCPR1L:DC1B register, a full period lasts 4 * (PR2 + 1) counts.
+ * Values at or above a full period keep the output high. This is the cheapest setter, meant for control loops that
+ * update the duty cycle every PWM period.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param DutyCycle The desired PWM duty cycle in counts (0-1023).
+ * @return Std_ReturnType Error status indicating the success of setting the PWM duty cycle.
+ *     - E_OK: The PWM duty cycle was set successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or @param DutyCycle above 1023.
+ *
+ * @note This function is intended for use when CCP1 is configured in PWM mode.
+ */
+Std_ReturnType CCP1_PWM_SetDutyCycleRaw(const CCP1_InitTypeDef * const InitPtr, const uint16 DutyCycle);
+
+/**
+ * @brief Set the duty cycle for PWM operation of the CCP1 module as a Q1.15 fraction of the period.
+ *
+ * The fraction is scaled to the current period with integer math, at the full resolution of the PWM.
+ *
+ * @param InitPtr Pointer to the CCP1 initialization structure containing configuration parameters.
+ * @param DutyCycle The desired PWM duty cycle from 0 (0%) to CCP1_PWM_DUTY_CYCLE_Q15_ONE (100%).
+ * @return Std_ReturnType Error status indicating the success of setting the PWM duty cycle.
+ *     - E_OK: The PWM duty cycle was set successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or @param DutyCycle above CCP1_PWM_DUTY_CYCLE_Q15_ONE.
+ *
+ * @note This function is intended for use when CCP1 is configured in PWM mode.
+ * @note With PR2 = 255 a full duty cycle needs 1024 counts, it is limited to 1023.
+ */
+Std_ReturnType CCP1_PWM_SetDutyCycleQ15(const CCP1_InitTypeDef * const InitPtr, const uint16 DutyCycle);
+
 /**
  * @brief Start PWM operation of the CCP1 module.
  *
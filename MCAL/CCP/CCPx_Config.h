@@ -4,8 +4,8 @@
  * 
  * @brief
  *  
- * @version 0.1
- * @date 10.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _CCPx_CONFIG_H_
@@ -21,8 +21,13 @@
  * - CCP1_CAPTURE_MODE: In this mode, the CCP1 module operates as a capture module, allowing the measurement of external events.
  * - CCP1_COMPARE_MODE: This mode configures the CCP1 module to function as a compare module for generating output based on comparisons.
  * - CCP1_PWM_MODE    : This mode sets up the CCP1 module to operate as a Pulse-Width Modulation (PWM) generator.
+ *
+ * @note Can be overridden on the compiler command line, the host tests of the capture engine and of the compare
+ *       scheduler do so.
  */
+#ifndef CCP1_MODE
 #define CCP1_MODE           CCP1_PWM_MODE
+#endif
 
 /**
  * @def CCP2_MODE
@@ -34,7 +39,74 @@
  * - CCP2_CAPTURE_MODE: In this mode, the CCP2 module operates as a capture module, allowing the measurement of external events.
  * - CCP2_COMPARE_MODE: This mode configures the CCP2 module to function as a compare module for generating output based on comparisons.
  * - CCP2_PWM_MODE    : This mode sets up the CCP2 module to operate as a Pulse-Width Modulation (PWM) generator.
+ *
+ * @note Can be overridden on the compiler command line, the host tests of the capture engine and of the compare
+ *       scheduler do so.
  */
+#ifndef CCP2_MODE
 #define CCP2_MODE           CCP2_PWM_MODE
+#endif
+
+/**
+ * @def CCP1_CAPTURE_ENGINE_FEATURE
+ * @brief Control macro to enable or disable the capture measurement engine of CCP1 in capture mode.
+ *     - STD_ON: The CCP1 interrupt timestamps the captured edges on the TIME time base and measures the period,
+ *               frequency and pulse width of the input.
+ *     - STD_OFF: Only the raw capture register is available.
+ */
+#define CCP1_CAPTURE_ENGINE_FEATURE                     STD_ON
+
+/**
+ * @def CCP2_CAPTURE_ENGINE_FEATURE
+ * @brief Control macro to enable or disable the capture measurement engine of CCP2 in capture mode.
+ *     - STD_ON: The CCP2 interrupt timestamps the captured edges on the TIME time base and measures the period,
+ *               frequency and pulse width of the input.
+ *     - STD_OFF: Only the raw capture register is available.
+ */
+#define CCP2_CAPTURE_ENGINE_FEATURE                     STD_ON
+
+/**
+ * @def CCP1_COMPARE_SCHEDULER_FEATURE
+ * @brief Control macro to enable or disable the compare event scheduler of CCP1 in compare mode.
+ *     - STD_ON: The CCP1 interrupt runs a queue of timed pin events on the TIME time base.
+ *     - STD_OFF: Only the raw compare register is available.
+ */
+#define CCP1_COMPARE_SCHEDULER_FEATURE                  STD_ON
+
+/**
+ * @def CCP2_COMPARE_SCHEDULER_FEATURE
+ * @brief Control macro to enable or disable the compare event scheduler of CCP2 in compare mode.
+ *     - STD_ON: The CCP2 interrupt runs a queue of timed pin events on the TIME time base.
+ *     - STD_OFF: Only the raw compare register is available.
+ */
+#define CCP2_COMPARE_SCHEDULER_FEATURE                  STD_ON
+
+/**
+ * @def CCPx_SCHEDULER_QUEUE_SIZE
+ * @brief Number of events the compare event scheduler of each module can hold, up to 255.
+ */
+#define CCPx_SCHEDULER_QUEUE_SIZE                       8
+
+/**
+ * @def CCPx_SCHEDULER_MIN_LEAD_TICKS
+ * @brief Shortest distance, in TIME ticks, at which the scheduler arms a compare match. It must cover the time taken
+ *        to program the match, events due sooner are delayed to it.
+ */
+#define CCPx_SCHEDULER_MIN_LEAD_TICKS                   32
+
+/**
+ * @def CCPx_CAPTURE_WINDOW_SIZE
+ * @brief Number of the last measurements averaged by the capture engine, a power of two up to 128.
+ */
+#define CCPx_CAPTURE_WINDOW_SIZE                        8
+
+#if ((CCPx_CAPTURE_WINDOW_SIZE < 1) || (CCPx_CAPTURE_WINDOW_SIZE > 128) || \
+     ((CCPx_CAPTURE_WINDOW_SIZE & (CCPx_CAPTURE_WINDOW_SIZE - 1)) != 0))
+#error "'CCPx_CAPTURE_WINDOW_SIZE' must be a power of two up to 128 in CCPx_Config.h"
+#endif
+
+#if ((CCPx_SCHEDULER_QUEUE_SIZE < 1) || (CCPx_SCHEDULER_QUEUE_SIZE > 255))
+#error "'CCPx_SCHEDULER_QUEUE_SIZE' must be between 1 and 255 in CCPx_Config.h"
+#endif
 
 #endif /* _CCPx_CONFIG_H_ */
\ No newline at end of file
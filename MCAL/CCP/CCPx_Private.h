@@ -4,30 +4,104 @@
  * 
  * @brief
  *  
- * @version 0.1
- * @date 10.09.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #ifndef _CCPX_PRIVATE_H_
 #define _CCPX_PRIVATE_H_
 
 #include "../mcu_registers.h"
+#include "CCPx_Config.h"
+#include "../Timers/TIME/TIME_Config.h"
 
-#define __CCPx_SelectTimerResource(x)                       T3CONbits.T3CCP2 = (x & 0x02);\
-                                                            T3CONbits.T3CCP1 = (x & 0x01)
+#define __CCPx_SelectTimerResource(x)                       do {\
+                                                                T3CONbits.T3CCP2 = (((x) >> 1) & 0x01);\
+                                                                T3CONbits.T3CCP1 = ((x) & 0x01);\
+                                                            } while (0)
 
 #define __CCPx_EnableTimer2()                               (T2CONbits.TMR2ON = 1)
 
+/* Duty cycle counts of a full PWM period, the duty cycle register counts Q1 clocks (FOSC / TIMER2 prescaler) */
+#define __CCPx_PWMPeriodCounts()                            ((uint16)((uint16)PR2 + 1) << 2)
+#define CCPx_PWM_MAX_DUTY_COUNTS                            0x03FFU
+
 #define __CCP1_Disable()                                    (CCP1CONbits.CCP1M = 0)
 #define __CCP1_ConfigMode(x)                                (CCP1CONbits.CCP1M = x)
 #define __CCP1_SetDutyCycleLower2Bits(x)                    (CCP1CONbits.DC1B = x)
 #define __CCP1_RegisterLow()                                (CCPR1L)
 #define __CCP1_RegisterHigh()                               (CCPR1H)
+#define __CCP1_ClearFlag()                                  (PIR1bits.CCP1IF = 0)
+#define __CCP1_InterruptStatus()                            (PIE1bits.CCP1IE)
+#define __CCP1_SetInterruptStatus(x)                        (PIE1bits.CCP1IE = x)
+#define __CCP1_CaptureEdgeIsRising()                        (CCP1CONbits.CCP1M & 0x01)
+#define __CCP1_ToggleCaptureEdge()                          (CCP1CONbits.CCP1M ^= 0x01)
+#define __CCP1_WriteOutputLatch(x)                          (LATCbits.LATC2 = x)
 
 #define __CCP2_Disable()                                    (CCP2CONbits.CCP2M = 0)
 #define __CCP2_ConfigMode(x)                                (CCP2CONbits.CCP2M = x)
 #define __CCP2_SetDutyCycleLower2Bits(x)                    (CCP2CONbits.DC2B = x)
 #define __CCP2_RegisterLow()                                (CCPR2L)
 #define __CCP2_RegisterHigh()                               (CCPR2H)
+#define __CCP2_ClearFlag()                                  (PIR2bits.CCP2IF = 0)
+#define __CCP2_InterruptStatus()                            (PIE2bits.CCP2IE)
+#define __CCP2_SetInterruptStatus(x)                        (PIE2bits.CCP2IE = x)
+#define __CCP2_CaptureEdgeIsRising()                        (CCP2CONbits.CCP2M & 0x01)
+#define __CCP2_ToggleCaptureEdge()                          (CCP2CONbits.CCP2M ^= 0x01)
+#define __CCP2_WriteOutputLatch(x)                          (LATCbits.LATC1 = x)
+
+/* Input edges per capture of the capture modes, every edge, every 4th or every 16th rising edge */
+#define __CCPx_CaptureEdges(Mode)                           ((0b0110 == (Mode)) ? 4U : (0b0111 == (Mode)) ? 16U : 1U)
+
+/* The capture engine and the compare scheduler run on the TIME time base, the module must use the TIME timer */
+#if (TIME_TIMER == TIME_TIMER1)
+#define __CCP1_UsesTimeBase(Resource)                   (CPPx_TIMER3_FOR_CCPx != (Resource))
+#define __CCP2_UsesTimeBase(Resource)                   (CCPx_TIMER1_FOR_CCPx == (Resource))
+#else
+#define __CCP1_UsesTimeBase(Resource)                   (CPPx_TIMER3_FOR_CCPx == (Resource))
+#define __CCP2_UsesTimeBase(Resource)                   (CCPx_TIMER1_FOR_CCPx != (Resource))
+#endif
+
+/* Sliding window of the last measurements with their running sum */
+typedef struct
+{
+    uint32  Samples[CCPx_CAPTURE_WINDOW_SIZE];
+    uint32  Sum;
+    uint8   Index;
+    uint8   Count;
+
+} CCPx_CaptureWindowTypeDef;
+
+typedef struct
+{
+    CCPx_CaptureWindowTypeDef   Periods;
+    CCPx_CaptureWindowTypeDef   PulseWidths;
+    uint32                      LastEdge;       /* Timestamp of the last rising (or counted) edge */
+    uint8                       Measurement;
+    uint8                       Edges;          /* Input edges per period sample */
+    volatile boolean            Running;
+    boolean                     Started;        /* LastEdge holds a timestamp */
+
+} CCPx_CaptureEngineTypeDef;
+
+typedef struct
+{
+    uint32  Time;
+    void    (*Callback)(void);
+    uint8   Action;
+
+} CCPx_EventTypeDef;
+
+/* Events sorted by time, Events[0] is the one armed on the compare register */
+typedef struct
+{
+    CCPx_EventTypeDef   Events[CCPx_SCHEDULER_QUEUE_SIZE];
+    uint8               Count;
+    uint8               Level;          /* Pin level, mirrored on the output latch */
+    uint8               Target;         /* Pin level after the armed event */
+    boolean             Armed;          /* Events[0] fires on the next match */
+    volatile boolean    Running;
+
+} CCPx_SchedulerTypeDef;
 
 #endif /* _CPPX_PRIVATE_H_ */
\ No newline at end of file
@@ -1,34 +1,73 @@
 /**
  * @file EEPROM.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 13.08.23
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #include "EEPROM_Private.h"
 #include "EEPROM.h"
 
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+/* The request at the tail stays queued until its write cycle is completed */
+static volatile EEPROM_WriteRequestTypeDef EEPROM_WriteQueue[EEPROM_WRITE_QUEUE_SIZE];
+static volatile uint8 EEPROM_WriteHead = 0;
+static volatile uint8 EEPROM_WriteTail = 0;
+static void (* volatile EEPROM_WriteCompleteHandler)(void) = NULL_PTR;
+
+static void EEPROM_StartQueuedWrite(void);
+static void EEPROM_CompleteQueuedWrite(void);
+#endif
+
+static volatile uint16 EEPROM_BytesWritten = 0;
+static volatile uint16 EEPROM_BytesSkipped = 0;
+
 static void EEPROM_WriteAddressToAddressRegisters(const uint16 loc_addres);
+static void EEPROM_IncrementAddressRegisters(void);
 static void EEPROM_InitPreWritingSequence(void);
+static uint8 EEPROM_ReadCurrentAddress(void);
+static void EEPROM_WriteCurrentAddress(const uint8 loc_data);
 
 Std_ReturnType EEPROM_ReadByte(const uint16 loc_address, uint8 * const loc_data_ret)
 {
     Std_ReturnType loc_ret = E_OK;
 
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+    boolean loc_queued = FALSE;
+    uint8 loc_index = 0;
+#endif
+
     if (NULL != loc_data_ret)
     {
-        EEPROM_WriteAddressToAddressRegisters(loc_address);
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        /* Masking EEIE keeps EEPROM_ISR from changing the address registers in the middle of the read */
+        INTI_EEPROM_DisableInterrupt();
 
-        EEPROM_PointToEEPROM();
-        EEPROM_AccessEEPROM();
+        /* The newest queued write to the address holds the value the memory is going to have */
+        for (loc_index = EEPROM_WriteTail; loc_index != EEPROM_WriteHead; loc_index++)
+        {
+            if (loc_address == EEPROM_WriteQueue[loc_index & (EEPROM_WRITE_QUEUE_SIZE - 1)].Address)
+            {
+                *loc_data_ret = EEPROM_WriteQueue[loc_index & (EEPROM_WRITE_QUEUE_SIZE - 1)].Data;
+                loc_queued = TRUE;
+            }
+        }
 
-        EEPROM_Read();
+        if (FALSE == loc_queued)
+        {
+            while (EEPROM_isWriting());
+#endif
+            EEPROM_WriteAddressToAddressRegisters(loc_address);
 
-        // two no instruction operations are required for latency at high clock frequencies.
-        NOP();
-        NOP();
+            *loc_data_ret = EEPROM_ReadCurrentAddress();
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        }
 
-        *loc_data_ret = EEPROM_DataRegister;
+        if (EEPROM_WriteHead != EEPROM_WriteTail)
+        {
+            INTI_EEPROM_EnableInterrupt();
+        }
+#endif
     }
     else
     {
@@ -42,38 +81,354 @@ Std_ReturnType EEPROM_WriteByte(const uint16 loc_address, const uint8 loc_data)
 {
     Std_ReturnType loc_ret = E_OK;
 
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+    loc_ret = EEPROM_Flush();
+#endif
+
     EEPROM_WriteAddressToAddressRegisters(loc_address);
+    EEPROM_WriteCurrentAddress(loc_data);
 
-    EEPROM_DataRegister = loc_data;
+    // The write cycle itself runs with the interrupts enabled.
+    while (EEPROM_isWriting());
 
-    EEPROM_PointToEEPROM();
-    EEPROM_AccessEEPROM();
+    EEPROM_DisableWriting();
 
-    EEPROM_EnableWriting();
+    return loc_ret;
+}
 
-    uint8 loc_globalInterruptsStatus = INTI_GetInterruptStatus();
-    INTI_DisableInterrupts();
+Std_ReturnType EEPROM_ReadBlock(const uint16 loc_address, uint8 * const loc_data_ret, const uint16 loc_length)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_offset = 0;
 
-    // Critical Section
-    EEPROM_InitPreWritingSequence();
-    EEPROM_Write();
-    while (EEPROM_isWriting());
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+    uint8 loc_index = 0;
+#endif
 
-    INTI_SetInterruptStatus(loc_globalInterruptsStatus);
+    if ((NULL_PTR != loc_data_ret) && (loc_address < EEPROM_SIZE) && (loc_length <= (EEPROM_SIZE - loc_address)))
+    {
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        INTI_EEPROM_DisableInterrupt();
 
-    EEPROM_DisableWriting();
+        while (EEPROM_isWriting());
+#endif
+        EEPROM_WriteAddressToAddressRegisters(loc_address);
+
+        for (loc_offset = 0; loc_offset < loc_length; loc_offset++)
+        {
+            loc_data_ret[loc_offset] = EEPROM_ReadCurrentAddress();
+            EEPROM_IncrementAddressRegisters();
+        }
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        /* Queued writes are applied oldest first, so the newest one to an address wins */
+        for (loc_index = EEPROM_WriteTail; loc_index != EEPROM_WriteHead; loc_index++)
+        {
+            loc_offset = EEPROM_WriteQueue[loc_index & (EEPROM_WRITE_QUEUE_SIZE - 1)].Address - loc_address;
+
+            if (loc_offset < loc_length)
+            {
+                loc_data_ret[loc_offset] = EEPROM_WriteQueue[loc_index & (EEPROM_WRITE_QUEUE_SIZE - 1)].Data;
+            }
+        }
+
+        if (EEPROM_WriteHead != EEPROM_WriteTail)
+        {
+            INTI_EEPROM_EnableInterrupt();
+        }
+#endif
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EEPROM_WriteBlock(const uint16 loc_address, const uint8 * const loc_data, const uint16 loc_length)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_offset = 0;
+
+    if ((NULL_PTR != loc_data) && (loc_address < EEPROM_SIZE) && (loc_length <= (EEPROM_SIZE - loc_address)))
+    {
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        loc_ret = EEPROM_Flush();
+#endif
+        EEPROM_WriteAddressToAddressRegisters(loc_address);
+
+        for (loc_offset = 0; loc_offset < loc_length; loc_offset++)
+        {
+            // Only the bytes that differ cost a write cycle and endurance.
+            if (loc_data[loc_offset] != EEPROM_ReadCurrentAddress())
+            {
+                EEPROM_WriteCurrentAddress(loc_data[loc_offset]);
+                while (EEPROM_isWriting());
+
+                EEPROM_BytesWritten++;
+            }
+            else
+            {
+                EEPROM_BytesSkipped++;
+            }
+
+            EEPROM_IncrementAddressRegisters();
+        }
+
+        EEPROM_DisableWriting();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EEPROM_GetWriteCounters(uint16 * const loc_written_ret, uint16 * const loc_skipped_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != loc_written_ret) && (NULL_PTR != loc_skipped_ret))
+    {
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        /* The counters are also updated from EEPROM_ISR */
+        INTI_EEPROM_DisableInterrupt();
+#endif
+        *loc_written_ret = EEPROM_BytesWritten;
+        *loc_skipped_ret = EEPROM_BytesSkipped;
+        EEPROM_BytesWritten = 0;
+        EEPROM_BytesSkipped = 0;
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+        if (EEPROM_WriteHead != EEPROM_WriteTail)
+        {
+            INTI_EEPROM_EnableInterrupt();
+        }
+#endif
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+Std_ReturnType EEPROM_WriteByteNonBlocking(const uint16 loc_address, const uint8 loc_data)
+{
+    return EEPROM_WriteBlockNonBlocking(loc_address, &loc_data, 1);
+}
+
+Std_ReturnType EEPROM_WriteBlockNonBlocking(const uint16 loc_address, const uint8 * const loc_data, const uint8 loc_length)
+{
+    Std_ReturnType loc_ret = E_OK;
+    boolean loc_idle = FALSE;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != loc_data) && (loc_address < EEPROM_SIZE) && (loc_length <= (EEPROM_SIZE - loc_address)))
+    {
+        INTI_EEPROM_DisableInterrupt();
+
+        if (loc_length <= (uint8)(EEPROM_WRITE_QUEUE_SIZE - (uint8)(EEPROM_WriteHead - EEPROM_WriteTail)))
+        {
+            loc_idle = (EEPROM_WriteHead == EEPROM_WriteTail);
+
+            for (loc_index = 0; loc_index < loc_length; loc_index++)
+            {
+                EEPROM_WriteQueue[EEPROM_WriteHead & (EEPROM_WRITE_QUEUE_SIZE - 1)].Address = loc_address + loc_index;
+                EEPROM_WriteQueue[EEPROM_WriteHead & (EEPROM_WRITE_QUEUE_SIZE - 1)].Data = loc_data[loc_index];
+                EEPROM_WriteHead++;
+            }
+
+            if ((TRUE == loc_idle) && (loc_length > 0))
+            {
+#if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+                INTI_EEPROM_SetPriority(EEPROM_INTERRUPT_PRIORITY);
+#endif
+                EEPROM_StartQueuedWrite();
+            }
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        if (EEPROM_WriteHead != EEPROM_WriteTail)
+        {
+            INTI_EEPROM_EnableInterrupt();
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
 
     return loc_ret;
 }
 
+Std_ReturnType EEPROM_Flush(void)
+{
+    while (EEPROM_WriteHead != EEPROM_WriteTail)
+    {
+        INTI_EEPROM_DisableInterrupt();
+
+        if ((EEPROM_WriteHead != EEPROM_WriteTail) && INTI_EEPROM_Flag())
+        {
+            INTI_EEPROM_ClearFlag();
+            EEPROM_CompleteQueuedWrite();
+        }
+
+        if (EEPROM_WriteHead != EEPROM_WriteTail)
+        {
+            INTI_EEPROM_EnableInterrupt();
+        }
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType EEPROM_GetWriteQueueFreeSpace(uint8 * const loc_free_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != loc_free_ret)
+    {
+        *loc_free_ret = (uint8)(EEPROM_WRITE_QUEUE_SIZE - (uint8)(EEPROM_WriteHead - EEPROM_WriteTail));
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EEPROM_SetWriteCompleteHandler(void (* const loc_handler)(void))
+{
+    /* The pointer is not stored atomically, EEPROM_ISR must not call it halfway through */
+    INTI_EEPROM_DisableInterrupt();
+
+    EEPROM_WriteCompleteHandler = loc_handler;
+
+    if (EEPROM_WriteHead != EEPROM_WriteTail)
+    {
+        INTI_EEPROM_EnableInterrupt();
+    }
+
+    return E_OK;
+}
+
+static void EEPROM_StartQueuedWrite(void)
+{
+    boolean loc_started = FALSE;
+
+    // Queued bytes that already hold their value are dropped without a write cycle.
+    while ((FALSE == loc_started) && (EEPROM_WriteHead != EEPROM_WriteTail))
+    {
+        EEPROM_WriteAddressToAddressRegisters(EEPROM_WriteQueue[EEPROM_WriteTail & (EEPROM_WRITE_QUEUE_SIZE - 1)].Address);
+
+        if (EEPROM_WriteQueue[EEPROM_WriteTail & (EEPROM_WRITE_QUEUE_SIZE - 1)].Data != EEPROM_ReadCurrentAddress())
+        {
+            EEPROM_WriteCurrentAddress(EEPROM_WriteQueue[EEPROM_WriteTail & (EEPROM_WRITE_QUEUE_SIZE - 1)].Data);
+            EEPROM_BytesWritten++;
+            loc_started = TRUE;
+        }
+        else
+        {
+            EEPROM_BytesSkipped++;
+            EEPROM_WriteTail++;
+        }
+    }
+
+    if (FALSE == loc_started)
+    {
+        EEPROM_DisableWriting();
+        INTI_EEPROM_DisableInterrupt();
+
+        if (NULL_PTR != EEPROM_WriteCompleteHandler)
+        {
+            EEPROM_WriteCompleteHandler();
+        }
+    }
+}
+
+static void EEPROM_CompleteQueuedWrite(void)
+{
+    // A flag left by a blocking write finds the queue empty.
+    if (EEPROM_WriteHead != EEPROM_WriteTail)
+    {
+        EEPROM_WriteTail++;
+
+        EEPROM_StartQueuedWrite();
+    }
+}
+#endif
+
 static void EEPROM_WriteAddressToAddressRegisters(const uint16 loc_addres)
 {
     EEPROM_LowerAddressRegister = (uint8)(loc_addres & EEPROM_LowerAddressRegisterMask);
     EEPROM_HigherAddressRegister = (uint8)((loc_addres >> 8) & EEPROM_HigherAddressRegisterMask);
 }
 
+static void EEPROM_IncrementAddressRegisters(void)
+{
+    // EEADRH only needs to be written when EEADR wraps around.
+    if (0 == ++EEPROM_LowerAddressRegister)
+    {
+        EEPROM_HigherAddressRegister = (uint8)((EEPROM_HigherAddressRegister + 1) & EEPROM_HigherAddressRegisterMask);
+    }
+}
+
 static void EEPROM_InitPreWritingSequence(void)
 {
     EECON2 = 0x55;
     EECON2 = 0xAA;
-}
\ No newline at end of file
+}
+
+static uint8 EEPROM_ReadCurrentAddress(void)
+{
+    EEPROM_PointToEEPROM();
+    EEPROM_AccessEEPROM();
+
+    EEPROM_Read();
+
+    // two no instruction operations are required for latency at high clock frequencies.
+    NOP();
+    NOP();
+
+    return EEPROM_DataRegister;
+}
+
+static void EEPROM_WriteCurrentAddress(const uint8 loc_data)
+{
+    uint8 loc_globalInterruptsStatus = 0;
+
+    EEPROM_DataRegister = loc_data;
+
+    EEPROM_PointToEEPROM();
+    EEPROM_AccessEEPROM();
+
+    EEPROM_EnableWriting();
+    INTI_EEPROM_ClearFlag();
+
+    loc_globalInterruptsStatus = EEPROM_GlobalInterruptsStatus();
+    EEPROM_SetGlobalInterruptsStatus(0);
+
+    // Critical Section
+    EEPROM_InitPreWritingSequence();
+    EEPROM_Write();
+
+    EEPROM_SetGlobalInterruptsStatus(loc_globalInterruptsStatus);
+}
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+void EEPROM_ISR(void)
+{
+    INTI_EEPROM_ClearFlag();
+
+    EEPROM_CompleteQueuedWrite();
+}
+#endif
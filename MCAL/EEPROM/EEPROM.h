@@ -15,14 +15,15 @@
  * @note The EEPROM interface promotes code portability and can be utilized across various microcontroller families
  *       and development environments.
  * 
- * @version 0.1
- * @date 13.08.23
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #ifndef _EEPROM_H_
 #define _EEPROM_H_
 
 #include "../Interrupts/Interrupts.h"
+#include "EEPROM_Config.h"
 
 /**
  * @brief Reads a byte of data from the internal EEPROM memory.
@@ -38,6 +39,8 @@
  *
  * @note The @param loc_data_ret should point to a valid uint8 variable where the read data will be stored.
  * @note If an invalid @param loc_data_ret is provided, the function will return E_NOT_OK.
+ * @note With the write queue enabled, a byte still waiting in the queue is returned from the queue, otherwise the
+ *       write in progress, if any, is waited for before the address registers are changed.
  */
 Std_ReturnType EEPROM_ReadByte(const uint16 loc_address, uint8 * const loc_data_ret);
 
@@ -54,8 +57,122 @@ Std_ReturnType EEPROM_ReadByte(const uint16 loc_address, uint8 * const loc_data_
  *     - E_NOT_OK: An error occurred during the write operation (e.g., data write failure).
  *
  * @note The @param loc_data should contain the byte of data to be written.
+ * @note The global interrupts are only disabled for the unlock sequence, not while waiting for the write cycle.
+ * @note With the write queue enabled, the queued writes are flushed first.
  */
 Std_ReturnType EEPROM_WriteByte(const uint16 loc_address, const uint8 loc_data);
 
+/**
+ * @brief Reads a block of bytes from consecutive EEPROM addresses.
+ *
+ * The address registers are set once and then incremented between the reads.
+ *
+ * @param loc_address Memory address of the first byte in the EEPROM.
+ * @param loc_data_ret Pointer to the buffer where the read bytes will be stored.
+ * @param loc_length Number of bytes to be read.
+ * @return Std_ReturnType Error status indicating the success of the read operation.
+ *     - E_OK: The block was read successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_data_ret or the block exceeds the EEPROM).
+ *
+ * @note With the write queue enabled, bytes still waiting in the queue are returned from the queue.
+ */
+Std_ReturnType EEPROM_ReadBlock(const uint16 loc_address, uint8 * const loc_data_ret, const uint16 loc_length);
+
+/**
+ * @brief Writes a block of bytes to consecutive EEPROM addresses, skipping the bytes that are unchanged.
+ *
+ * Every byte is read back first and only programmed when it differs from the current contents, which saves both
+ * the write cycle time (about 4 ms) and the cell endurance. The address registers are set once and then incremented
+ * between the bytes.
+ *
+ * @param loc_address Memory address of the first byte in the EEPROM.
+ * @param loc_data Pointer to the bytes to be written.
+ * @param loc_length Number of bytes to be written.
+ * @return Std_ReturnType Error status indicating the success of the write operation.
+ *     - E_OK: The block was written successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_data or the block exceeds the EEPROM).
+ *
+ * @note The function blocks until the last programmed byte is written, queued writes are flushed first.
+ */
+Std_ReturnType EEPROM_WriteBlock(const uint16 loc_address, const uint8 * const loc_data, const uint16 loc_length);
+
+/**
+ * @brief Retrieves and clears the numbers of bytes programmed and skipped as unchanged.
+ *
+ * Both EEPROM_WriteBlock() and the write queue are accounted for, EEPROM_WriteByte() always programs and is not.
+ *
+ * @param loc_written_ret Pointer to a uint16 variable where the number of programmed bytes will be stored.
+ * @param loc_skipped_ret Pointer to a uint16 variable where the number of skipped bytes will be stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The counters were stored successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL pointer).
+ */
+Std_ReturnType EEPROM_GetWriteCounters(uint16 * const loc_written_ret, uint16 * const loc_skipped_ret);
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+/**
+ * @brief Queues a byte write to the internal EEPROM memory, without blocking.
+ *
+ * The write is started right away when the queue is idle, otherwise it is started from EEPROM_ISR when the write
+ * before it completes. A queued byte that already holds its value is dropped without a write cycle. Only the 55h/AAh unlock sequence and the WR bit are executed with the global interrupts
+ * disabled.
+ *
+ * @param loc_address Memory address to write to in the EEPROM.
+ * @param loc_data Data byte to be written to the specified memory address.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The write was queued successfully.
+ *     - E_NOT_OK: The queue is full or @param loc_address is past the end of the EEPROM, nothing was queued.
+ *
+ * @note The global and peripheral interrupts must be enabled, or EEPROM_Flush() must be called.
+ * @note With INTERRUPTS_PRIORITY_FEATURE, the EEPROM interrupt runs at EEPROM_INTERRUPT_PRIORITY (EEPROM_Config.h).
+ */
+Std_ReturnType EEPROM_WriteByteNonBlocking(const uint16 loc_address, const uint8 loc_data);
+
+/**
+ * @brief Queues the writes of a block of bytes to consecutive EEPROM addresses, without blocking.
+ *
+ * The bytes are copied into the queue, the block is either queued as a whole or not at all.
+ *
+ * @param loc_address Memory address of the first byte in the EEPROM.
+ * @param loc_data Pointer to the bytes to be written.
+ * @param loc_length Number of bytes to be written.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The block was queued successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_data, a block past the end of the EEPROM or not enough
+ *                 free space in the queue).
+ */
+Std_ReturnType EEPROM_WriteBlockNonBlocking(const uint16 loc_address, const uint8 * const loc_data, const uint8 loc_length);
+
+/**
+ * @brief Waits until every queued write is completed.
+ *
+ * The write complete flag is also serviced from here, so a flush completes even with the global interrupts
+ * disabled. The write complete handler is then called from this function.
+ *
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The queue is empty.
+ */
+Std_ReturnType EEPROM_Flush(void);
+
+/**
+ * @brief Retrieves the number of byte writes that can still be queued.
+ *
+ * @param loc_free_ret Pointer to a uint8 variable where the free space will be stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The free space was stored successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_free_ret).
+ */
+Std_ReturnType EEPROM_GetWriteQueueFreeSpace(uint8 * const loc_free_ret);
+
+/**
+ * @brief Sets the handler called from EEPROM_ISR once the last queued write is completed.
+ *
+ * @param loc_handler Pointer to the handler, NULL_PTR removes the handler.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The handler was set successfully.
+ */
+Std_ReturnType EEPROM_SetWriteCompleteHandler(void (* const loc_handler)(void));
+#endif
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+/**
+ * @file EEPROM_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief EEPROM Configuration Interface
+ *
+ * The `EEPROM_Config.h` header file offers a centralized location to configure the optional services of the data
+ * EEPROM module, such as the interrupt-driven write queue.
+ * 
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _EEPROM_CONFIG_H_
+#define _EEPROM_CONFIG_H_
+
+/**
+ * @def EEPROM_WRITE_QUEUE_SIZE
+ * @brief Number of byte writes of the write queue, a power of two from 2 to 128.
+ *        Used when INTERRUPTS_EEPROM_INTERRUPTS_FEATURE is STD_ON.
+ */
+#define EEPROM_WRITE_QUEUE_SIZE                                 16
+
+/**
+ * @def EEPROM_INTERRUPT_PRIORITY
+ * @brief Priority of the EEPROM write interrupt, set each time the write queue starts.
+ *        Used when INTERRUPTS_EEPROM_INTERRUPTS_FEATURE and INTERRUPTS_PRIORITY_FEATURE are STD_ON.
+ */
+#define EEPROM_INTERRUPT_PRIORITY                               INTERRUPTS_LOW_PRIORITY
+
+#if ((EEPROM_WRITE_QUEUE_SIZE < 2) || (EEPROM_WRITE_QUEUE_SIZE > 128) || ((EEPROM_WRITE_QUEUE_SIZE & (EEPROM_WRITE_QUEUE_SIZE - 1)) != 0))
+#error "'EEPROM_WRITE_QUEUE_SIZE' must be a power of two from 2 to 128 in EEPROM_Config.h"
+#endif
+
+#endif /* _EEPROM_CONFIG_H_ */
@@ -15,8 +15,8 @@
  * @note The EEPROM_Private.h interface improves code organization and maintainability by isolating internal
  *       EEPROM-related operations from the main public interface.
  * 
- * @version 0.1
- * @date 13.08.23
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #ifndef _EEPROM_PRIVATE_H_
@@ -25,6 +25,8 @@
 #include "EEPROM.h"
 #include "../mcu_registers.h"
 
+#define EEPROM_SIZE                                 1024
+
 #define EEPROM_DataRegister                         (EEDATA)
 #define EEPROM_LowerAddressRegister                 (EEADR)
 #define EEPROM_LowerAddressRegisterMask             (0xFF)
@@ -43,4 +45,15 @@
 #define EEPROM_Write()                              (EECON1bits.WR = 1)
 #define EEPROM_isWriting()                          (1 == EECON1bits.WR)
 
+/* Only GIE is saved and restored, INTI_SetInterruptStatus() would also clear PEIE */
+#define EEPROM_GlobalInterruptsStatus()             (INTCONbits.GIE)
+#define EEPROM_SetGlobalInterruptsStatus(x)         (INTCONbits.GIE = x)
+
+typedef struct
+{
+    uint16 Address;
+    uint8 Data;
+
+} EEPROM_WriteRequestTypeDef;
+
 #endif
\ No newline at end of file
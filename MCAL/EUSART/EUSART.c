@@ -1,8 +1,8 @@
 /**
  * @file EUSART.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 23.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "EUSART_Private.h"
@@ -24,7 +24,35 @@ static Std_ReturnType EUSART_InitInterruptHandlers(const EUSART_InitTypeDef * co
 static Std_ReturnType EUSART_DeInitInterruptHandlers(void);
 #endif
 
+#if (EUSART_TX_BUFFER == STD_ON)
+static volatile EUSART_FrameTypeDef EUSART_TxBuffer[EUSART_TX_BUFFER_SIZE];
+static volatile uint8 EUSART_TxHead = 0;
+static volatile uint8 EUSART_TxTail = 0;
+static volatile uint16 EUSART_TxOverflowCounter = 0;
+static boolean EUSART_TxNinthBit = FALSE;
+#endif
+
+#if (EUSART_RX_BUFFER == STD_ON)
+static volatile EUSART_FrameTypeDef EUSART_RxBuffer[EUSART_RX_BUFFER_SIZE];
+static volatile uint8 EUSART_RxHead = 0;
+static volatile uint8 EUSART_RxTail = 0;
+static volatile uint16 EUSART_RxOverflowCounter = 0;
+#endif
+
+static uint8 EUSART_RxStringCounter = 0;
+
+#if (EUSART_TX_BUFFER == STD_OFF)
+static uint8 EUSART_TxStringCounter = 0;
+#endif
+
 static Std_ReturnType EUSART_InitBaudRate(const EUSART_InitTypeDef * const loc_initPtr, const uint32 loc_baudrate);
+static Std_ReturnType EUSART_SendFrame(const EUSART_InitTypeDef * const loc_initPtr, const uint16 loc_data);
+static Std_ReturnType EUSART_ReceiveFrame(const EUSART_InitTypeDef * const loc_initPtr, uint16 * const loc_data);
+static Std_ReturnType EUSART_ReadReceiveRegister(const EUSART_InitTypeDef * const loc_initPtr, uint16 * const loc_data);
+
+#if (EUSART_TX_BUFFER == STD_ON)
+static void EUSART_TxLoadNextFrame(void);
+#endif
 
 Std_ReturnType EUSART_Init(const EUSART_InitTypeDef * const InitPtr, const uint32 BaudRate)
 {
@@ -36,6 +64,23 @@ Std_ReturnType EUSART_Init(const EUSART_InitTypeDef * const InitPtr, const uint3
     {
         EUSART_PrivDisableModule();
 
+        #if (EUSART_TX_BUFFER == STD_ON)
+        EUSART_TxHead = 0;
+        EUSART_TxTail = 0;
+        EUSART_TxNinthBit = (EUSART_TX_DATA_FRAME_9BIT == InitPtr->TxDataFrame);
+        #endif
+
+        #if (EUSART_RX_BUFFER == STD_ON)
+        EUSART_RxHead = 0;
+        EUSART_RxTail = 0;
+        #endif
+
+        EUSART_RxStringCounter = 0;
+
+        #if (EUSART_TX_BUFFER == STD_OFF)
+        EUSART_TxStringCounter = 0;
+        #endif
+
         loc_ret = EUSART_InitBaudRate(InitPtr, BaudRate);
 
         EUSART_PrivEnableAsyncMode();
@@ -52,7 +97,8 @@ Std_ReturnType EUSART_Init(const EUSART_InitTypeDef * const InitPtr, const uint3
 
                 #if (INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON)
                     #if (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON)
-                    INTI_EUSART_EnableTxInterrupt();
+                    /* The transmit interrupt is enabled by the transmit buffer while it holds frames */
+                    INTI_EUSART_DisableTxInterrupt();
 
                         #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
                         INTI_EUSART_SetTxPriority(InitPtr->TxHandlerPriority);
@@ -75,7 +121,8 @@ Std_ReturnType EUSART_Init(const EUSART_InitTypeDef * const InitPtr, const uint3
 
                 #if (INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON)
                     #if (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON)
-                    INTI_EUSART_EnableTxInterrupt();
+                    /* The transmit interrupt is enabled by the transmit buffer while it holds frames */
+                    INTI_EUSART_DisableTxInterrupt();
 
                         #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
                         INTI_EUSART_SetTxPriority(InitPtr->TxHandlerPriority);
@@ -165,6 +212,17 @@ Std_ReturnType EUSART_SendDataFrameBlocking(const EUSART_InitTypeDef * const Ini
 {
     Std_ReturnType loc_ret = E_OK;
 
+    #if (EUSART_TX_BUFFER == STD_ON)
+    /* Frames queued earlier go out first, polled into TXREG here while the transmit interrupt is not serviced */
+    while (EUSART_TxHead != EUSART_TxTail)
+    {
+        if ((!EUSART_PrivTxInterruptServiced()) && (1 == INTI_EUSART_TxFlag()))
+        {
+            EUSART_TxLoadNextFrame();
+        }
+    }
+    #endif
+
     switch (InitPtr->TxDataFrame)
     {
         case EUSART_TX_DATA_FRAME_8BIT:
@@ -205,10 +263,122 @@ Std_ReturnType EUSART_SendDataFrameBlocking(const EUSART_InitTypeDef * const Ini
     return loc_ret;
 }
 
-Std_ReturnType EUSART_SendDataFrameNonBlocking(const EUSART_InitTypeDef * const InitPtr, const uint16 Data);
+Std_ReturnType EUSART_SendDataFrameNonBlocking(const EUSART_InitTypeDef * const InitPtr, const uint16 Data)
+{
+    Std_ReturnType loc_ret = E_OK;
 
-Std_ReturnType EUSART_SendStringBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String);
-Std_ReturnType EUSART_SendStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String);
+    if ((NULL_PTR != InitPtr) && (EUSART_NO_PARITY == InitPtr->Parity) && (InitPtr->TxDataFrame < EUSART_TX_DATA_FRAME_LIMIT))
+    {
+        loc_ret = EUSART_SendFrame(InitPtr, Data);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EUSART_SendStringBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != String))
+    {
+        for (loc_index = 0; ('\0' != String[loc_index]) && (E_OK == loc_ret); loc_index++)
+        {
+            loc_ret = EUSART_SendDataFrameBlocking(InitPtr, String[loc_index]);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EUSART_SendStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_length = 0;
+#if (EUSART_TX_BUFFER == STD_ON)
+    uint8 loc_index = 0;
+#endif
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != String) && (EUSART_NO_PARITY == InitPtr->Parity) && (InitPtr->TxDataFrame < EUSART_TX_DATA_FRAME_LIMIT))
+    {
+        while (('\0' != String[loc_length]) && (loc_length < 0xFF))
+        {
+            loc_length++;
+        }
+
+    #if (EUSART_TX_BUFFER == STD_ON)
+        /* The string is queued whole or not at all, so a full buffer never truncates it */
+        if (loc_length <= (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(EUSART_TxHead - EUSART_TxTail)))
+        {
+            for (loc_index = 0; loc_index < loc_length; loc_index++)
+            {
+                EUSART_TxBuffer[EUSART_TxHead & (EUSART_TX_BUFFER_SIZE - 1)] = String[loc_index];
+                EUSART_TxHead++;
+            }
+
+            if (loc_length > 0)
+            {
+                INTI_EUSART_EnableTxInterrupt();
+            }
+        }
+        else
+        {
+            EUSART_TxOverflowCounter++;
+            loc_ret = E_NOT_OK;
+        }
+    #else
+        /* Without the transmit buffer the string is sent across calls, as many frames as TXREG takes per call */
+        while ((EUSART_TxStringCounter < loc_length) &&
+               (E_OK == EUSART_SendFrame(InitPtr, String[EUSART_TxStringCounter])))
+        {
+            EUSART_TxStringCounter++;
+        }
+
+        if (EUSART_TxStringCounter >= loc_length)
+        {
+            EUSART_TxStringCounter = 0;
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+    #endif
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType EUSART_SendIntBlocking(const EUSART_InitTypeDef * const InitPtr, const sint32 Data)
+{
+    uint8 loc_buffer[FORMAT_BUFFER_SIZE];
+    Std_ReturnType loc_ret = FORMAT_Sint32(Data, 0, ' ', loc_buffer, NULL_PTR);
+
+    loc_ret |= EUSART_SendStringBlocking(InitPtr, loc_buffer);
+
+    return loc_ret;
+}
+
+Std_ReturnType EUSART_SendIntNonBlocking(const EUSART_InitTypeDef * const InitPtr, const sint32 Data)
+{
+    uint8 loc_buffer[FORMAT_BUFFER_SIZE];
+    Std_ReturnType loc_ret = FORMAT_Sint32(Data, 0, ' ', loc_buffer, NULL_PTR);
+
+    loc_ret |= EUSART_SendStringNonBlocking(InitPtr, loc_buffer);
+
+    return loc_ret;
+}
 
 Std_ReturnType EUSART_ReadDataFrameBlocking(const EUSART_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr)
 {
@@ -222,9 +392,7 @@ Std_ReturnType EUSART_ReadDataFrameBlocking(const EUSART_InitTypeDef * const Ini
             {
                 case EUSART_NO_PARITY:
                     
-                    while (!INTI_EUSART_RxFlag());
-                    
-                    *DataBufferPtr = (uint8)(EUSART_PrivReadRegister);
+                    while (E_OK != EUSART_ReceiveFrame(InitPtr, DataBufferPtr));
 
                     break;  
 
@@ -242,10 +410,7 @@ Std_ReturnType EUSART_ReadDataFrameBlocking(const EUSART_InitTypeDef * const Ini
 
         case EUSART_RX_DATA_FRAME_9BIT:
 
-                while (!INTI_EUSART_RxFlag());
-
-                *DataBufferPtr = (uint16)(EUSART_PrivReadRxNinthBit() << 8);
-                *DataBufferPtr |= (uint8)(EUSART_PrivReadRegister);
+                while (E_OK != EUSART_ReceiveFrame(InitPtr, DataBufferPtr));
 
             break;
 
@@ -256,7 +421,21 @@ Std_ReturnType EUSART_ReadDataFrameBlocking(const EUSART_InitTypeDef * const Ini
     return loc_ret;
 }
 
-Std_ReturnType EUSART_ReadDataFrameNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr);
+Std_ReturnType EUSART_ReadDataFrameNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr) && (EUSART_NO_PARITY == InitPtr->Parity) && (InitPtr->RxDataFrame < EUSART_RX_DATA_FRAME_LIMIT))
+    {
+        loc_ret = EUSART_ReceiveFrame(InitPtr, DataBufferPtr);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
 
 Std_ReturnType EUSART_ReadStringBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr, const uint8 maxLen)
 {
@@ -264,6 +443,7 @@ Std_ReturnType EUSART_ReadStringBlocking(const EUSART_InitTypeDef * const InitPt
 
     uint8 loc_charCounter = 0;
     volatile uint8 loc_buffer = 0;
+    uint16 loc_frame = 0;
 
     switch (InitPtr->RxDataFrame)
     {
@@ -275,8 +455,8 @@ Std_ReturnType EUSART_ReadStringBlocking(const EUSART_InitTypeDef * const InitPt
                     
                     do
                     {
-                        while (!(INTI_EUSART_RxFlag()));
-                        loc_buffer = EUSART_PrivReadRegister;
+                        while (E_OK != EUSART_ReceiveFrame(InitPtr, &loc_frame));
+                        loc_buffer = (uint8)loc_frame;
 
                         if ((loc_buffer == BACKSPACE) && (loc_charCounter > 0))
                         {
@@ -312,7 +492,225 @@ Std_ReturnType EUSART_ReadStringBlocking(const EUSART_InitTypeDef * const InitPt
     return loc_ret;
 }
 
-Std_ReturnType EUSART_ReadStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr, const uint8 maxLen);
+Std_ReturnType EUSART_ReadStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr, const uint8 maxLen)
+{
+    Std_ReturnType loc_ret = E_NOT_OK;
+    uint16 loc_frame = 0;
+    uint8 loc_buffer = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr) && (EUSART_NO_PARITY == InitPtr->Parity) && (EUSART_RX_DATA_FRAME_8BIT == InitPtr->RxDataFrame))
+    {
+        /* The line is edited across calls, E_OK is returned once it is terminated by ENTER or maxLen */
+        while ((E_NOT_OK == loc_ret) && (E_OK == EUSART_ReceiveFrame(InitPtr, &loc_frame)))
+        {
+            loc_buffer = (uint8)loc_frame;
+
+            if ((loc_buffer == BACKSPACE) && (EUSART_RxStringCounter > 0))
+            {
+                EUSART_RxStringCounter--;
+            }
+
+            if ((loc_buffer != ENTER) && (loc_buffer != BACKSPACE))
+            {
+                DataBufferPtr[EUSART_RxStringCounter++] = loc_buffer;
+            }
+
+            if ((loc_buffer == ENTER) || (EUSART_RxStringCounter >= maxLen))
+            {
+                DataBufferPtr[EUSART_RxStringCounter] = '\0';
+                EUSART_RxStringCounter = 0;
+                loc_ret = E_OK;
+            }
+        }
+    }
+
+    return loc_ret;
+}
+
+#if (EUSART_TX_BUFFER == STD_ON)
+Std_ReturnType EUSART_GetTxFreeSpace(uint8 * const FreeSpacePtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != FreeSpacePtr)
+    {
+        *FreeSpacePtr = (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(EUSART_TxHead - EUSART_TxTail));
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
+#if (EUSART_RX_BUFFER == STD_ON)
+Std_ReturnType EUSART_GetRxAvailable(uint8 * const AvailablePtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != AvailablePtr)
+    {
+        *AvailablePtr = (uint8)(EUSART_RxHead - EUSART_RxTail);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
+#if (EUSART_TX_BUFFER == STD_ON) || (EUSART_RX_BUFFER == STD_ON)
+Std_ReturnType EUSART_GetOverflowCounters(uint16 * const TxOverflowPtr, uint16 * const RxOverflowPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_gie = 0;
+
+    if ((NULL_PTR != TxOverflowPtr) && (NULL_PTR != RxOverflowPtr))
+    {
+        /* The counters are 16-bit, the ISR must not update them halfway through the read */
+        loc_gie = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+
+        #if (EUSART_TX_BUFFER == STD_ON)
+        *TxOverflowPtr = EUSART_TxOverflowCounter;
+        EUSART_TxOverflowCounter = 0;
+        #else
+        *TxOverflowPtr = 0;
+        #endif
+
+        #if (EUSART_RX_BUFFER == STD_ON)
+        *RxOverflowPtr = EUSART_RxOverflowCounter;
+        EUSART_RxOverflowCounter = 0;
+        #else
+        *RxOverflowPtr = 0;
+        #endif
+
+        INTCONbits.GIE = loc_gie;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+#endif
+
+static Std_ReturnType EUSART_SendFrame(const EUSART_InitTypeDef * const loc_initPtr, const uint16 loc_data)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+#if (EUSART_TX_BUFFER == STD_ON)
+    (void)loc_initPtr;
+
+    if ((uint8)(EUSART_TxHead - EUSART_TxTail) < EUSART_TX_BUFFER_SIZE)
+    {
+        EUSART_TxBuffer[EUSART_TxHead & (EUSART_TX_BUFFER_SIZE - 1)] = (EUSART_FrameTypeDef)loc_data;
+        EUSART_TxHead++;
+
+        INTI_EUSART_EnableTxInterrupt();
+    }
+    else
+    {
+        EUSART_TxOverflowCounter++;
+        loc_ret = E_NOT_OK;
+    }
+#else
+    if (1 == INTI_EUSART_TxFlag())
+    {
+        if (EUSART_TX_DATA_FRAME_9BIT == loc_initPtr->TxDataFrame)
+        {
+            EUSART_PrivSendTxNinthBit(((loc_data >> 8) & 1));
+        }
+
+        EUSART_PrivSendRegister = (uint8)(loc_data & 0xFF);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+#endif
+
+    return loc_ret;
+}
+
+static Std_ReturnType EUSART_ReceiveFrame(const EUSART_InitTypeDef * const loc_initPtr, uint16 * const loc_data)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+#if (EUSART_RX_BUFFER == STD_ON)
+    (void)loc_initPtr;
+
+    if (EUSART_RxHead != EUSART_RxTail)
+    {
+        *loc_data = EUSART_RxBuffer[EUSART_RxTail & (EUSART_RX_BUFFER_SIZE - 1)];
+        EUSART_RxTail++;
+    }
+    else if (!EUSART_PrivRxInterruptServiced())
+    {
+        /* Nothing fills the receive buffer while the receive interrupt is not serviced, RCREG is polled instead */
+        loc_ret = EUSART_ReadReceiveRegister(loc_initPtr, loc_data);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+#else
+    loc_ret = EUSART_ReadReceiveRegister(loc_initPtr, loc_data);
+#endif
+
+    return loc_ret;
+}
+
+static Std_ReturnType EUSART_ReadReceiveRegister(const EUSART_InitTypeDef * const loc_initPtr, uint16 * const loc_data)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (1 == INTI_EUSART_RxFlag())
+    {
+        *loc_data = 0;
+
+        if (EUSART_RX_DATA_FRAME_9BIT == loc_initPtr->RxDataFrame)
+        {
+            *loc_data = (uint16)(EUSART_PrivReadRxNinthBit() << 8);
+        }
+
+        *loc_data |= (uint8)(EUSART_PrivReadRegister);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    /* An overrun stops the reception until the receiver is reset */
+    if (1 == EUSART_PrivOverrunErrorStatus())
+    {
+        EUSART_PrivDisableRx();
+        EUSART_PrivEnableRx();
+    }
+
+    return loc_ret;
+}
+
+#if (EUSART_TX_BUFFER == STD_ON)
+static void EUSART_TxLoadNextFrame(void)
+{
+    EUSART_FrameTypeDef loc_frame = EUSART_TxBuffer[EUSART_TxTail & (EUSART_TX_BUFFER_SIZE - 1)];
+
+    EUSART_TxTail++;
+
+    if (TRUE == EUSART_TxNinthBit)
+    {
+        EUSART_PrivSendTxNinthBit(((loc_frame >> 8) & 1));
+    }
+
+    EUSART_PrivSendRegister = (uint8)(loc_frame & 0xFF);
+}
+#endif
 
 static Std_ReturnType EUSART_InitBaudRate(const EUSART_InitTypeDef * const loc_initPtr, const uint32 loc_baudrate)
 {
@@ -419,26 +817,76 @@ static Std_ReturnType EUSART_DeInitInterruptHandlers(void)
 #if (INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE == STD_ON)
 void EUSART_RX_ISR(void)
 {
-    if (NULL_PTR != EUSART_RxInterruptHandler)
+    EUSART_FrameTypeDef loc_frame = 0;
+    boolean loc_frameError = FALSE;
+
+    /* The receive FIFO holds up to two frames */
+    while (1 == INTI_EUSART_RxFlag())
     {
-        EUSART_RxInterruptHandler();
+        /* FERR and RX9D belong to the frame on top of the FIFO, they are read before RCREG */
+        loc_frameError = EUSART_PrivFramingErrorStatus();
+
+        #if (EUSART_BUFFER_9BIT_FRAMES == STD_ON)
+        loc_frame = (EUSART_FrameTypeDef)(EUSART_PrivReadRxNinthBit() << 8);
+        #endif
+
+        loc_frame |= EUSART_PrivReadRegister;
+
+        if (TRUE == loc_frameError)
+        {
+            if (NULL_PTR != EUSART_FrameErrorInterruptHandler)
+            {
+                EUSART_FrameErrorInterruptHandler();
+            }
+        }
+        else if ((uint8)(EUSART_RxHead - EUSART_RxTail) < EUSART_RX_BUFFER_SIZE)
+        {
+            EUSART_RxBuffer[EUSART_RxHead & (EUSART_RX_BUFFER_SIZE - 1)] = loc_frame;
+            EUSART_RxHead++;
+        }
+        else
+        {
+            EUSART_RxOverflowCounter++;
+        }
+
+        loc_frame = 0;
     }
 
-    if (NULL_PTR != EUSART_FrameErrorInterruptHandler)
+    if (1 == EUSART_PrivOverrunErrorStatus())
     {
-        EUSART_FrameErrorInterruptHandler();
+        EUSART_RxOverflowCounter++;
+
+        /* An overrun stops the reception until the receiver is reset */
+        EUSART_PrivDisableRx();
+        EUSART_PrivEnableRx();
+
+        if (NULL_PTR != EUSART_OverrunErrorInterruptHandler)
+        {
+            EUSART_OverrunErrorInterruptHandler();
+        }
     }
 
-    if (NULL_PTR != EUSART_OverrunErrorInterruptHandler)
+    if (NULL_PTR != EUSART_RxInterruptHandler)
     {
-        EUSART_OverrunErrorInterruptHandler();
-    }    
+        EUSART_RxInterruptHandler();
+    }
 }
 #endif
 
 #if (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON)
 void EUSART_TX_ISR(void)
 {
+    /* TXIF is set, TXREG is empty */
+    if (EUSART_TxHead != EUSART_TxTail)
+    {
+        EUSART_TxLoadNextFrame();
+    }
+
+    if (EUSART_TxHead == EUSART_TxTail)
+    {
+        INTI_EUSART_DisableTxInterrupt();
+    }
+
     if (NULL_PTR != EUSART_TxInterruptHandler)
     {
         EUSART_TxInterruptHandler();
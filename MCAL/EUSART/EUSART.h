@@ -2,10 +2,18 @@
  * @file EUSART.h
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
  * 
- * @brief 
- * 
- * @version 0.1
- * @date 23.08.23
+ * @brief Enhanced Universal Synchronous Asynchronous Receiver Transmitter (EUSART) Interface
+ *
+ * With INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE enabled, transmitted frames are queued in a ring buffer drained by
+ * EUSART_TX_ISR(). With INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE enabled, received frames are queued by
+ * EUSART_RX_ISR() in a ring buffer the read interfaces take them from. The NonBlocking interfaces never wait: they
+ * return E_NOT_OK when the transmit buffer is full or no frame has been received. Without the interrupt features
+ * they poll the EUSART once instead, and EUSART_SendStringNonBlocking() sends the string across calls, returning
+ * E_OK once its last frame is in TXREG. The Blocking interfaces poll TXIF/TRMT and RCIF themselves while the
+ * EUSART interrupts are not serviced (e.g. GIE clear), so they also work with the buffers before interrupts are on.
+ *
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _EUSART_H_
@@ -13,6 +21,19 @@
 
 #include "../Interrupts/Interrupts.h"
 #include "EUSART_Config.h"
+#include "../../lib/FORMAT/FORMAT.h"
+
+#if (INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON) && (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON)
+#define EUSART_TX_BUFFER                                        STD_ON
+#else
+#define EUSART_TX_BUFFER                                        STD_OFF
+#endif
+
+#if (INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON) && (INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE == STD_ON)
+#define EUSART_RX_BUFFER                                        STD_ON
+#else
+#define EUSART_RX_BUFFER                                        STD_OFF
+#endif
 
 typedef enum
 {
@@ -113,10 +134,40 @@ Std_ReturnType EUSART_SendDataFrameNonBlocking(const EUSART_InitTypeDef * const
 Std_ReturnType EUSART_SendStringBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String);
 Std_ReturnType EUSART_SendStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const String);
 
+/**
+ * @brief Sends an integer in decimal, formatted by FORMAT_Sint32() and sent as by the matching EUSART_SendString.
+ */
+Std_ReturnType EUSART_SendIntBlocking(const EUSART_InitTypeDef * const InitPtr, const sint32 Data);
+Std_ReturnType EUSART_SendIntNonBlocking(const EUSART_InitTypeDef * const InitPtr, const sint32 Data);
+
 Std_ReturnType EUSART_ReadDataFrameBlocking(const EUSART_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr);
 Std_ReturnType EUSART_ReadDataFrameNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint16 * const DataBufferPtr);
 
 Std_ReturnType EUSART_ReadStringBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr, const uint8 maxLen);
 Std_ReturnType EUSART_ReadStringNonBlocking(const EUSART_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr, const uint8 maxLen);
 
+#if (EUSART_TX_BUFFER == STD_ON)
+/**
+ * @brief Retrieves the number of frames that can still be queued for transmission.
+ */
+Std_ReturnType EUSART_GetTxFreeSpace(uint8 * const FreeSpacePtr);
+#endif
+
+#if (EUSART_RX_BUFFER == STD_ON)
+/**
+ * @brief Retrieves the number of received frames waiting to be read.
+ */
+Std_ReturnType EUSART_GetRxAvailable(uint8 * const AvailablePtr);
+#endif
+
+#if (EUSART_TX_BUFFER == STD_ON) || (EUSART_RX_BUFFER == STD_ON)
+/**
+ * @brief Retrieves and clears the overflow counters.
+ *
+ * The transmit counter is incremented for every frame refused because the transmit buffer was full, the receive
+ * counter for every frame lost because the receive buffer was full or the EUSART overran.
+ */
+Std_ReturnType EUSART_GetOverflowCounters(uint16 * const TxOverflowPtr, uint16 * const RxOverflowPtr);
+#endif
+
 #endif /* _EUSART_H_ */
\ No newline at end of file
@@ -4,8 +4,8 @@
  * 
  * @brief 
  * 
- * @version 0.1
- * @date 23.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _EUSART_CONFIG_H_
@@ -23,4 +23,38 @@
 #warning "'EUSART_SYNCHRONOUS_MODE' not configured in EUSART_Config.h"
 #endif
 
+/**
+ * @def EUSART_TX_BUFFER_SIZE
+ * @brief Number of frames of the transmit ring buffer, a power of two from 2 to 128.
+ *        Used when INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE is STD_ON.
+ */
+#define EUSART_TX_BUFFER_SIZE                                   32
+
+/**
+ * @def EUSART_RX_BUFFER_SIZE
+ * @brief Number of frames of the receive ring buffer, a power of two from 2 to 128.
+ *        Used when INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE is STD_ON.
+ */
+#define EUSART_RX_BUFFER_SIZE                                   32
+
+/**
+ * @def EUSART_BUFFER_9BIT_FRAMES
+ * @brief Control macro to size the ring buffer entries for 9-bit frames.
+ *     - STD_ON: Entries hold 9-bit frames (2 bytes per entry).
+ *     - STD_OFF: Entries hold 8-bit frames (1 byte per entry), the ninth bit is dropped.
+ */
+#define EUSART_BUFFER_9BIT_FRAMES                               STD_OFF
+
+#if ((EUSART_TX_BUFFER_SIZE < 2) || (EUSART_TX_BUFFER_SIZE > 128) || ((EUSART_TX_BUFFER_SIZE & (EUSART_TX_BUFFER_SIZE - 1)) != 0))
+#error "'EUSART_TX_BUFFER_SIZE' must be a power of two from 2 to 128 in EUSART_Config.h"
+#endif
+
+#if ((EUSART_RX_BUFFER_SIZE < 2) || (EUSART_RX_BUFFER_SIZE > 128) || ((EUSART_RX_BUFFER_SIZE & (EUSART_RX_BUFFER_SIZE - 1)) != 0))
+#error "'EUSART_RX_BUFFER_SIZE' must be a power of two from 2 to 128 in EUSART_Config.h"
+#endif
+
+#if ((EUSART_BUFFER_9BIT_FRAMES != STD_ON) && (EUSART_BUFFER_9BIT_FRAMES != STD_OFF))
+#warning "'EUSART_BUFFER_9BIT_FRAMES' not configured in EUSART_Config.h"
+#endif
+
 #endif /* _EUSART_CONFIG_H_ */
\ No newline at end of file
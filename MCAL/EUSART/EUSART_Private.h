@@ -13,6 +13,8 @@
 
 #include "../mcu_registers.h"
 #include "../mcu_config.h"
+#include "../../lib/Std_Types.h"
+#include "EUSART_Config.h"
 
 #define ENTER                                                        0x0D
 #define BACKSPACE                                                    0x08
@@ -59,6 +61,20 @@
 #define EUSART_PrivReadRegister                                     (RCREG)
 #define EUSART_PrivSendRegister                                     (TXREG)
 
+/* An interrupt is serviced once enabled with GIE/GIEH and either PEIE/GIEL or, with IPEN, a high priority */
+#define EUSART_PrivTxInterruptServiced()                            ((1 == INTCONbits.GIE) && (1 == PIE1bits.TXIE) &&\
+                                                                     ((1 == INTCONbits.PEIE) ||\
+                                                                      ((1 == RCONbits.IPEN) && (1 == IPR1bits.TXIP))))
+#define EUSART_PrivRxInterruptServiced()                            ((1 == INTCONbits.GIE) && (1 == PIE1bits.RCIE) &&\
+                                                                     ((1 == INTCONbits.PEIE) ||\
+                                                                      ((1 == RCONbits.IPEN) && (1 == IPR1bits.RCIP))))
+
+#if (EUSART_BUFFER_9BIT_FRAMES == STD_ON)
+typedef uint16                                                      EUSART_FrameTypeDef;
+#else
+typedef uint8                                                       EUSART_FrameTypeDef;
+#endif
+
      
 
 #endif /* _EUSART_PRIVATE_H_ */
\ No newline at end of file
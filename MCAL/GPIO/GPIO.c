@@ -1,16 +1,26 @@
 /**
  * @file GPIO.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.3
- * @date 22.07.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #include "GPIO_Private.h"
 #include "GPIO.h"
 
-static volatile uint8 * const TRIS[NUMBER_OF_PORTS] = {&TRISA, &TRISB, &TRISC, &TRISD, &TRISE};
-static volatile uint8 * const PORT[NUMBER_OF_PORTS] = {&PORTA, &PORTB, &PORTC, &PORTD, &PORTE};
-static volatile uint8 * const LAT[NUMBER_OF_PORTS]  = {&LATA,  &LATB,  &LATC,  &LATD,  &LATE };
+static volatile uint8 * const TRIS[NUMBER_OF_PORTS] = {MCU_SFR_ADDRESS(TRISA), MCU_SFR_ADDRESS(TRISB),
+                                                       MCU_SFR_ADDRESS(TRISC), MCU_SFR_ADDRESS(TRISD),
+                                                       MCU_SFR_ADDRESS(TRISE)};
+static volatile uint8 * const PORT[NUMBER_OF_PORTS] = {MCU_SFR_ADDRESS(PORTA), MCU_SFR_ADDRESS(PORTB),
+                                                       MCU_SFR_ADDRESS(PORTC), MCU_SFR_ADDRESS(PORTD),
+                                                       MCU_SFR_ADDRESS(PORTE)};
+static volatile uint8 * const LAT[NUMBER_OF_PORTS]  = {MCU_SFR_ADDRESS(LATA),  MCU_SFR_ADDRESS(LATB),
+                                                       MCU_SFR_ADDRESS(LATC),  MCU_SFR_ADDRESS(LATD),
+                                                       MCU_SFR_ADDRESS(LATE)};
+
+#if (GPIO_PORT_INTERFACES == STD_ON) || (GPIO_BUS_INTERFACES == STD_ON)
+static void GPIO_WriteRegisterMasked(volatile uint8 * const loc_register, const uint8 loc_mask, const uint8 loc_value);
+#endif
 
 #if (GPIO_CHANNEL_INTERFACES == STD_ON)
 Std_ReturnType GPIO_InitChannel(const GPIO_InitTypeDef * const loc_channel)
@@ -60,11 +70,11 @@ Std_ReturnType GPIO_SetChannelDirection(const GPIO_InitTypeDef * const loc_chann
         switch(loc_direction)
         {
             case GPIO_OUTPUT:
-                CLR_BIT(loc_channel->Pin, *TRIS[loc_channel->Port]);
+                CLR_BIT(loc_channel->Pin, MCU_SFR(TRIS[loc_channel->Port]));
                 break;
             
             case GPIO_INPUT:
-                SET_BIT(loc_channel->Pin, *TRIS[loc_channel->Port]);
+                SET_BIT(loc_channel->Pin, MCU_SFR(TRIS[loc_channel->Port]));
                 break;
                 
             default: loc_ret = E_NOT_OK;
@@ -87,11 +97,11 @@ Std_ReturnType GPIO_SetChannelLogic(const GPIO_InitTypeDef * const loc_channel,
         switch(loc_logic)
         {
             case GPIO_LOW:
-                CLR_BIT(loc_channel->Pin, *LAT[loc_channel->Port]);
+                CLR_BIT(loc_channel->Pin, MCU_SFR(LAT[loc_channel->Port]));
                 break;
             
             case GPIO_HIGH:
-                SET_BIT(loc_channel->Pin, *LAT[loc_channel->Port]);
+                SET_BIT(loc_channel->Pin, MCU_SFR(LAT[loc_channel->Port]));
                 break;
                 
             default: loc_ret = E_NOT_OK;
@@ -111,7 +121,7 @@ Std_ReturnType GPIO_ToggleChannelLogic(const GPIO_InitTypeDef * const loc_channe
     
     if ((NULL != loc_channel) && (loc_channel->Direction == GPIO_OUTPUT) && (loc_channel->Port < NUMBER_OF_PORTS) && (loc_channel->Pin < NUMBER_OF_PINS_PER_PORT))
     {
-        TOG_BIT(loc_channel->Pin, *LAT[loc_channel->Port]);
+        TOG_BIT(loc_channel->Pin, MCU_SFR(LAT[loc_channel->Port]));
     }
     else
     {
@@ -127,7 +137,7 @@ Std_ReturnType GPIO_RefreshChannelDirection(GPIO_InitTypeDef * const loc_channel
     
     if ((NULL != loc_channel) && (loc_channel->Port < NUMBER_OF_PORTS) && (loc_channel->Pin < NUMBER_OF_PINS_PER_PORT))
     {
-        loc_channel->Direction = GET_BIT(loc_channel->Pin, *TRIS[loc_channel->Port]);
+        loc_channel->Direction = GET_BIT(loc_channel->Pin, MCU_SFR(TRIS[loc_channel->Port]));
     }
     else
     {
@@ -143,7 +153,7 @@ Std_ReturnType GPIO_GetChannelDirection(const GPIO_InitTypeDef * const loc_chann
     
     if ((NULL != loc_channel) && (NULL != loc_direction_ret) && (loc_channel->Port < NUMBER_OF_PORTS) && (loc_channel->Pin < NUMBER_OF_PINS_PER_PORT))
     {
-        *loc_direction_ret = GET_BIT(loc_channel->Pin, *TRIS[loc_channel->Port]);
+        *loc_direction_ret = GET_BIT(loc_channel->Pin, MCU_SFR(TRIS[loc_channel->Port]));
     }
     else
     {
@@ -159,7 +169,7 @@ Std_ReturnType GPIO_RefreshChannelLogic(GPIO_InitTypeDef * const loc_channel)
     
     if ((NULL != loc_channel) && (loc_channel->Port < NUMBER_OF_PORTS) && (loc_channel->Pin < NUMBER_OF_PINS_PER_PORT))
     {
-        loc_channel->Logic = GET_BIT(loc_channel->Pin, *PORT[loc_channel->Port]);
+        loc_channel->Logic = GET_BIT(loc_channel->Pin, MCU_SFR(PORT[loc_channel->Port]));
     }
     else
     {
@@ -175,7 +185,7 @@ Std_ReturnType GPIO_GetChannelLogic(const GPIO_InitTypeDef * const loc_channel,
     
     if ((NULL != loc_channel) && (NULL != loc_logic_ret) && (loc_channel->Port < NUMBER_OF_PORTS) && (loc_channel->Pin < NUMBER_OF_PINS_PER_PORT))
     {
-        *loc_logic_ret = GET_BIT(loc_channel->Pin, *PORT[loc_channel->Port]);
+        *loc_logic_ret = GET_BIT(loc_channel->Pin, MCU_SFR(PORT[loc_channel->Port]));
     }
     else
     {
@@ -193,7 +203,7 @@ Std_ReturnType GPIO_SetPortDirection(const GPIO_PortTypeDef loc_port, const uint
     
     if (loc_port < NUMBER_OF_PORTS)
     {
-        *TRIS[loc_port] = loc_direction_mask;
+        MCU_SFR(TRIS[loc_port]) = loc_direction_mask;
     }
     else
     {
@@ -209,7 +219,23 @@ Std_ReturnType GPIO_SetPortLogic(const GPIO_PortTypeDef loc_port, const uint8 lo
     
     if (loc_port < NUMBER_OF_PORTS)
     {
-        *LAT[loc_port] = loc_logic_mask;
+        MCU_SFR(LAT[loc_port]) = loc_logic_mask;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+    
+    return loc_ret;
+}
+
+Std_ReturnType GPIO_WritePortMasked(const GPIO_PortTypeDef loc_port, const uint8 loc_mask, const uint8 loc_value)
+{
+    Std_ReturnType loc_ret = E_OK;
+    
+    if (loc_port < NUMBER_OF_PORTS)
+    {
+        GPIO_WriteRegisterMasked(LAT[loc_port], loc_mask, loc_value);
     }
     else
     {
@@ -225,7 +251,7 @@ Std_ReturnType GPIO_TogglePortLogic(const GPIO_PortTypeDef loc_port)
     
     if (loc_port < NUMBER_OF_PORTS)
     {
-        *LAT[loc_port] ^= GPIO_ALL_PINS;
+        MCU_SFR(LAT[loc_port]) ^= GPIO_ALL_PINS;
     }
     else
     {
@@ -241,7 +267,7 @@ Std_ReturnType GPIO_GetPortDirection(const GPIO_PortTypeDef loc_port, uint8 * co
     
     if ((NULL != loc_direction_ret) && (loc_port < NUMBER_OF_PORTS))
     {
-        *loc_direction_ret = *TRIS[loc_port];
+        *loc_direction_ret = MCU_SFR(TRIS[loc_port]);
     }
     else
     {
@@ -257,7 +283,7 @@ Std_ReturnType GPIO_GetPortLogic(const GPIO_PortTypeDef loc_port, uint8 * const
     
     if ((NULL != loc_logic_ret) && (loc_port < NUMBER_OF_PORTS))
     {
-        *loc_logic_ret = *LAT[loc_port];
+        *loc_logic_ret = MCU_SFR(LAT[loc_port]);
     }
     else
     {
@@ -267,4 +293,189 @@ Std_ReturnType GPIO_GetPortLogic(const GPIO_PortTypeDef loc_port, uint8 * const
     return loc_ret;   
 }
 #endif
- 
\ No newline at end of file
+ 
+
+#if (GPIO_BUS_INTERFACES == STD_ON)
+Std_ReturnType GPIO_BusInit(GPIO_BusTypeDef * const loc_bus)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_used[NUMBER_OF_PORTS] = {0};
+    uint8 loc_bit = 0;
+    uint8 loc_index = 0;
+    GPIO_BusPortTypeDef *loc_port = NULL;
+    
+    if ((NULL != loc_bus) && (loc_bus->Width > 0) && (loc_bus->Width <= GPIO_BUS_MAX_WIDTH))
+    {
+        loc_bus->NumberOfPorts = 0;
+        
+        for (loc_bit = 0; (loc_bit < loc_bus->Width) && (E_OK == loc_ret); loc_bit++)
+        {
+            if ((loc_bus->Pins[loc_bit].Port < NUMBER_OF_PORTS) && (0 == GET_BIT(loc_bus->Pins[loc_bit].Pin, loc_used[loc_bus->Pins[loc_bit].Port])))
+            {
+                SET_BIT(loc_bus->Pins[loc_bit].Pin, loc_used[loc_bus->Pins[loc_bit].Port]);
+                
+                /* Ports are listed in order of first use */
+                for (loc_index = 0; (loc_index < loc_bus->NumberOfPorts) && (loc_bus->Ports[loc_index].Port != loc_bus->Pins[loc_bit].Port); loc_index++);
+                
+                loc_port = &(loc_bus->Ports[loc_index]);
+                
+                if (loc_index == loc_bus->NumberOfPorts)
+                {
+                    loc_bus->NumberOfPorts++;
+                    loc_port->Port = loc_bus->Pins[loc_bit].Port;
+                    loc_port->PinMask = 0;
+                    loc_port->WordMask = 0;
+                    loc_port->Shift = (sint8)loc_bus->Pins[loc_bit].Pin - (sint8)loc_bit;
+                }
+                else if (loc_port->Shift != ((sint8)loc_bus->Pins[loc_bit].Pin - (sint8)loc_bit))
+                {
+                    loc_port->Shift = GPIO_BUS_SCATTERED;
+                }
+                
+                SET_BIT(loc_bus->Pins[loc_bit].Pin, loc_port->PinMask);
+                SET_BIT(loc_bit, loc_port->WordMask);
+            }
+            else
+            {
+                loc_ret = E_NOT_OK;
+            }
+        }
+        
+        if (E_OK == loc_ret)
+        {
+            loc_ret = GPIO_BusWrite(loc_bus, 0);
+            loc_ret |= GPIO_BusSetDirection(loc_bus, GPIO_OUTPUT);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+    
+    return loc_ret;
+}
+
+Std_ReturnType GPIO_BusSetDirection(const GPIO_BusTypeDef * const loc_bus, const GPIO_DirectionTypeDef loc_direction)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+    
+    if ((NULL != loc_bus) && ((GPIO_OUTPUT == loc_direction) || (GPIO_INPUT == loc_direction)))
+    {
+        for (loc_index = 0; loc_index < loc_bus->NumberOfPorts; loc_index++)
+        {
+            GPIO_WriteRegisterMasked(TRIS[loc_bus->Ports[loc_index].Port], loc_bus->Ports[loc_index].PinMask, (GPIO_INPUT == loc_direction) ? GPIO_ALL_PINS : 0);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+    
+    return loc_ret;
+}
+
+Std_ReturnType GPIO_BusWrite(const GPIO_BusTypeDef * const loc_bus, const uint8 loc_value)
+{
+    Std_ReturnType loc_ret = E_OK;
+    const GPIO_BusPortTypeDef *loc_port = NULL;
+    uint8 loc_index = 0;
+    uint8 loc_bit = 0;
+    uint8 loc_pins = 0;
+    
+    if (NULL != loc_bus)
+    {
+        for (loc_index = 0; loc_index < loc_bus->NumberOfPorts; loc_index++)
+        {
+            loc_port = &(loc_bus->Ports[loc_index]);
+            
+            if (GPIO_BUS_SCATTERED == loc_port->Shift)
+            {
+                loc_pins = 0;
+                
+                for (loc_bit = 0; loc_bit < loc_bus->Width; loc_bit++)
+                {
+                    if ((loc_bus->Pins[loc_bit].Port == loc_port->Port) && (1 == GET_BIT(loc_bit, loc_value)))
+                    {
+                        SET_BIT(loc_bus->Pins[loc_bit].Pin, loc_pins);
+                    }
+                }
+            }
+            else if (loc_port->Shift >= 0)
+            {
+                loc_pins = (uint8)((loc_value & loc_port->WordMask) << loc_port->Shift);
+            }
+            else
+            {
+                loc_pins = (uint8)((loc_value & loc_port->WordMask) >> -loc_port->Shift);
+            }
+            
+            GPIO_WriteRegisterMasked(LAT[loc_port->Port], loc_port->PinMask, loc_pins);
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+    
+    return loc_ret;
+}
+
+Std_ReturnType GPIO_BusRead(const GPIO_BusTypeDef * const loc_bus, uint8 * const loc_value_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    const GPIO_BusPortTypeDef *loc_port = NULL;
+    uint8 loc_index = 0;
+    uint8 loc_bit = 0;
+    uint8 loc_pins = 0;
+    uint8 loc_value = 0;
+    
+    if ((NULL != loc_bus) && (NULL != loc_value_ret))
+    {
+        for (loc_index = 0; loc_index < loc_bus->NumberOfPorts; loc_index++)
+        {
+            loc_port = &(loc_bus->Ports[loc_index]);
+            loc_pins = MCU_SFR(PORT[loc_port->Port]) & loc_port->PinMask;
+            
+            if (GPIO_BUS_SCATTERED == loc_port->Shift)
+            {
+                for (loc_bit = 0; loc_bit < loc_bus->Width; loc_bit++)
+                {
+                    if ((loc_bus->Pins[loc_bit].Port == loc_port->Port) && (1 == GET_BIT(loc_bus->Pins[loc_bit].Pin, loc_pins)))
+                    {
+                        SET_BIT(loc_bit, loc_value);
+                    }
+                }
+            }
+            else if (loc_port->Shift >= 0)
+            {
+                loc_value |= (uint8)(loc_pins >> loc_port->Shift);
+            }
+            else
+            {
+                loc_value |= (uint8)(loc_pins << -loc_port->Shift);
+            }
+        }
+        
+        *loc_value_ret = loc_value;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+    
+    return loc_ret;
+}
+#endif
+
+#if (GPIO_PORT_INTERFACES == STD_ON) || (GPIO_BUS_INTERFACES == STD_ON)
+static void GPIO_WriteRegisterMasked(volatile uint8 * const loc_register, const uint8 loc_mask, const uint8 loc_value)
+{
+    /* Interrupts are held off between the read and the write so an ISR driving other pins isn't overwritten */
+    uint8 loc_gie = INTCONbits.GIE;
+    
+    INTCONbits.GIE = 0;
+    MCU_SFR(loc_register) = (uint8)((MCU_SFR(loc_register) & (uint8)~loc_mask) | (loc_value & loc_mask));
+    INTCONbits.GIE = loc_gie;
+}
+#endif
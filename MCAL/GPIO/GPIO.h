@@ -15,8 +15,8 @@
  * @note The GPIO interface ensures portability and can be utilized across diverse microcontroller families
  *       and development environments.
  * 
- * @version 0.3
- * @date 22.07.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #ifndef _GPIO_H_
@@ -26,6 +26,7 @@
 #include "GPIO_Config.h"
 
 #include "../mcu_config.h"
+#include "../mcu_registers.h"
 #include "../../lib/Std_Types.h"
 
 typedef enum {GPIO_LOW = 0, GPIO_HIGH}                                                                      GPIO_LogicTypeDef;
@@ -42,6 +43,86 @@ typedef struct
     
 } GPIO_InitTypeDef;
 
+typedef struct
+{
+    uint8 Port;
+    uint8 PinMask;      /* Pins of the port driven by the bus */
+    uint8 WordMask;     /* Word bits carried by those pins */
+    sint8 Shift;        /* Pin = word bit + Shift, when the pins are in word-bit order */
+
+} GPIO_BusPortTypeDef;
+
+/**
+ * @brief Maps a logical word onto arbitrary pins, Pins[i] carries bit i of the word.
+ *
+ * Only Pins and Width are configured by the user, the per-port tables are computed by GPIO_BusInit().
+ */
+typedef struct
+{
+    GPIO_InitTypeDef Pins[GPIO_BUS_MAX_WIDTH];
+    uint8 Width;
+
+    uint8 NumberOfPorts;
+    GPIO_BusPortTypeDef Ports[NUMBER_OF_PORTS];
+
+} GPIO_BusTypeDef;
+
+/**
+ * @defgroup GPIO_PinInterfaces Compile-Time Pin Interfaces
+ *
+ * A pin descriptor names a port letter and a pin number known at compile time, e.g.
+ * `#define LCD_E_PIN GPIO_PIN(B, 2)`. The macros below resolve a descriptor to a direct `LATxbits`, `PORTxbits` or
+ * `TRISxbits` access, which XC8 emits as a single `BSF`/`BCF`/`BTG`/`BTFSC` with no call, no NULL or range check and
+ * no pointer table. Being single instructions, writes to different pins of the same port are safe from interrupts.
+ *
+ * Use them on hot paths (strobes, chip selects, bit-banged protocols). The channel interfaces taking a
+ * GPIO_InitTypeDef stay available for pins only known at run time.
+ * @{
+ */
+
+/**
+ * @brief Pin descriptor, x is the port letter (A..E) and n the pin number (0..7).
+ */
+#define GPIO_PIN(x, n)                                  x, n
+
+/**
+ * @brief Expands a pin descriptor to a GPIO_InitTypeDef initializer for the channel interfaces.
+ */
+#define GPIO_PIN_CHANNEL(Descriptor, Dir, Level)        GPIO_PIN_CHANNEL_EXPAND(Descriptor, Dir, Level)
+
+#define GPIO_PIN_OUTPUT(Descriptor)                     GPIO_PIN_DIRECTION_EXPAND(Descriptor, 0)
+#define GPIO_PIN_INPUT(Descriptor)                      GPIO_PIN_DIRECTION_EXPAND(Descriptor, 1)
+
+#define GPIO_PIN_HIGH(Descriptor)                       GPIO_PIN_WRITE_EXPAND(Descriptor, 1)
+#define GPIO_PIN_LOW(Descriptor)                        GPIO_PIN_WRITE_EXPAND(Descriptor, 0)
+
+/**
+ * @brief Writes Level (GPIO_LOW or GPIO_HIGH), only bit 0 of Level is used.
+ */
+#define GPIO_PIN_WRITE(Descriptor, Level)               GPIO_PIN_WRITE_EXPAND(Descriptor, Level)
+
+#define GPIO_PIN_TOGGLE(Descriptor)                     GPIO_PIN_TOGGLE_EXPAND(Descriptor)
+
+/**
+ * @brief Reads the pin level from the PORT register, evaluates to 0 or 1.
+ */
+#define GPIO_PIN_READ(Descriptor)                       GPIO_PIN_READ_EXPAND(Descriptor)
+
+/** @} */
+
+/* The extra expansion step splits a descriptor into its port letter and pin number before token pasting */
+#define GPIO_PIN_CHANNEL_EXPAND(...)                    GPIO_PIN_CHANNEL_PASTE(__VA_ARGS__)
+#define GPIO_PIN_DIRECTION_EXPAND(...)                  GPIO_PIN_DIRECTION_PASTE(__VA_ARGS__)
+#define GPIO_PIN_WRITE_EXPAND(...)                      GPIO_PIN_WRITE_PASTE(__VA_ARGS__)
+#define GPIO_PIN_TOGGLE_EXPAND(...)                     GPIO_PIN_TOGGLE_PASTE(__VA_ARGS__)
+#define GPIO_PIN_READ_EXPAND(...)                       GPIO_PIN_READ_PASTE(__VA_ARGS__)
+
+#define GPIO_PIN_CHANNEL_PASTE(x, n, Dir, Level)        {.Port = GPIO_PORT##x, .Pin = GPIO_PIN##n, .Direction = (Dir), .Logic = (Level)}
+#define GPIO_PIN_DIRECTION_PASTE(x, n, Dir)             (TRIS##x##bits.TRIS##x##n = (Dir))
+#define GPIO_PIN_WRITE_PASTE(x, n, Level)               (LAT##x##bits.LAT##x##n = (Level))
+#define GPIO_PIN_TOGGLE_PASTE(x, n)                     (LAT##x##bits.LAT##x##n ^= 1)
+#define GPIO_PIN_READ_PASTE(x, n)                       (PORT##x##bits.R##x##n)
+
 /** 
  * @brief Initializes a GPIO channel with the provided configuration.
  *
@@ -259,6 +340,25 @@ Std_ReturnType GPIO_SetPortDirection(const GPIO_PortTypeDef loc_port, const uint
  */
 Std_ReturnType GPIO_SetPortLogic(const GPIO_PortTypeDef loc_port, const uint8 loc_logic_mask);
 
+/** 
+ * @brief Sets the logic level of the masked pins of a GPIO port in a single latch write.
+ *
+ * The pins selected by @param loc_mask take the matching bits of @param loc_value, the other pins of the port keep
+ * their level. All the selected pins change on the same instruction, without intermediate states, and interrupts
+ * are held off between the read and the write of the LAT register so an ISR driving other pins of the same port
+ * is never overwritten.
+ *
+ * @param loc_port The GPIO port identifier (e.g., GPIO_PORTA, GPIO_PORTB, etc.).
+ * @param loc_mask The pins to be written, bit 0 represents pin 0 and so on.
+ * @param loc_value The logic levels of the masked pins, bits outside @param loc_mask are ignored.
+ * @return Std_ReturnType Error status indicating the success of setting the masked pins.
+ *     - E_OK: The masked pins were set successfully.
+ *     - E_NOT_OK: An error occurred during the process (e.g., invalid @param loc_port parameter).
+ *
+ * @note The masked pins should be configured as outputs.
+ */
+Std_ReturnType GPIO_WritePortMasked(const GPIO_PortTypeDef loc_port, const uint8 loc_mask, const uint8 loc_value);
+
 /** 
  * @brief Toggles the logic level of a GPIO port based on the provided configuration.
  *
@@ -324,4 +424,52 @@ Std_ReturnType GPIO_GetPortDirection(const GPIO_PortTypeDef loc_port, uint8 * co
  */
 Std_ReturnType GPIO_GetPortLogic(const GPIO_PortTypeDef loc_port, uint8 * const loc_logic_ret);
 
+/** 
+ * @brief Initializes a GPIO bus and configures its pins as outputs driven low.
+ *
+ * This function validates the pins of @param loc_bus and precomputes, for every port the bus spans, the pin mask,
+ * the word bits it carries and the shift between both, so GPIO_BusWrite() and GPIO_BusRead() touch each port once.
+ *
+ * @param loc_bus Pointer to the bus, Pins and Width must be set.
+ * @return Std_ReturnType Error status indicating the success of the initialization.
+ *     - E_OK: The bus was initialized successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_bus, invalid Width, invalid or duplicated pin).
+ */
+Std_ReturnType GPIO_BusInit(GPIO_BusTypeDef * const loc_bus);
+
+/** 
+ * @brief Sets the direction of all the pins of a GPIO bus, one TRIS write per port.
+ *
+ * @param loc_bus Pointer to an initialized bus.
+ * @param loc_direction The desired direction (GPIO_OUTPUT or GPIO_INPUT).
+ * @return Std_ReturnType Error status indicating the success of setting the bus direction.
+ *     - E_OK: The bus direction was set successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_bus or invalid @param loc_direction).
+ */
+Std_ReturnType GPIO_BusSetDirection(const GPIO_BusTypeDef * const loc_bus, const GPIO_DirectionTypeDef loc_direction);
+
+/** 
+ * @brief Writes a word on a GPIO bus, one LAT write per port.
+ *
+ * @param loc_bus Pointer to an initialized bus.
+ * @param loc_value The word, bit i is driven on Pins[i], bits above Width are ignored.
+ * @return Std_ReturnType Error status indicating the success of writing the bus.
+ *     - E_OK: The word was written successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_bus).
+ *
+ * @note All the pins of a port change together, see GPIO_WritePortMasked().
+ */
+Std_ReturnType GPIO_BusWrite(const GPIO_BusTypeDef * const loc_bus, const uint8 loc_value);
+
+/** 
+ * @brief Reads a word from a GPIO bus, one PORT read per port.
+ *
+ * @param loc_bus Pointer to an initialized bus.
+ * @param loc_value_ret Pointer to where the word is stored, bit i is read from Pins[i].
+ * @return Std_ReturnType Error status indicating the success of reading the bus.
+ *     - E_OK: The word was read successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param loc_bus or @param loc_value_ret).
+ */
+Std_ReturnType GPIO_BusRead(const GPIO_BusTypeDef * const loc_bus, uint8 * const loc_value_ret);
+
 #endif /* _GPIO_H_ */ 
\ No newline at end of file
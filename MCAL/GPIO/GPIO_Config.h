@@ -36,7 +36,21 @@
  *     - STD_ON: Include GPIO port interfaces in the build.
  *     - STD_OFF: Exclude GPIO port interfaces from the build.
  */
-#define GPIO_PORT_INTERFACES        STD_OFF
+#define GPIO_PORT_INTERFACES        STD_ON
+
+/** 
+ * @def GPIO_BUS_INTERFACES
+ * @brief Control macro to enable or disable GPIO bus interfaces.
+ *     - STD_ON: Include GPIO bus interfaces in the build.
+ *     - STD_OFF: Exclude GPIO bus interfaces from the build.
+ */
+#define GPIO_BUS_INTERFACES         STD_ON
+
+/** 
+ * @def GPIO_BUS_MAX_WIDTH
+ * @brief Maximum number of pins (word bits) of a GPIO bus, 1 to 8.
+ */
+#define GPIO_BUS_MAX_WIDTH          8
 
 #endif	/* _GPIO_CONFIG_H_ */
 
@@ -28,5 +28,8 @@
 
 #define GPIO_ALL_PINS       0xFF
 
+/* Marks a bus port whose pins are not in word-bit order, its bits are then placed one by one */
+#define GPIO_BUS_SCATTERED  ((sint8)-128)
+
 #endif	/* _GPIO_PRIVATE_H_ */
 
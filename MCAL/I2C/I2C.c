@@ -0,0 +1,364 @@
+/**
+ * @file I2C.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "I2C_Private.h"
+#include "I2C.h"
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+static const uint8 I2C_BaudDividers[I2C_SPEED_LIMIT] = {I2C_BAUD_DIVIDER_100KHZ, I2C_BAUD_DIVIDER_400KHZ};
+
+static I2C_TransactionTypeDef * I2C_Queue[I2C_TRANSACTION_QUEUE_SIZE];
+static volatile uint8 I2C_QueueHead = 0;
+static volatile uint8 I2C_QueueCount = 0;
+static volatile I2C_StateTypeDef I2C_State = I2C_STATE_IDLE;
+static uint8 I2C_Index = 0;                                     /* Bytes of the current part transferred */
+static I2C_StatusTypeDef I2C_Result = I2C_STATUS_DONE;
+
+static Std_ReturnType I2C_InitPins(void);
+static Std_ReturnType I2C_DeInitPins(void);
+static void I2C_BeginTransaction(void);
+static void I2C_EndTransaction(void);
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    static Std_ReturnType I2C_InitPriority(const I2C_InitTypeDef * const InitPtr);
+    #endif
+
+Std_ReturnType I2C_Init(const I2C_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (InitPtr->Speed < I2C_SPEED_LIMIT))
+    {
+        __I2C_Disable();
+
+        INTI_I2C_DisableInterrupt();
+        INTI_I2C_DisableBusCollisionInterrupt();
+
+        I2C_QueueHead = 0;
+        I2C_QueueCount = 0;
+        I2C_State = I2C_STATE_IDLE;
+
+        __I2C_ConfigMode(I2C_MODE_MASTER);
+        __I2C_ConfigBaudRate(I2C_BaudDividers[InitPtr->Speed]);
+        __I2C_ConfigSlewRateControl((I2C_SPEED_100KHZ == InitPtr->Speed) ? 1 : 0);
+        __I2C_ResetControl();
+
+        loc_ret |= I2C_InitPins();
+
+        #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+        loc_ret |= I2C_InitPriority(InitPtr);
+        #endif
+
+        INTI_I2C_ClearFlag();
+        INTI_I2C_ClearBusCollisionFlag();
+        INTI_I2C_EnableInterrupt();
+        INTI_I2C_EnableBusCollisionInterrupt();
+
+        __I2C_Enable();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType I2C_DeInit(const I2C_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (NULL_PTR != InitPtr)
+    {
+        INTI_I2C_DisableInterrupt();
+        INTI_I2C_DisableBusCollisionInterrupt();
+
+        __I2C_Disable();
+
+        I2C_QueueCount = 0;
+        I2C_State = I2C_STATE_IDLE;
+
+        loc_ret |= I2C_DeInitPins();
+
+        #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+        INTI_I2C_DeInitPriority();
+        #endif
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType I2C_AddTransaction(const I2C_InitTypeDef * const InitPtr, I2C_TransactionTypeDef * const TransactionPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = __I2C_InterruptStatus();
+    uint8 loc_collision_status = __I2C_BusCollisionInterruptStatus();
+
+    __I2C_SetInterruptStatus(0);
+    __I2C_SetBusCollisionInterruptStatus(0);
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != TransactionPtr) && (TransactionPtr->Address <= 0x7F) &&
+        ((0 == TransactionPtr->TxLength) || (NULL_PTR != TransactionPtr->TxBuffer)) &&
+        ((0 == TransactionPtr->RxLength) || (NULL_PTR != TransactionPtr->RxBuffer)) &&
+        ((0 != TransactionPtr->TxLength) || (0 != TransactionPtr->RxLength)) &&
+        (I2C_QueueCount < I2C_TRANSACTION_QUEUE_SIZE))
+    {
+        TransactionPtr->Status = I2C_STATUS_PENDING;
+
+        I2C_Queue[(I2C_QueueHead + I2C_QueueCount) & (I2C_TRANSACTION_QUEUE_SIZE - 1)] = TransactionPtr;
+        I2C_QueueCount++;
+
+        if (1 == I2C_QueueCount)
+        {
+            I2C_BeginTransaction();
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    __I2C_SetBusCollisionInterruptStatus(loc_collision_status);
+    __I2C_SetInterruptStatus(loc_status);
+
+    return loc_ret;
+}
+
+Std_ReturnType I2C_GetPendingTransactions(const I2C_InitTypeDef * const InitPtr, uint8 * const Pending_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != Pending_ret))
+    {
+        *Pending_ret = I2C_QueueCount;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+static Std_ReturnType I2C_InitPins(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    // The MSSP drives SCL and SDA as open-drain outputs, both pins are left as inputs.
+    GPIO_InitTypeDef SCL = {
+        .Pin = GPIO_PIN3,
+        .Port = GPIO_PORTC,
+        .Direction = GPIO_INPUT,
+    };
+
+    GPIO_InitTypeDef SDA = {
+        .Pin = GPIO_PIN4,
+        .Port = GPIO_PORTC,
+        .Direction = GPIO_INPUT,
+    };
+
+    loc_ret |= GPIO_InitChannel(&SCL);
+    loc_ret |= GPIO_InitChannel(&SDA);
+
+    return loc_ret;
+}
+
+static Std_ReturnType I2C_DeInitPins(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    GPIO_InitTypeDef SCL = {
+        .Pin = GPIO_PIN3,
+        .Port = GPIO_PORTC,
+    };
+
+    GPIO_InitTypeDef SDA = {
+        .Pin = GPIO_PIN4,
+        .Port = GPIO_PORTC,
+    };
+
+    loc_ret |= GPIO_DeInitChannel(&SCL);
+    loc_ret |= GPIO_DeInitChannel(&SDA);
+
+    return loc_ret;
+}
+
+/* Called with the I2C interrupts masked or from them, generates the START of the head transaction */
+static void I2C_BeginTransaction(void)
+{
+    I2C_Result = I2C_STATUS_DONE;
+    I2C_State = I2C_STATE_START;
+
+    __I2C_ClearCollisionFlags();
+    __I2C_Start();
+}
+
+static void I2C_EndTransaction(void)
+{
+    I2C_TransactionTypeDef * loc_transaction = I2C_Queue[I2C_QueueHead];
+
+    loc_transaction->Status = I2C_Result;
+
+    I2C_QueueHead = (I2C_QueueHead + 1) & (I2C_TRANSACTION_QUEUE_SIZE - 1);
+    I2C_QueueCount--;
+    I2C_State = I2C_STATE_IDLE;
+
+    // The next transaction is started first, the bus keeps running during the callback.
+    if (0 != I2C_QueueCount)
+    {
+        I2C_BeginTransaction();
+    }
+
+    if (NULL_PTR != loc_transaction->Callback)
+    {
+        loc_transaction->Callback();
+    }
+}
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    static Std_ReturnType I2C_InitPriority(const I2C_InitTypeDef * const InitPtr)
+    {
+        Std_ReturnType loc_ret = E_OK;
+
+        if (InitPtr->Priority < INTERRUPTS_PRIORITY_LIMIT)
+        {
+            INTI_I2C_SetPriority(InitPtr->Priority);
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        return loc_ret;
+    }
+    #endif
+
+void I2C_ISR(void)
+{
+    I2C_TransactionTypeDef * loc_transaction = I2C_Queue[I2C_QueueHead];
+    uint8 loc_acknowledge = 0;
+
+    INTI_I2C_ClearFlag();
+
+    // An event that comes with a bus collision is left to I2C_BCL_ISR, which ends the transaction.
+    if (0 == INTI_I2C_BusCollisionFlag())
+    {
+        switch (I2C_State)
+        {
+            case I2C_STATE_START:
+                I2C_Index = 0;
+
+                if (0 != loc_transaction->TxLength)
+                {
+                    SSPBUF = (uint8)(loc_transaction->Address << 1);
+                    I2C_State = I2C_STATE_WRITE_ADDRESS;
+                }
+                else
+                {
+                    SSPBUF = (uint8)((loc_transaction->Address << 1) | 0x01);
+                    I2C_State = I2C_STATE_READ_ADDRESS;
+                }
+                break;
+
+            case I2C_STATE_WRITE_ADDRESS:
+            case I2C_STATE_WRITE_DATA:
+                if (__I2C_isNotAcknowledged())
+                {
+                    I2C_Result = I2C_STATUS_NACK;
+                    __I2C_Stop();
+                    I2C_State = I2C_STATE_STOP;
+                }
+                else if (I2C_Index < loc_transaction->TxLength)
+                {
+                    SSPBUF = loc_transaction->TxBuffer[I2C_Index];
+                    I2C_Index++;
+                    I2C_State = I2C_STATE_WRITE_DATA;
+                }
+                else if (0 != loc_transaction->RxLength)
+                {
+                    __I2C_RepeatedStart();
+                    I2C_State = I2C_STATE_RESTART;
+                }
+                else
+                {
+                    __I2C_Stop();
+                    I2C_State = I2C_STATE_STOP;
+                }
+                break;
+
+            case I2C_STATE_RESTART:
+                I2C_Index = 0;
+                SSPBUF = (uint8)((loc_transaction->Address << 1) | 0x01);
+                I2C_State = I2C_STATE_READ_ADDRESS;
+                break;
+
+            case I2C_STATE_READ_ADDRESS:
+                if (__I2C_isNotAcknowledged())
+                {
+                    I2C_Result = I2C_STATUS_NACK;
+                    __I2C_Stop();
+                    I2C_State = I2C_STATE_STOP;
+                }
+                else
+                {
+                    __I2C_Receive();
+                    I2C_State = I2C_STATE_READ_DATA;
+                }
+                break;
+
+            case I2C_STATE_READ_DATA:
+                loc_transaction->RxBuffer[I2C_Index] = SSPBUF;
+                I2C_Index++;
+
+                // The last byte is not acknowledged, which tells the device to release SDA for the STOP.
+                loc_acknowledge = (I2C_Index < loc_transaction->RxLength) ? 0 : 1;
+                __I2C_Acknowledge(loc_acknowledge);
+                I2C_State = I2C_STATE_ACKNOWLEDGE;
+                break;
+
+            case I2C_STATE_ACKNOWLEDGE:
+                if (I2C_Index < loc_transaction->RxLength)
+                {
+                    __I2C_Receive();
+                    I2C_State = I2C_STATE_READ_DATA;
+                }
+                else
+                {
+                    __I2C_Stop();
+                    I2C_State = I2C_STATE_STOP;
+                }
+                break;
+
+            case I2C_STATE_STOP:
+                I2C_EndTransaction();
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+void I2C_BCL_ISR(void)
+{
+    INTI_I2C_ClearBusCollisionFlag();
+
+    // The MSSP has released the bus and is idle, the event of the aborted step is dropped with the transaction.
+    if (I2C_STATE_IDLE != I2C_State)
+    {
+        INTI_I2C_ClearFlag();
+        __I2C_ResetControl();
+
+        I2C_Result = I2C_STATUS_BUS_COLLISION;
+        I2C_EndTransaction();
+    }
+}
+#endif
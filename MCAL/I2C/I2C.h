@@ -0,0 +1,126 @@
+/**
+ * @file I2C.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Header file for I2C module.
+ *
+ * This header file defines the interface of the I2C master driver built on the MSSP module. Transactions are queued
+ * by the application and run by an interrupt-driven state machine, every START, address, data, repeated START,
+ * acknowledge and STOP step being completed by an MSSP interrupt, so the application never waits on the bus.
+ *
+ * @note Include this header file in your application code to access the I2C control interface.
+ * @note The driver requires the MSSP interrupts, given to I2C by INTERRUPTS_MSSP_INTERRUPTS_OWNER set to
+ *       INTERRUPTS_MSSP_I2C in Interrupts_Config.h (the default). The MSSP cannot be used for SPI at the same time.
+ * @note SCL (RC3) and SDA (RC4) need external pull-up resistors.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _I2C_H_
+#define _I2C_H_
+
+#include "../GPIO/GPIO.h"
+#include "../Interrupts/Interrupts.h"
+#include "I2C_Config.h"
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+
+typedef enum
+{
+    I2C_SPEED_100KHZ = 0,       /* Standard mode */
+    I2C_SPEED_400KHZ,           /* Fast mode */
+    I2C_SPEED_LIMIT
+
+} I2C_SpeedTypeDef;
+
+typedef enum
+{
+    I2C_STATUS_DONE = 0,
+    I2C_STATUS_PENDING,         /* Queued or in progress */
+    I2C_STATUS_NACK,            /* The address or a written byte was not acknowledged */
+    I2C_STATUS_BUS_COLLISION,   /* Another master or a stuck line took the bus */
+
+} I2C_StatusTypeDef;
+
+typedef struct
+{
+    I2C_SpeedTypeDef            Speed;
+
+#if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    INTERRUPTS_PriorityTypeDef  Priority;
+#endif
+
+} I2C_InitTypeDef;
+
+/**
+ * @brief A write-then-read transaction: the TxLength bytes are written to the device, then after a repeated START
+ *        the RxLength bytes are read from it. Either part can be empty.
+ */
+typedef struct
+{
+    uint8                       Address;        /* 7-bit device address */
+    const uint8 *               TxBuffer;
+    uint8                       TxLength;
+    uint8 *                     RxBuffer;
+    uint8                       RxLength;
+    void (*Callback)(void);                     /* Called from the I2C interrupt once complete, or NULL_PTR */
+    volatile I2C_StatusTypeDef  Status;         /* Set by the driver */
+
+} I2C_TransactionTypeDef;
+
+/**
+ * @brief Initialize the MSSP as an I2C master with the provided configuration.
+ *
+ * The baud rate generator is loaded for the selected SCL frequency, computed from FOSC, the pins are released to
+ * the MSSP and the MSSP and bus collision interrupts are enabled. The transaction queue is emptied.
+ *
+ * @param InitPtr Pointer to the I2C initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of the initialization.
+ *     - E_OK: The I2C module was initialized successfully.
+ *     - E_NOT_OK: NULL @param InitPtr or invalid configuration.
+ *
+ * @note The global (and peripheral) interrupts must be enabled for the transactions to run.
+ */
+Std_ReturnType I2C_Init(const I2C_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Deinitialize the I2C module, the pending transactions are dropped without their callbacks.
+ *
+ * @param InitPtr Pointer to the I2C initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of the deinitialization.
+ *     - E_OK: The I2C module was deinitialized successfully.
+ *     - E_NOT_OK: NULL @param InitPtr.
+ */
+Std_ReturnType I2C_DeInit(const I2C_InitTypeDef * const InitPtr);
+
+/**
+ * @brief Queue a transaction, it runs from the I2C interrupt once the transactions queued before it are complete.
+ *
+ * The Status of the transaction is I2C_STATUS_PENDING until it is complete, it can be polled instead of using the
+ * callback. A transaction that fails (NACK or bus collision) is ended and the next one is started.
+ *
+ * @param InitPtr Pointer to the I2C initialization structure containing configuration parameters.
+ * @param TransactionPtr Pointer to the transaction, which must stay in place until it is complete.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The transaction was queued successfully.
+ *     - E_NOT_OK: NULL pointer, invalid address or buffers, no bytes or the queue is full.
+ *
+ * @note Callbacks may queue the next transactions.
+ */
+Std_ReturnType I2C_AddTransaction(const I2C_InitTypeDef * const InitPtr, I2C_TransactionTypeDef * const TransactionPtr);
+
+/**
+ * @brief Retrieve the number of transactions waiting in the I2C queue, including the one in progress.
+ *
+ * @param InitPtr Pointer to the I2C initialization structure containing configuration parameters.
+ * @param Pending_ret Pointer to a variable where the number of pending transactions is stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The number of transactions was stored successfully.
+ *     - E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType I2C_GetPendingTransactions(const I2C_InitTypeDef * const InitPtr, uint8 * const Pending_ret);
+
+#endif
+
+#endif /* _I2C_H_ */
@@ -0,0 +1,28 @@
+/**
+ * @file I2C_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief I2C Module Configuration
+ *
+ * The `I2C_Config.h` header file offers a centralized location to configure the I2C master driver, such as the
+ * number of transactions its queue can hold.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _I2C_CONFIG_H_
+#define _I2C_CONFIG_H_
+
+/**
+ * @def I2C_TRANSACTION_QUEUE_SIZE
+ * @brief Number of transactions the queue can hold, a power of two from 2 to 128.
+ */
+#define I2C_TRANSACTION_QUEUE_SIZE                              4
+
+#if ((I2C_TRANSACTION_QUEUE_SIZE < 2) || (I2C_TRANSACTION_QUEUE_SIZE > 128) || \
+     ((I2C_TRANSACTION_QUEUE_SIZE & (I2C_TRANSACTION_QUEUE_SIZE - 1)) != 0))
+#error "'I2C_TRANSACTION_QUEUE_SIZE' must be a power of two from 2 to 128 in I2C_Config.h"
+#endif
+
+#endif /* _I2C_CONFIG_H_ */
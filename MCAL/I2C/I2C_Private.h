@@ -0,0 +1,73 @@
+/**
+ * @file I2C_Private.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Private header file for I2C module internals.
+ *
+ * This private header file contains internal macros and data structures used by the I2C module. These elements are
+ * not intended for direct use by external applications.
+ *
+ * @note This header file should not be included or referenced directly in external application code.
+ * @note External users should refer to the public I2C interface provided in "I2C.h" for I2C module control.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _I2C_PRIVATE_H_
+#define _I2C_PRIVATE_H_
+
+#include "../mcu_registers.h"
+#include "../mcu_config.h"
+
+#define I2C_MODE_MASTER                         0x08        /* SSPM, I2C master, clock = FOSC / (4 * (SSPADD + 1)) */
+
+/* SSPADD of an SCL frequency, rounded to the nearest achievable frequency */
+#define I2C_BAUD_DIVIDER(Frequency)             ((((FOSC / 4UL) + ((Frequency) / 2UL)) / (Frequency)) - 1UL)
+
+#define I2C_BAUD_DIVIDER_100KHZ                 I2C_BAUD_DIVIDER(100000UL)
+#define I2C_BAUD_DIVIDER_400KHZ                 I2C_BAUD_DIVIDER(400000UL)
+
+/* SSPADD values of 0 to 2 are not supported by the baud rate generator, 7 bits are reloaded */
+#if ((I2C_BAUD_DIVIDER_400KHZ < 3) || (I2C_BAUD_DIVIDER_100KHZ > 127))
+#error "FOSC out of the range of the I2C baud rate generator for 100 kHz and 400 kHz"
+#endif
+
+#define __I2C_Enable()                          (SSPCON1bits.SSPEN = 1)
+#define __I2C_Disable()                         (SSPCON1bits.SSPEN = 0)
+
+#define __I2C_ConfigMode(x)                     (SSPCON1bits.SSPM = x)
+#define __I2C_ConfigBaudRate(x)                 (SSPADD = x)
+#define __I2C_ConfigSlewRateControl(x)          (SSPSTATbits.SMP = x)   /* 1: 100 kHz, 0: 400 kHz */
+#define __I2C_ResetControl()                    (SSPCON2 = 0)
+
+#define __I2C_Start()                           (SSPCON2bits.SEN = 1)
+#define __I2C_RepeatedStart()                   (SSPCON2bits.RSEN = 1)
+#define __I2C_Stop()                            (SSPCON2bits.PEN = 1)
+#define __I2C_Receive()                         (SSPCON2bits.RCEN = 1)
+#define __I2C_Acknowledge(x)                    (SSPCON2bits.ACKDT = (x), SSPCON2bits.ACKEN = 1)  /* 0: ACK, 1: NACK */
+#define __I2C_isNotAcknowledged()               (SSPCON2bits.ACKSTAT)
+
+#define __I2C_ClearCollisionFlags()             (SSPCON1bits.WCOL = 0, SSPCON1bits.SSPOV = 0)
+
+#define __I2C_InterruptStatus()                 (PIE1bits.SSPIE)
+#define __I2C_SetInterruptStatus(x)             (PIE1bits.SSPIE = x)
+#define __I2C_BusCollisionInterruptStatus()     (PIE2bits.BCLIE)
+#define __I2C_SetBusCollisionInterruptStatus(x) (PIE2bits.BCLIE = x)
+
+/* Steps of a transaction, each one is completed by an SSPIF interrupt */
+typedef enum
+{
+    I2C_STATE_IDLE = 0,
+    I2C_STATE_START,
+    I2C_STATE_WRITE_ADDRESS,
+    I2C_STATE_WRITE_DATA,
+    I2C_STATE_RESTART,
+    I2C_STATE_READ_ADDRESS,
+    I2C_STATE_READ_DATA,
+    I2C_STATE_ACKNOWLEDGE,
+    I2C_STATE_STOP,
+
+} I2C_StateTypeDef;
+
+#endif /* _I2C_PRIVATE_H_ */
@@ -1,8 +1,8 @@
 /**
  * @file INTI.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com) 
- * @version 0.2
- * @date 01.08.23 
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #include "../Interrupts_Private.h"
@@ -381,4 +381,92 @@ void INTI_SPI_DisableInterrupt(void)
         __INTI_SPI_DeInitPriority();
     }
     #endif
+#endif
+
+void INTI_I2C_ClearFlag(void)
+{
+    __INTI_I2C_ClearFlag();
+}
+
+uint8 INTI_I2C_Flag(void)
+{
+    return (__INTI_I2C_Flag());
+}
+
+void INTI_I2C_ClearBusCollisionFlag(void)
+{
+    __INTI_I2C_ClearBusCollisionFlag();
+}
+
+uint8 INTI_I2C_BusCollisionFlag(void)
+{
+    return (__INTI_I2C_BusCollisionFlag());
+}
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+void INTI_I2C_EnableInterrupt(void)
+{
+    __INTI_I2C_EnableInterrupt();
+}
+
+void INTI_I2C_DisableInterrupt(void)
+{
+    __INTI_I2C_DisableInterrupt();
+}
+
+void INTI_I2C_EnableBusCollisionInterrupt(void)
+{
+    __INTI_I2C_EnableBusCollisionInterrupt();
+}
+
+void INTI_I2C_DisableBusCollisionInterrupt(void)
+{
+    __INTI_I2C_DisableBusCollisionInterrupt();
+}
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    void INTI_I2C_SetPriority(INTERRUPTS_PriorityTypeDef loc_priority)
+    {
+        (INTERRUPTS_HIGH_PRIORITY == loc_priority) ? __INTI_I2C_SetAsHighPriority() : __INTI_I2C_SetAsLowPriority();
+    }
+
+    void INTI_I2C_DeInitPriority(void)
+    {
+        __INTI_I2C_DeInitPriority();
+    }
+    #endif
+#endif
+
+void INTI_EEPROM_ClearFlag(void)
+{
+    __INTI_EEPROM_ClearFlag();
+}
+
+uint8 INTI_EEPROM_Flag(void)
+{
+    return (__INTI_EEPROM_Flag());
+}
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+void INTI_EEPROM_EnableInterrupt(void)
+{
+    __INTI_EEPROM_EnableInterrupt();
+}
+
+void INTI_EEPROM_DisableInterrupt(void)
+{
+    __INTI_EEPROM_DisableInterrupt();
+}
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    void INTI_EEPROM_SetPriority(INTERRUPTS_PriorityTypeDef loc_priority)
+    {
+        (INTERRUPTS_HIGH_PRIORITY == loc_priority) ? __INTI_EEPROM_SetAsHighPriority() : __INTI_EEPROM_SetAsLowPriority();
+    }
+
+    void INTI_EEPROM_DeInitPriority(void)
+    {
+        __INTI_EEPROM_DeInitPriority();
+    }
+    #endif
 #endif
\ No newline at end of file
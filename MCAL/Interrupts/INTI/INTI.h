@@ -14,8 +14,8 @@
  * @note The INTI interface ensures portability and can be utilized across different microcontroller families
  *       and development environments.
  * 
- * @version 0.2
- * @date 01.08.23 
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #ifndef _INTI_H_
@@ -187,8 +187,10 @@ uint8 INTI_EUSART_RxFlag(void);
 
 #endif
 
-#if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE != STD_ON) && (INTERRUPTS_SPI_INTERRUPTS_FEATURE != STD_OFF))
-#warning "'INTERRUPTS_SPI_INTERRUPTS_FEATURE' not configured in Interrupts_Config.h"
+#if ((INTERRUPTS_MSSP_INTERRUPTS_OWNER != INTERRUPTS_MSSP_NONE) && \
+     (INTERRUPTS_MSSP_INTERRUPTS_OWNER != INTERRUPTS_MSSP_SPI) && \
+     (INTERRUPTS_MSSP_INTERRUPTS_OWNER != INTERRUPTS_MSSP_I2C))
+#warning "'INTERRUPTS_MSSP_INTERRUPTS_OWNER' not configured in Interrupts_Config.h"
 #endif
 
 void INTI_SPI_ClearFlag(void);
@@ -204,4 +206,38 @@ void INTI_SPI_DisableInterrupt(void);
     #endif
 #endif
 
+void INTI_I2C_ClearFlag(void);
+uint8 INTI_I2C_Flag(void);
+void INTI_I2C_ClearBusCollisionFlag(void);
+uint8 INTI_I2C_BusCollisionFlag(void);
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+void INTI_I2C_EnableInterrupt(void);
+void INTI_I2C_DisableInterrupt(void);
+void INTI_I2C_EnableBusCollisionInterrupt(void);
+void INTI_I2C_DisableBusCollisionInterrupt(void);
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    void INTI_I2C_SetPriority(INTERRUPTS_PriorityTypeDef loc_priority);
+    void INTI_I2C_DeInitPriority(void);
+    #endif
+#endif
+
+#if ((INTERRUPTS_EEPROM_INTERRUPTS_FEATURE != STD_ON) && (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE != STD_OFF))
+#warning "'INTERRUPTS_EEPROM_INTERRUPTS_FEATURE' not configured in Interrupts_Config.h"
+#endif
+
+void INTI_EEPROM_ClearFlag(void);
+uint8 INTI_EEPROM_Flag(void);
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+void INTI_EEPROM_EnableInterrupt(void);
+void INTI_EEPROM_DisableInterrupt(void);
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    void INTI_EEPROM_SetPriority(INTERRUPTS_PriorityTypeDef loc_priority);
+    void INTI_EEPROM_DeInitPriority(void);
+    #endif
+#endif
+
 #endif /* _INTI_H_ */
\ No newline at end of file
@@ -15,8 +15,8 @@
  * @note The `Interrupts_Config.h` interface promotes code adaptability and can be utilized across diverse
  *       microcontroller families and development environments.
  * 
- * @version 0.1
- * @date 01.08.23
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #ifndef _INTERRUPTS_CONFIG_H_
@@ -52,7 +52,7 @@
  *     - STD_ON: Enable ADC interrupts.
  *     - STD_OFF: Disable ADC interrupts.
  */
-#define INTERRUPTS_ADC_INTERRUPTS_FEATURE               STD_OFF
+#define INTERRUPTS_ADC_INTERRUPTS_FEATURE               STD_ON
 
 /**
  * @def INTERRUPTS_TIMER0_INTERRUPTS_FEATURE
@@ -108,7 +108,7 @@
  *     - STD_ON: Enable EUSART interrupts.
  *     - STD_OFF: Disable EUSART interrupts.
  */
-#define INTERRUPTS_EUSART_INTERRUPTS_FEATURE            STD_OFF
+#define INTERRUPTS_EUSART_INTERRUPTS_FEATURE            STD_ON
 
 /**
  * @def INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE
@@ -116,23 +116,83 @@
  *     - STD_ON: Enable transmitter interrupts.
  *     - STD_OFF: Disable transmitter interrupts.
  */
-#define INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE         STD_OFF
+#define INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE         STD_ON
 
 /**
- * @def INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE
+ * @def INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE
  * @brief Control macro to enable or disable the reciever interrupts for the EUSART module.
  *     - STD_ON: Enable reciever interrupts.
  *     - STD_OFF: Disable reciever interrupts.
  */
-#define INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE         STD_OFF
+#define INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE         STD_ON
+
+#define INTERRUPTS_MSSP_NONE                            0
+#define INTERRUPTS_MSSP_SPI                             1
+#define INTERRUPTS_MSSP_I2C                             2
 
 /**
- * @def INTERRUPTS_SPI_INTERRUPTS_FEATURE
- * @brief Control macro to enable or disable the interrupts for the SPI module.
- *     - STD_ON: Enable SPI interrupts.
- *     - STD_OFF: Disable SPI interrupts.
+ * @def INTERRUPTS_MSSP_INTERRUPTS_OWNER
+ * @brief Driver the interrupts of the MSSP module are given to, the MSSP runs either SPI or I2C.
+ *     - INTERRUPTS_MSSP_I2C: I2C interrupts (MSSP event and bus collision), required by the I2C master driver.
+ *     - INTERRUPTS_MSSP_SPI: SPI interrupts, required by the SPI transaction queue and the buffered slave mode.
+ *     - INTERRUPTS_MSSP_NONE: No MSSP interrupts, only the blocking SPI transfers are available.
+ *
+ * @note An SPI build selects INTERRUPTS_MSSP_SPI here or with -DINTERRUPTS_MSSP_INTERRUPTS_OWNER=INTERRUPTS_MSSP_SPI
+ *       on the compiler command line.
  */
+#ifndef INTERRUPTS_MSSP_INTERRUPTS_OWNER
+#define INTERRUPTS_MSSP_INTERRUPTS_OWNER                INTERRUPTS_MSSP_I2C
+#endif
+
+/* The SPI and I2C interrupt features follow the owner of the MSSP interrupts, they are never set directly */
+#if (INTERRUPTS_MSSP_INTERRUPTS_OWNER == INTERRUPTS_MSSP_SPI)
+#define INTERRUPTS_SPI_INTERRUPTS_FEATURE               STD_ON
+#define INTERRUPTS_I2C_INTERRUPTS_FEATURE               STD_OFF
+#elif (INTERRUPTS_MSSP_INTERRUPTS_OWNER == INTERRUPTS_MSSP_I2C)
 #define INTERRUPTS_SPI_INTERRUPTS_FEATURE               STD_OFF
+#define INTERRUPTS_I2C_INTERRUPTS_FEATURE               STD_ON
+#else
+#define INTERRUPTS_SPI_INTERRUPTS_FEATURE               STD_OFF
+#define INTERRUPTS_I2C_INTERRUPTS_FEATURE               STD_OFF
+#endif
+
+/**
+ * @def INTERRUPTS_EEPROM_INTERRUPTS_FEATURE
+ * @brief Control macro to enable or disable the write complete interrupt of the data EEPROM.
+ *     - STD_ON: Enable EEPROM interrupts.
+ *     - STD_OFF: Disable EEPROM interrupts.
+ */
+#define INTERRUPTS_EEPROM_INTERRUPTS_FEATURE            STD_ON
+
+/**
+ * @def INTERRUPTS_DISPATCH_ORDER
+ * @brief Order in which the interrupt handler checks the interrupt sources, the first listed source has the shortest
+ *        dispatch latency.
+ *
+ * Every source listed here expands to a single flag test when its feature is STD_ON and to nothing otherwise, so
+ * one entry per source is all the handler needs. A source whose feature is STD_ON but which is missing from the
+ * list is never dispatched. The default order serves the sources that lose data when they are late first (the
+ * EUSART receiver has a 2 byte FIFO, the ADC result is overwritten by the next triggered conversion) and the
+ * sources that only lose time last.
+ */
+#define INTERRUPTS_DISPATCH_ORDER(DISPATCH)             \
+        INTERRUPTS_SOURCE_EUSART_RX(DISPATCH)           \
+        INTERRUPTS_SOURCE_ADC(DISPATCH)                 \
+        INTERRUPTS_SOURCE_CCP1(DISPATCH)                \
+        INTERRUPTS_SOURCE_CCP2(DISPATCH)                \
+        INTERRUPTS_SOURCE_INT0(DISPATCH)                \
+        INTERRUPTS_SOURCE_INT1(DISPATCH)                \
+        INTERRUPTS_SOURCE_INT2(DISPATCH)                \
+        INTERRUPTS_SOURCE_RBx(DISPATCH)                 \
+        INTERRUPTS_SOURCE_TIMER0(DISPATCH)              \
+        INTERRUPTS_SOURCE_TIMER1(DISPATCH)              \
+        INTERRUPTS_SOURCE_TIMER2(DISPATCH)              \
+        INTERRUPTS_SOURCE_TIMER3(DISPATCH)              \
+        INTERRUPTS_SOURCE_SPI(DISPATCH)                 \
+        INTERRUPTS_SOURCE_I2C(DISPATCH)                 \
+        INTERRUPTS_SOURCE_I2C_BCL(DISPATCH)             \
+        INTERRUPTS_SOURCE_EUSART_TX(DISPATCH)           \
+        INTERRUPTS_SOURCE_EEPROM(DISPATCH)
 
 #endif	/* _INTERRUPTS_CONFIG_H_ */
 
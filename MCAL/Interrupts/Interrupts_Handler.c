@@ -1,8 +1,8 @@
 /**
  * @file Interrupts_Handler.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com) 
- * @version 0.1
- * @date 01.08.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #include "Interrupts_Private.h"
@@ -10,106 +10,81 @@
 
 #if (INTERRUPTS_ON_CHANGE_INTERRUPTS_FEATURE == STD_ON)
 static volatile uint8 EXTI_RBx_Flags[NUMBER_OF_RBx_PINS] = {EXTI_RBx_FLAG_LOWERED};
+
+static void EXTI_RBx_ISR(void);
 #endif
 
 #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
-void __interrupt() HighPriorityInterruptHandler(void)
-{    
- 
+/*
+ * XC8 saves WREG, STATUS and BSR of the high priority vector in the fast register stack (RETFIE FAST), the low
+ * priority vector saves them in software since it can be preempted by the high priority one.
+ */
+void __interrupt(high_priority) HighPriorityInterruptHandler(void)
+{
+    /* Only the sources whose IP bit is set, INT0 has no IP bit and is always high priority */
+    uint8 loc_pending_INTCON = INTCON;
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    uint8 loc_pending_INTCON3 = INTCON3;
+#endif
+    uint8 loc_pending_PIR1 = PIR1;
+    uint8 loc_pending_PIR2 = PIR2;
+
+    loc_pending_INTCON &= (uint8)(loc_pending_INTCON >> 3) & (uint8)(INTCON2 | INTERRUPTS_INTCON_INT0IF);
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    loc_pending_INTCON3 &= (uint8)(loc_pending_INTCON3 >> 3) & (uint8)(loc_pending_INTCON3 >> 6);
+#endif
+    loc_pending_PIR1 &= (uint8)(PIE1 & IPR1);
+    loc_pending_PIR2 &= (uint8)(PIE2 & IPR2);
+
+    INTERRUPTS_DISPATCH_ORDER(INTERRUPTS_Dispatch)
 }
 
 void __interrupt(low_priority) LowPriorityInterruptHandler(void)
 {
+    /* Only the sources whose IP bit is cleared */
+    uint8 loc_pending_INTCON = INTCON;
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    uint8 loc_pending_INTCON3 = INTCON3;
+#endif
+    uint8 loc_pending_PIR1 = PIR1;
+    uint8 loc_pending_PIR2 = PIR2;
+
+    loc_pending_INTCON &= (uint8)(loc_pending_INTCON >> 3) & (uint8)(~INTCON2 & INTERRUPTS_INTCON2_PRIORITY_MASK);
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    loc_pending_INTCON3 &= (uint8)(loc_pending_INTCON3 >> 3) & (uint8)~(loc_pending_INTCON3 >> 6);
+#endif
+    loc_pending_PIR1 &= (uint8)(PIE1 & ~IPR1);
+    loc_pending_PIR2 &= (uint8)(PIE2 & ~IPR2);
 
+    INTERRUPTS_DISPATCH_ORDER(INTERRUPTS_Dispatch)
 }
 
 #elif (INTERRUPTS_PRIORITY_FEATURE == STD_OFF)
 
 void __interrupt() InterruptHandler(void)
-{   
-    #if (INTERRUPTS_TIMER0_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_TIMER0_Flag())
-    {
-        TIMER0_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_TIMER1_Flag())
-    {
-        TIMER1_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_TIMER2_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_TIMER2_Flag())
-    {
-        TIMER2_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_TIMER3_Flag())
-    {
-        TIMER3_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_CCP1_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_CCP1_Flag())
-    {
-        CCP1_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_CCP2_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_CCP2_Flag())
-    {
-        CCP2_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_CCP2_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_SPI_Flag())
-    {
-        SPI_ISR();
-    }
-    #endif
-
-    #if (INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON)
-        #if (INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE == STD_ON)
-        if (INTI_EUSART_RxFlag())
-        {
-            EUSART_RX_ISR();
-        }
-        #endif
+{
+    /* One pass over the table: every source is tested once, a source raised meanwhile re-enters the handler */
+    uint8 loc_pending_INTCON = INTCON;
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    uint8 loc_pending_INTCON3 = INTCON3;
+#endif
+    uint8 loc_pending_PIR1 = PIR1;
+    uint8 loc_pending_PIR2 = PIR2;
 
-        #if (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON)
-        if (INTI_EUSART_TxFlag())
-        {
-            EUSART_TX_ISR();
-        }
-        #endif
-    #endif
+    loc_pending_INTCON &= (uint8)(loc_pending_INTCON >> 3);
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+    loc_pending_INTCON3 &= (uint8)(loc_pending_INTCON3 >> 3);
+#endif
+    loc_pending_PIR1 &= PIE1;
+    loc_pending_PIR2 &= PIE2;
 
-    #if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
-    if (EXTI_INT0_Flag())
-    {
-        EXTI_INT0_ISR();
-    }
-    
-    if (EXTI_INT1_Flag())
-    {
-        EXTI_INT1_ISR();
-    }
-    
-    if (EXTI_INT2_Flag())
-    {
-        EXTI_INT2_ISR();
-    }
-    #endif    
+    INTERRUPTS_DISPATCH_ORDER(INTERRUPTS_Dispatch)
+}
+#endif
 
-    #if (INTERRUPTS_ON_CHANGE_INTERRUPTS_FEATURE == STD_ON)
+#if (INTERRUPTS_ON_CHANGE_INTERRUPTS_FEATURE == STD_ON)
+static void EXTI_RBx_ISR(void)
+{
     if (EXTI_RBx_Flag() && EXTI_RB4_RisingEdgeFlag() && (EXTI_RBx_FLAG_LOWERED == EXTI_RBx_Flags[EXTI_RB4]))
     {
         EXTI_RB4_RisingEdgeISR();
@@ -157,13 +132,5 @@ void __interrupt() InterruptHandler(void)
         EXTI_RB7_FallingEdgeISR();
         EXTI_RBx_Flags[EXTI_RB7] ^= 1;
     }
-    #endif
-
-    #if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
-    if (INTI_ADC_Flag())
-    {
-        ADC_ISR();
-    }
-    #endif
 }
-#endif
\ No newline at end of file
+#endif
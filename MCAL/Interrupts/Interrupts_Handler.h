@@ -13,9 +13,13 @@
  *       return values, and usage examples.
  * @note The `Interrupts_Handler.h` interface promotes code maintainability and can be used across diverse
  *       microcontroller families and development environments.
+ * @note The handler takes one snapshot of the pending sources (IF && IE) and tests them in the order of
+ *       INTERRUPTS_DISPATCH_ORDER in Interrupts_Config.h, a flag whose enable bit is cleared is never dispatched.
+ * @note With INTERRUPTS_PRIORITY_FEATURE enabled, each vector only dispatches the sources routed to it by their
+ *       IP bit (set with the drivers' Priority configuration), the high priority sources preempt the low ones.
  * 
- * @version 0.1
- * @date 01.08.23
+ * @version 0.3
+ * @date 18.10.26
  */
 
 #ifndef _INTERRUPTS_HANDLER_H_
@@ -25,7 +29,7 @@
 
 #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
 
-void __interrupt() HighPriorityInterruptHandler(void);
+void __interrupt(high_priority) HighPriorityInterruptHandler(void);
 void __interrupt(low_priority) LowPriorityInterruptHandler(void);
 
 #elif (INTERRUPTS_PRIORITY_FEATURE == STD_OFF)
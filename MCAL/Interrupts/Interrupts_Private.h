@@ -16,8 +16,8 @@
  * @note The `Interrupts_Private.h` interface improves code organization and maintainability by isolating
  *       internal interrupt-related operations from the main public interface.
  * 
- * @version 0.1
- * @date 01.08.23
+ * @version 0.4
+ * @date 18.10.26
  */
 
 #ifndef _INTERRUPTS_PRIVATE_H_
@@ -298,6 +298,165 @@
     #endif
 #endif
 
+#define __INTI_I2C_ClearFlag()                                   (PIR1bits.SSPIF = 0)
+#define __INTI_I2C_Flag()                                        (PIR1bits.SSPIF)
+#define __INTI_I2C_ClearBusCollisionFlag()                       (PIR2bits.BCLIF = 0)
+#define __INTI_I2C_BusCollisionFlag()                            (PIR2bits.BCLIF)
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+
+#define __INTI_I2C_EnableInterrupt()                             (PIE1bits.SSPIE = 1)
+#define __INTI_I2C_DisableInterrupt()                            (PIE1bits.SSPIE = 0)
+#define __INTI_I2C_EnableBusCollisionInterrupt()                 (PIE2bits.BCLIE = 1)
+#define __INTI_I2C_DisableBusCollisionInterrupt()                (PIE2bits.BCLIE = 0)
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+
+    #define __INTI_I2C_SetAsHighPriority()                       (IPR1bits.SSPIP = 1, IPR2bits.BCLIP = 1)
+    #define __INTI_I2C_SetAsLowPriority()                        (IPR1bits.SSPIP = 0, IPR2bits.BCLIP = 0)
+    #define __INTI_I2C_DeInitPriority()                          (__INTI_I2C_SetAsLowPriority())
+
+    #endif
+#endif
+
+#define __INTI_EEPROM_ClearFlag()                                (PIR2bits.EEIF = 0)
+#define __INTI_EEPROM_Flag()                                     (PIR2bits.EEIF)
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+
+#define __INTI_EEPROM_EnableInterrupt()                          (PIE2bits.EEIE = 1)
+#define __INTI_EEPROM_DisableInterrupt()                         (PIE2bits.EEIE = 0)
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+
+    #define __INTI_EEPROM_SetAsHighPriority()                    (IPR2bits.EEIP = 1)
+    #define __INTI_EEPROM_SetAsLowPriority()                     (IPR2bits.EEIP = 0)
+    #define __INTI_EEPROM_DeInitPriority()                       (__INTI_EEPROM_SetAsLowPriority())
+
+    #endif
+#endif
+
+/*
+ * Interrupt source table entries, DISPATCH(Register, Mask, ISR): the source is pending when the Mask bit is set in
+ * the Register snapshot taken by the handler, the snapshots already hold (IF && IE). INTCON and INTCON3 keep every
+ * enable bit 3 positions above its flag, PIE1/IPR1 and PIE2/IPR2 mirror PIR1 and PIR2.
+ */
+#define INTERRUPTS_INTCON_TMR0IF                            0x04
+#define INTERRUPTS_INTCON_INT0IF                            0x02
+#define INTERRUPTS_INTCON_RBIF                              0x01
+#define INTERRUPTS_INTCON3_INT2IF                           0x02
+#define INTERRUPTS_INTCON3_INT1IF                           0x01
+#define INTERRUPTS_PIR1_ADIF                                0x40
+#define INTERRUPTS_PIR1_RCIF                                0x20
+#define INTERRUPTS_PIR1_TXIF                                0x10
+#define INTERRUPTS_PIR1_SSPIF                               0x08
+#define INTERRUPTS_PIR1_CCP1IF                              0x04
+#define INTERRUPTS_PIR1_TMR2IF                              0x02
+#define INTERRUPTS_PIR1_TMR1IF                              0x01
+#define INTERRUPTS_PIR2_EEIF                                0x10
+#define INTERRUPTS_PIR2_BCLIF                               0x08
+#define INTERRUPTS_PIR2_TMR3IF                              0x02
+#define INTERRUPTS_PIR2_CCP2IF                              0x01
+
+/* TMR0IP and RBIP sit at the positions of their flags in INTCON2, INT1IP and INT2IP 6 positions above theirs in INTCON3 */
+#define INTERRUPTS_INTCON2_PRIORITY_MASK                    (INTERRUPTS_INTCON_TMR0IF | INTERRUPTS_INTCON_RBIF)
+
+#define INTERRUPTS_Dispatch(Register, Mask, ISR)           if (0 != (loc_pending_##Register & (Mask))) { ISR(); }
+
+#if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_INT0(DISPATCH)                    DISPATCH(INTCON, INTERRUPTS_INTCON_INT0IF, EXTI_INT0_ISR)
+#define INTERRUPTS_SOURCE_INT1(DISPATCH)                    DISPATCH(INTCON3, INTERRUPTS_INTCON3_INT1IF, EXTI_INT1_ISR)
+#define INTERRUPTS_SOURCE_INT2(DISPATCH)                    DISPATCH(INTCON3, INTERRUPTS_INTCON3_INT2IF, EXTI_INT2_ISR)
+#else
+#define INTERRUPTS_SOURCE_INT0(DISPATCH)
+#define INTERRUPTS_SOURCE_INT1(DISPATCH)
+#define INTERRUPTS_SOURCE_INT2(DISPATCH)
+#endif
+
+#if (INTERRUPTS_ON_CHANGE_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_RBx(DISPATCH)                     DISPATCH(INTCON, INTERRUPTS_INTCON_RBIF, EXTI_RBx_ISR)
+#else
+#define INTERRUPTS_SOURCE_RBx(DISPATCH)
+#endif
+
+#if (INTERRUPTS_ADC_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_ADC(DISPATCH)                     DISPATCH(PIR1, INTERRUPTS_PIR1_ADIF, ADC_ISR)
+#else
+#define INTERRUPTS_SOURCE_ADC(DISPATCH)
+#endif
+
+#if (INTERRUPTS_TIMER0_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_TIMER0(DISPATCH)                  DISPATCH(INTCON, INTERRUPTS_INTCON_TMR0IF, TIMER0_ISR)
+#else
+#define INTERRUPTS_SOURCE_TIMER0(DISPATCH)
+#endif
+
+#if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_TIMER1(DISPATCH)                  DISPATCH(PIR1, INTERRUPTS_PIR1_TMR1IF, TIMER1_ISR)
+#else
+#define INTERRUPTS_SOURCE_TIMER1(DISPATCH)
+#endif
+
+#if (INTERRUPTS_TIMER2_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_TIMER2(DISPATCH)                  DISPATCH(PIR1, INTERRUPTS_PIR1_TMR2IF, TIMER2_ISR)
+#else
+#define INTERRUPTS_SOURCE_TIMER2(DISPATCH)
+#endif
+
+#if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_TIMER3(DISPATCH)                  DISPATCH(PIR2, INTERRUPTS_PIR2_TMR3IF, TIMER3_ISR)
+#else
+#define INTERRUPTS_SOURCE_TIMER3(DISPATCH)
+#endif
+
+#if (INTERRUPTS_CCP1_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_CCP1(DISPATCH)                    DISPATCH(PIR1, INTERRUPTS_PIR1_CCP1IF, CCP1_ISR)
+#else
+#define INTERRUPTS_SOURCE_CCP1(DISPATCH)
+#endif
+
+#if (INTERRUPTS_CCP2_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_CCP2(DISPATCH)                    DISPATCH(PIR2, INTERRUPTS_PIR2_CCP2IF, CCP2_ISR)
+#else
+#define INTERRUPTS_SOURCE_CCP2(DISPATCH)
+#endif
+
+#if ((INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON) && (INTERRUPTS_EUSART_RX_INTERRUPTS_FEATURE == STD_ON))
+#define INTERRUPTS_SOURCE_EUSART_RX(DISPATCH)               DISPATCH(PIR1, INTERRUPTS_PIR1_RCIF, EUSART_RX_ISR)
+#else
+#define INTERRUPTS_SOURCE_EUSART_RX(DISPATCH)
+#endif
+
+#if ((INTERRUPTS_EUSART_INTERRUPTS_FEATURE == STD_ON) && (INTERRUPTS_EUSART_TX_INTERRUPTS_FEATURE == STD_ON))
+#define INTERRUPTS_SOURCE_EUSART_TX(DISPATCH)               DISPATCH(PIR1, INTERRUPTS_PIR1_TXIF, EUSART_TX_ISR)
+#else
+#define INTERRUPTS_SOURCE_EUSART_TX(DISPATCH)
+#endif
+
+#if (INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_SPI(DISPATCH)                     DISPATCH(PIR1, INTERRUPTS_PIR1_SSPIF, SPI_ISR)
+#else
+#define INTERRUPTS_SOURCE_SPI(DISPATCH)
+#endif
+
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_I2C(DISPATCH)                     DISPATCH(PIR1, INTERRUPTS_PIR1_SSPIF, I2C_ISR)
+#define INTERRUPTS_SOURCE_I2C_BCL(DISPATCH)                 DISPATCH(PIR2, INTERRUPTS_PIR2_BCLIF, I2C_BCL_ISR)
+#else
+#define INTERRUPTS_SOURCE_I2C(DISPATCH)
+#define INTERRUPTS_SOURCE_I2C_BCL(DISPATCH)
+#endif
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+#define INTERRUPTS_SOURCE_EEPROM(DISPATCH)                  DISPATCH(PIR2, INTERRUPTS_PIR2_EEIF, EEPROM_ISR)
+#else
+#define INTERRUPTS_SOURCE_EEPROM(DISPATCH)
+#endif
+
+#ifndef INTERRUPTS_DISPATCH_ORDER
+#error "'INTERRUPTS_DISPATCH_ORDER' not configured in Interrupts_Config.h"
+#endif
+
 
 #if (INTERRUPTS_INTx_INTERRUPTS_FEATURE == STD_ON)
 void EXTI_INT0_ISR(void);
@@ -361,5 +520,14 @@ void CCP2_ISR(void);
 void SPI_ISR(void);
 #endif
 
+#if (INTERRUPTS_I2C_INTERRUPTS_FEATURE == STD_ON)
+void I2C_ISR(void);
+void I2C_BCL_ISR(void);
+#endif
+
+#if (INTERRUPTS_EEPROM_INTERRUPTS_FEATURE == STD_ON)
+void EEPROM_ISR(void);
+#endif
+
 #endif	/* _INTERRUPTS_PRIVATE_H_ */
 
@@ -1,8 +1,8 @@
 /**
  * @file SPI.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 19.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "SPI_Private.h"
@@ -14,6 +14,31 @@ static void (*SPI_InterruptHandler)(void) = NULL_PTR;
 static Std_ReturnType SPI_InitInterruptHandler(const SPI_InitTypeDef * const InitPtr);
 static void SPI_DeInitInterruptHandler(void);
 
+    #if (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON)
+    static const SPI_TransactionTypeDef * SPI_Queue[SPI_TRANSACTION_QUEUE_SIZE];
+    static const SPI_DeviceTypeDef * SPI_QueueDevice = NULL_PTR;   /* Device whose clock mode is loaded, if any */
+    static volatile uint16 SPI_QueueIndex = 0;                      /* Bytes of the head transaction exchanged */
+    static volatile uint8 SPI_QueueHead = 0;
+    static volatile uint8 SPI_QueueCount = 0;
+
+    static void SPI_QueueStart(void);
+    static void SPI_QueueNext(void);
+    #endif
+
+    #if (SPI_SLAVE_BUFFERS_FEATURE == STD_ON)
+    static volatile uint8 SPI_SlaveRxBuffer[SPI_SLAVE_RX_BUFFER_SIZE];
+    static volatile uint8 SPI_SlaveRxHead = 0;
+    static volatile uint8 SPI_SlaveRxTail = 0;
+    static volatile uint8 SPI_SlaveTxBuffer[SPI_SLAVE_TX_BUFFER_SIZE];
+    static volatile uint8 SPI_SlaveTxHead = 0;
+    static volatile uint8 SPI_SlaveTxTail = 0;
+    static volatile uint8 SPI_SlaveFrameLength = 0;     /* Bytes received since the last end of frame */
+    static volatile boolean SPI_SlaveFillLoaded = FALSE; /* SSPBUF holds the fill byte and no byte was clocked */
+    static boolean SPI_SlaveActive = FALSE;
+
+    static void SPI_SlaveExchange(void);
+    #endif
+
     #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
     static Std_ReturnType SPI_InitPriority(const SPI_InitTypeDef * const InitPtr);
     static void SPI_DeInitPriority(void);
@@ -22,6 +47,9 @@ static void SPI_DeInitInterruptHandler(void);
 
 static Std_ReturnType SPI_InitPins(const SPI_InitTypeDef * const InitPtr);
 static Std_ReturnType SPI_DeInitPins(const SPI_InitTypeDef * const InitPtr);
+static boolean SPI_isQueueBusy(void);
+static void SPI_BeginTransfer(void);
+static void SPI_EndTransfer(void);
 
 Std_ReturnType SPI_Init(const SPI_InitTypeDef * const InitPtr)
 {
@@ -39,11 +67,38 @@ Std_ReturnType SPI_Init(const SPI_InitTypeDef * const InitPtr)
         loc_ret |= SPI_InitPins(InitPtr);
 
         #if (INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON)
+            #if (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON)
+            SPI_QueueDevice = NULL_PTR;
+            SPI_QueueHead = 0;
+            SPI_QueueCount = 0;
+            #endif
+
+            #if (SPI_SLAVE_BUFFERS_FEATURE == STD_ON)
+            SPI_SlaveActive = (InitPtr->Mode >= SPI_MODE_SLAVE_SS_ENABLED) ? TRUE : FALSE;
+            SPI_SlaveRxHead = 0;
+            SPI_SlaveRxTail = 0;
+            SPI_SlaveTxHead = 0;
+            SPI_SlaveTxTail = 0;
+            SPI_SlaveFrameLength = 0;
+            #endif
+
+            #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+            loc_ret |= SPI_InitPriority(InitPtr);
+            #endif
+
         INTI_SPI_EnableInterrupt();
         loc_ret |= SPI_InitInterruptHandler(InitPtr);
         #endif
 
         __SPI_Enable();
+
+        #if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON) && (SPI_SLAVE_BUFFERS_FEATURE == STD_ON))
+        if (TRUE == SPI_SlaveActive)
+        {
+            SSPBUF = SPI_SLAVE_FILL_BYTE;
+            SPI_SlaveFillLoaded = TRUE;
+        }
+        #endif
     }
     else
     {
@@ -65,8 +120,25 @@ Std_ReturnType SPI_DeInit(const SPI_InitTypeDef * const InitPtr)
 
         #if (INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON)
         INTI_SPI_DisableInterrupt();
+
+            #if (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON)
+            // The transaction in progress is dropped with the rest of the queue, its device is deselected.
+            if (0 != SPI_QueueCount)
+            {
+                loc_ret |= GPIO_SetChannelLogic(&SPI_Queue[SPI_QueueHead]->Device->ChipSelect, GPIO_HIGH);
+                SPI_QueueCount = 0;
+            }
+            #endif
+
+            #if (SPI_SLAVE_BUFFERS_FEATURE == STD_ON)
+            SPI_SlaveActive = FALSE;
+            #endif
+
         SPI_DeInitInterruptHandler();
-        SPI_DeInitPriority();
+
+            #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+            SPI_DeInitPriority();
+            #endif
         #endif
     }
     else 
@@ -80,14 +152,14 @@ Std_ReturnType SPI_SendData(const SPI_InitTypeDef * const InitPtr, const uint8 D
 {
     Std_ReturnType loc_ret = E_OK;
 
-    if (NULL_PTR != InitPtr)
+    if ((NULL_PTR != InitPtr) && (FALSE == SPI_isQueueBusy()))
     {
-        uint8 loc_FlushByte;
+        SPI_BeginTransfer();
 
         SSPBUF = Data;
-        while (0 == INTI_SPI_Flag());
+        while (0 == __SPI_isBufferFull());
 
-        loc_FlushByte = SSPBUF;
+        SPI_EndTransfer();
     }
     else
     {
@@ -101,13 +173,16 @@ Std_ReturnType SPI_ReadData(const SPI_InitTypeDef * const InitPtr, uint8 * const
 {
     Std_ReturnType loc_ret = E_OK;
 
-    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr))
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr) && (FALSE == SPI_isQueueBusy()))
     {
-        SSPBUF = 0xFF; // Dummy Data
+        SPI_BeginTransfer();
 
-        while (0 == INTI_SPI_Flag());
+        SSPBUF = 0xFF; // Dummy Data
+        while (0 == __SPI_isBufferFull());
 
         *DataBufferPtr = SSPBUF;
+
+        SPI_EndTransfer();
     }
     else
     {
@@ -121,13 +196,16 @@ Std_ReturnType SPI_ExchangeData(const SPI_InitTypeDef * const InitPtr, const uin
 {
     Std_ReturnType loc_ret = E_OK;
 
-    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr))
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr) && (FALSE == SPI_isQueueBusy()))
     {
-        SSPBUF = Data;
+        SPI_BeginTransfer();
 
-        while (0 == INTI_SPI_Flag());
+        SSPBUF = Data;
+        while (0 == __SPI_isBufferFull());
 
         *DataBufferPtr = SSPBUF;
+
+        SPI_EndTransfer();
     }
     else
     {
@@ -137,6 +215,126 @@ Std_ReturnType SPI_ExchangeData(const SPI_InitTypeDef * const InitPtr, const uin
     return loc_ret;
 }
 
+Std_ReturnType SPI_TransferBuffer(const SPI_InitTypeDef * const InitPtr, const uint8 * const TxBuffer,
+                                  uint8 * const RxBuffer, const uint16 Length)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_index = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != TxBuffer) && (NULL_PTR != RxBuffer) && (FALSE == SPI_isQueueBusy()))
+    {
+        SPI_BeginTransfer();
+
+        for (loc_index = 0; loc_index < Length; loc_index++)
+        {
+            SSPBUF = TxBuffer[loc_index];
+            while (0 == __SPI_isBufferFull());
+
+            RxBuffer[loc_index] = SSPBUF;
+        }
+
+        SPI_EndTransfer();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SPI_WriteBuffer(const SPI_InitTypeDef * const InitPtr, const uint8 * const TxBuffer,
+                               const uint16 Length)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_index = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != TxBuffer) && (FALSE == SPI_isQueueBusy()))
+    {
+        SPI_BeginTransfer();
+
+        for (loc_index = 0; loc_index < Length; loc_index++)
+        {
+            SSPBUF = TxBuffer[loc_index];
+            while (0 == __SPI_isBufferFull());
+
+            // Reading SSPBUF clears BF, the received byte is discarded.
+            (void)SSPBUF;
+        }
+
+        SPI_EndTransfer();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SPI_ReadBuffer(const SPI_InitTypeDef * const InitPtr, uint8 * const RxBuffer, const uint16 Length,
+                              const uint8 Fill)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint16 loc_index = 0;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != RxBuffer) && (FALSE == SPI_isQueueBusy()))
+    {
+        SPI_BeginTransfer();
+
+        for (loc_index = 0; loc_index < Length; loc_index++)
+        {
+            SSPBUF = Fill;
+            while (0 == __SPI_isBufferFull());
+
+            RxBuffer[loc_index] = SSPBUF;
+        }
+
+        SPI_EndTransfer();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+/* The blocking transfers would corrupt the transaction in progress, they are refused until the queue is empty */
+static boolean SPI_isQueueBusy(void)
+{
+    boolean loc_busy = FALSE;
+
+#if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON) && (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON))
+    loc_busy = (0 != SPI_QueueCount) ? TRUE : FALSE;
+#endif
+
+    return loc_busy;
+}
+
+/*
+ * The transfers wait on BF, set when a byte has been shifted in and cleared by reading SSPBUF, rather than on SSPIF
+ * which the SPI interrupt may clear first. A byte left unread and the collision flags are cleared beforehand.
+ */
+static void SPI_BeginTransfer(void)
+{
+    if (__SPI_isBufferFull())
+    {
+        (void)SSPBUF;
+    }
+
+    __SPI_ClearReadCollisionFlag();
+    __SPI_ClearWriteCollisionFlag();
+}
+
+static void SPI_EndTransfer(void)
+{
+#if (INTERRUPTS_SPI_INTERRUPTS_FEATURE != STD_ON)
+    // Left set by the last byte, SSPIF is cleared for the code that polls it.
+    INTI_SPI_ClearFlag();
+#endif
+}
+
 static Std_ReturnType SPI_InitPins(const SPI_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
@@ -232,6 +430,10 @@ static Std_ReturnType SPI_InitInterruptHandler(const SPI_InitTypeDef * const Ini
 {
     Std_ReturnType loc_ret = E_OK;
 
+#if ((SPI_TRANSACTION_QUEUE_FEATURE == STD_ON) || (SPI_SLAVE_BUFFERS_FEATURE == STD_ON))
+    // The SPI interrupt runs the transaction queue or the slave buffers, the application handler is optional.
+    SPI_InterruptHandler = InitPtr->InterruptHandler;
+#else
     if (NULL_PTR != InitPtr->InterruptHandler)
     {
         SPI_InterruptHandler = InitPtr->InterruptHandler;
@@ -240,6 +442,7 @@ static Std_ReturnType SPI_InitInterruptHandler(const SPI_InitTypeDef * const Ini
     {
         loc_ret = E_NOT_OK;
     }
+#endif
 
     return loc_ret;
 }
@@ -272,10 +475,310 @@ static void SPI_DeInitInterruptHandler(void)
     }
     #endif
 
+    #if (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON)
+    Std_ReturnType SPI_Device_Init(const SPI_DeviceTypeDef * const DevicePtr)
+    {
+        Std_ReturnType loc_ret = E_OK;
+        GPIO_InitTypeDef loc_channel;
+
+        if (NULL_PTR != DevicePtr)
+        {
+            loc_channel = DevicePtr->ChipSelect;
+            loc_channel.Direction = GPIO_OUTPUT;
+            loc_channel.Logic = GPIO_HIGH;
+
+            loc_ret = GPIO_InitChannel(&loc_channel);
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        return loc_ret;
+    }
+
+    Std_ReturnType SPI_Queue_AddTransaction(const SPI_InitTypeDef * const InitPtr,
+                                            const SPI_TransactionTypeDef * const TransactionPtr)
+    {
+        Std_ReturnType loc_ret = E_OK;
+        uint8 loc_status = __SPI_InterruptStatus();
+
+        __SPI_SetInterruptStatus(0);
+
+        if ((NULL_PTR != InitPtr) && (NULL_PTR != TransactionPtr) && (NULL_PTR != TransactionPtr->Device) &&
+            (0 != TransactionPtr->Length) && (TransactionPtr->Device->Mode < SPI_MODE_SLAVE_SS_ENABLED) &&
+            (SPI_QueueCount < SPI_TRANSACTION_QUEUE_SIZE) && (__SPI_isMasterMode()))
+        {
+            SPI_Queue[(SPI_QueueHead + SPI_QueueCount) & (SPI_TRANSACTION_QUEUE_SIZE - 1)] = TransactionPtr;
+            SPI_QueueCount++;
+
+            if (1 == SPI_QueueCount)
+            {
+                SPI_QueueStart();
+            }
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        __SPI_SetInterruptStatus(loc_status);
+
+        return loc_ret;
+    }
+
+    Std_ReturnType SPI_Queue_GetPendingTransactions(const SPI_InitTypeDef * const InitPtr, uint8 * const Pending_ret)
+    {
+        Std_ReturnType loc_ret = E_OK;
+
+        if ((NULL_PTR != InitPtr) && (NULL_PTR != Pending_ret))
+        {
+            *Pending_ret = SPI_QueueCount;
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        return loc_ret;
+    }
+
+    /* Called with the SPI interrupt masked or from it, selects the device of the head transaction and sends its
+       first byte */
+    static void SPI_QueueStart(void)
+    {
+        const SPI_TransactionTypeDef * loc_transaction = SPI_Queue[SPI_QueueHead];
+        const SPI_DeviceTypeDef * loc_device = loc_transaction->Device;
+
+        if (loc_device != SPI_QueueDevice)
+        {
+            // The clock mode can only be changed with the MSSP disabled.
+            __SPI_Disable();
+
+            __SPI_ConfigMode(loc_device->Mode);
+            __SPI_ConfigClockPolarity(loc_device->ClockPolarity);
+            __SPI_ConfigSampleTime(loc_device->SampleTime);
+            __SPI_ConfigSetupTime(loc_device->SetupTime);
+
+            __SPI_Enable();
+
+            SPI_QueueDevice = loc_device;
+        }
+
+        (void)GPIO_SetChannelLogic(&loc_device->ChipSelect, GPIO_LOW);
+
+        SPI_BeginTransfer();
+        INTI_SPI_ClearFlag();
+
+        SPI_QueueIndex = 0;
+        SSPBUF = (NULL_PTR != loc_transaction->TxBuffer) ? loc_transaction->TxBuffer[0] : loc_transaction->Fill;
+    }
+
+    static void SPI_QueueNext(void)
+    {
+        const SPI_TransactionTypeDef * loc_transaction = SPI_Queue[SPI_QueueHead];
+        uint16 loc_index = SPI_QueueIndex;
+        uint8 loc_data = SSPBUF;
+
+        if (NULL_PTR != loc_transaction->RxBuffer)
+        {
+            loc_transaction->RxBuffer[loc_index] = loc_data;
+        }
+
+        loc_index++;
+
+        if (loc_index < loc_transaction->Length)
+        {
+            SSPBUF = (NULL_PTR != loc_transaction->TxBuffer) ? loc_transaction->TxBuffer[loc_index]
+                                                             : loc_transaction->Fill;
+            SPI_QueueIndex = loc_index;
+        }
+        else
+        {
+            (void)GPIO_SetChannelLogic(&loc_transaction->Device->ChipSelect, GPIO_HIGH);
+
+            SPI_QueueHead = (SPI_QueueHead + 1) & (SPI_TRANSACTION_QUEUE_SIZE - 1);
+            SPI_QueueCount--;
+
+            // The next transaction is started first, the bus keeps running during the callback.
+            if (0 != SPI_QueueCount)
+            {
+                SPI_QueueStart();
+            }
+
+            if (NULL_PTR != loc_transaction->Callback)
+            {
+                loc_transaction->Callback();
+            }
+        }
+    }
+    #endif
+
+    #if (SPI_SLAVE_BUFFERS_FEATURE == STD_ON)
+    Std_ReturnType SPI_Slave_Read(const SPI_InitTypeDef * const InitPtr, uint8 * const Data_ret)
+    {
+        Std_ReturnType loc_ret = E_OK;
+
+        if ((NULL_PTR != InitPtr) && (NULL_PTR != Data_ret) && (SPI_SlaveRxHead != SPI_SlaveRxTail))
+        {
+            *Data_ret = SPI_SlaveRxBuffer[SPI_SlaveRxTail & (SPI_SLAVE_RX_BUFFER_SIZE - 1)];
+            SPI_SlaveRxTail++;
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        return loc_ret;
+    }
+
+    Std_ReturnType SPI_Slave_Write(const SPI_InitTypeDef * const InitPtr, const uint8 * const Data, const uint8 Length)
+    {
+        Std_ReturnType loc_ret = E_OK;
+        uint8 loc_status = __SPI_InterruptStatus();
+        uint8 loc_index = 0;
+
+        __SPI_SetInterruptStatus(0);
+
+        if ((NULL_PTR != InitPtr) && (NULL_PTR != Data) &&
+            (Length <= (uint8)(SPI_SLAVE_TX_BUFFER_SIZE - (uint8)(SPI_SlaveTxHead - SPI_SlaveTxTail))))
+        {
+            // Between frames the fill byte is replaced by the first response byte, unless the master has started.
+            if ((0 != Length) && (TRUE == SPI_SlaveFillLoaded) && (SPI_SlaveTxHead == SPI_SlaveTxTail))
+            {
+                SSPBUF = Data[0];
+                SPI_SlaveFillLoaded = FALSE;
+
+                if (__SPI_isWriteCollisionDetected())
+                {
+                    __SPI_ClearWriteCollisionFlag();
+                }
+                else
+                {
+                    loc_index = 1;
+                }
+            }
+
+            for (; loc_index < Length; loc_index++)
+            {
+                SPI_SlaveTxBuffer[SPI_SlaveTxHead & (SPI_SLAVE_TX_BUFFER_SIZE - 1)] = Data[loc_index];
+                SPI_SlaveTxHead++;
+            }
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        __SPI_SetInterruptStatus(loc_status);
+
+        return loc_ret;
+    }
+
+    Std_ReturnType SPI_Slave_GetRxAvailable(const SPI_InitTypeDef * const InitPtr, uint8 * const Available_ret)
+    {
+        Std_ReturnType loc_ret = E_OK;
+
+        if ((NULL_PTR != InitPtr) && (NULL_PTR != Available_ret))
+        {
+            *Available_ret = (uint8)(SPI_SlaveRxHead - SPI_SlaveRxTail);
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        return loc_ret;
+    }
+
+    Std_ReturnType SPI_Slave_EndOfFrame(const SPI_InitTypeDef * const InitPtr, uint8 * const Length_ret)
+    {
+        Std_ReturnType loc_ret = E_OK;
+        uint8 loc_status = __SPI_InterruptStatus();
+
+        __SPI_SetInterruptStatus(0);
+
+        if ((NULL_PTR != InitPtr) && (TRUE == SPI_SlaveActive))
+        {
+            if (__SPI_isBufferFull())
+            {
+                SPI_SlaveExchange();
+                INTI_SPI_ClearFlag();
+            }
+
+            SPI_SlaveTxTail = SPI_SlaveTxHead;
+
+            __SPI_ClearReadCollisionFlag();
+            __SPI_ClearWriteCollisionFlag();
+
+            SSPBUF = SPI_SLAVE_FILL_BYTE;
+            SPI_SlaveFillLoaded = TRUE;
+
+            if (NULL_PTR != Length_ret)
+            {
+                *Length_ret = SPI_SlaveFrameLength;
+            }
+
+            SPI_SlaveFrameLength = 0;
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+
+        __SPI_SetInterruptStatus(loc_status);
+
+        return loc_ret;
+    }
+
+    static void SPI_SlaveExchange(void)
+    {
+        uint8 loc_data = SSPBUF;
+
+        // The next response byte is loaded first, the master may clock the following byte right away.
+        if (SPI_SlaveTxHead != SPI_SlaveTxTail)
+        {
+            SSPBUF = SPI_SlaveTxBuffer[SPI_SlaveTxTail & (SPI_SLAVE_TX_BUFFER_SIZE - 1)];
+            SPI_SlaveTxTail++;
+        }
+        else
+        {
+            SSPBUF = SPI_SLAVE_FILL_BYTE;
+        }
+
+        SPI_SlaveFillLoaded = FALSE;
+
+        // A byte is dropped when the receive buffer is full.
+        if ((uint8)(SPI_SlaveRxHead - SPI_SlaveRxTail) < SPI_SLAVE_RX_BUFFER_SIZE)
+        {
+            SPI_SlaveRxBuffer[SPI_SlaveRxHead & (SPI_SLAVE_RX_BUFFER_SIZE - 1)] = loc_data;
+            SPI_SlaveRxHead++;
+        }
+
+        SPI_SlaveFrameLength++;
+
+        __SPI_ClearReadCollisionFlag();
+    }
+    #endif
+
 void SPI_ISR(void)
 {
     INTI_SPI_ClearFlag();
 
+    #if (SPI_SLAVE_BUFFERS_FEATURE == STD_ON)
+    if (TRUE == SPI_SlaveActive)
+    {
+        SPI_SlaveExchange();
+    }
+    #endif
+
+    #if (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON)
+    if (0 != SPI_QueueCount)
+    {
+        SPI_QueueNext();
+    }
+    #endif
+
     if (NULL_PTR != SPI_InterruptHandler)
     {
         SPI_InterruptHandler();
@@ -11,9 +11,12 @@
  * @note Include this header file in your application code to access the SPI control interface.
  * @note The functions and structures defined in this header allow for flexible configuration and control
  *       of SPI communication on compatible microcontrollers.
+ * @note The transaction queue and the buffered slave mode run from the SPI interrupt, they require
+ *       INTERRUPTS_MSSP_INTERRUPTS_OWNER set to INTERRUPTS_MSSP_SPI in Interrupts_Config.h. The default gives the MSSP
+ *       interrupts to I2C, leaving only the blocking transfers.
  * 
- * @version 0.1
- * @date 19.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _SPI_H_
@@ -21,6 +24,7 @@
 
 #include "../GPIO/GPIO.h"
 #include "../Interrupts/Interrupts.h"
+#include "SPI_Config.h"
 
 typedef enum
 {
@@ -70,6 +74,35 @@ typedef struct
 
 } SPI_InitTypeDef;
 
+#if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON) && (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON))
+/**
+ * @brief A device on the SPI bus, selected by its own chip select pin and clocked in its own mode.
+ */
+typedef struct
+{
+    GPIO_InitTypeDef            ChipSelect;     /* Active low */
+    SPI_ModeTypeDef             Mode;           /* One of the master modes, the SPI clock of the device */
+    SPI_ClockPolarityTypeDef    ClockPolarity;
+    SPI_SetupTimeTypeDef        SetupTime;
+    SPI_SampleTimeTypeDef       SampleTime;
+
+} SPI_DeviceTypeDef;
+
+/**
+ * @brief A transaction of the SPI queue, the chip select of its device is held low for all of its bytes.
+ */
+typedef struct
+{
+    const SPI_DeviceTypeDef *   Device;
+    const uint8 *               TxBuffer;       /* NULL_PTR sends Fill for every byte */
+    uint8 *                     RxBuffer;       /* NULL_PTR discards the received bytes, it can be TxBuffer */
+    uint16                      Length;
+    uint8                       Fill;
+    void (*Callback)(void);                     /* Called from the SPI interrupt once complete, or NULL_PTR */
+
+} SPI_TransactionTypeDef;
+#endif
+
 /**
  * @brief Initialize the SPI module with the provided configuration.
  *
@@ -155,4 +188,155 @@ Std_ReturnType SPI_ReadData(const SPI_InitTypeDef * const InitPtr, uint8 * const
  */
 Std_ReturnType SPI_ExchangeData(const SPI_InitTypeDef * const InitPtr, const uint8 Data, uint8 * const DataBufferPtr);
 
+/**
+ * @brief Exchange a buffer over the SPI bus.
+ *
+ * This function sends @param Length bytes from @param TxBuffer and stores the bytes received at the same time in
+ * @param RxBuffer. The parameters are validated once and each byte is sent as soon as the previous one has been
+ * received, so the bus runs back to back at the configured SPI clock.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param TxBuffer Pointer to the bytes to be transmitted.
+ * @param RxBuffer Pointer to the buffer where the received bytes will be stored, it can be @param TxBuffer.
+ * @param Length Number of bytes to be exchanged.
+ * @return Std_ReturnType Error status indicating the success of the data exchange.
+ *     - E_OK: The buffer was exchanged successfully.
+ *     - E_NOT_OK: NULL pointer or transactions pending in the SPI queue.
+ */
+Std_ReturnType SPI_TransferBuffer(const SPI_InitTypeDef * const InitPtr, const uint8 * const TxBuffer,
+                                  uint8 * const RxBuffer, const uint16 Length);
+
+/**
+ * @brief Send a buffer over the SPI bus, the received bytes are flushed.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param TxBuffer Pointer to the bytes to be transmitted.
+ * @param Length Number of bytes to be transmitted.
+ * @return Std_ReturnType Error status indicating the success of the data transmission.
+ *     - E_OK: The buffer was transmitted successfully.
+ *     - E_NOT_OK: NULL pointer or transactions pending in the SPI queue.
+ */
+Std_ReturnType SPI_WriteBuffer(const SPI_InitTypeDef * const InitPtr, const uint8 * const TxBuffer,
+                               const uint16 Length);
+
+/**
+ * @brief Read a buffer from the SPI bus, @param Fill is sent for every byte read.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param RxBuffer Pointer to the buffer where the received bytes will be stored.
+ * @param Length Number of bytes to be read.
+ * @param Fill The byte transmitted while reading, usually 0xFF (e.g. SD cards) or 0x00.
+ * @return Std_ReturnType Error status indicating the success of the data reception.
+ *     - E_OK: The buffer was received successfully.
+ *     - E_NOT_OK: NULL pointer or transactions pending in the SPI queue.
+ */
+Std_ReturnType SPI_ReadBuffer(const SPI_InitTypeDef * const InitPtr, uint8 * const RxBuffer, const uint16 Length,
+                              const uint8 Fill);
+
+#if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON) && (SPI_TRANSACTION_QUEUE_FEATURE == STD_ON))
+
+/**
+ * @brief Initialize the chip select pin of a device of the SPI transaction queue, driven high (deselected).
+ *
+ * @param DevicePtr Pointer to the device.
+ * @return Std_ReturnType Error status indicating the success of the initialization.
+ *     - E_OK: The chip select pin was initialized successfully.
+ *     - E_NOT_OK: NULL @param DevicePtr or invalid pin.
+ */
+Std_ReturnType SPI_Device_Init(const SPI_DeviceTypeDef * const DevicePtr);
+
+/**
+ * @brief Queue a transaction, it runs from the SPI interrupt once the transactions queued before it are complete.
+ *
+ * The transactions run back to back, the clock mode of the MSSP is only reprogrammed when the device changes from
+ * one transaction to the next. The CPU is free while the bytes are shifted.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param TransactionPtr Pointer to the transaction, which must stay unchanged until its callback is called.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The transaction was queued successfully.
+ *     - E_NOT_OK: NULL pointer, no bytes, a slave mode device or the queue is full.
+ *
+ * @note Callbacks may queue the next transactions.
+ * @note The blocking transfers return E_NOT_OK while transactions are pending, once the queue is empty they run in the
+ *       clock mode of the last device of the queue until SPI_Init() is called again.
+ */
+Std_ReturnType SPI_Queue_AddTransaction(const SPI_InitTypeDef * const InitPtr,
+                                        const SPI_TransactionTypeDef * const TransactionPtr);
+
+/**
+ * @brief Retrieve the number of transactions waiting in the SPI queue, including the one in progress.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param Pending_ret Pointer to a variable where the number of pending transactions is stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The number of transactions was stored successfully.
+ *     - E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType SPI_Queue_GetPendingTransactions(const SPI_InitTypeDef * const InitPtr, uint8 * const Pending_ret);
+
+#endif
+
+#if ((INTERRUPTS_SPI_INTERRUPTS_FEATURE == STD_ON) && (SPI_SLAVE_BUFFERS_FEATURE == STD_ON))
+
+/*
+ * In the slave modes, the SPI interrupt moves every byte received from the master to a receive ring buffer and
+ * loads the next byte of the response buffer, or SPI_SLAVE_FILL_BYTE, to be shifted out with the following byte.
+ * The master must leave the SPI interrupt latency between its bytes for the response to be loaded in time.
+ *
+ * Frames are delimited by the SS line of the master. RA5 (SS) has no interrupt of its own, so SS is also wired to
+ * an INTx or RB4..RB7 pin and the rising edge handler calls SPI_Slave_EndOfFrame().
+ */
+
+/**
+ * @brief Read a byte received in the SPI slave mode.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param Data_ret Pointer to a variable where the oldest received byte is stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: A byte was read successfully.
+ *     - E_NOT_OK: NULL pointer or no byte was received.
+ */
+Std_ReturnType SPI_Slave_Read(const SPI_InitTypeDef * const InitPtr, uint8 * const Data_ret);
+
+/**
+ * @brief Queue response bytes, shifted out to the master with the next bytes it clocks.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param Data Pointer to the response bytes.
+ * @param Length Number of response bytes.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: All of the bytes were queued.
+ *     - E_NOT_OK: NULL pointer or not enough room in the response buffer, no byte was queued.
+ */
+Std_ReturnType SPI_Slave_Write(const SPI_InitTypeDef * const InitPtr, const uint8 * const Data, const uint8 Length);
+
+/**
+ * @brief Retrieve the number of received bytes waiting to be read in the SPI slave mode.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param Available_ret Pointer to a variable where the number of bytes is stored.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The number of bytes was stored successfully.
+ *     - E_NOT_OK: NULL pointer.
+ */
+Std_ReturnType SPI_Slave_GetRxAvailable(const SPI_InitTypeDef * const InitPtr, uint8 * const Available_ret);
+
+/**
+ * @brief Close the current frame of the SPI slave mode, called on the rising edge of SS.
+ *
+ * A byte received and not yet serviced by the SPI interrupt is stored first. The response bytes not clocked out by
+ * the master are dropped, so a late response never leaks into the next frame, and SPI_SLAVE_FILL_BYTE is loaded.
+ * The response to the frame is queued with SPI_Slave_Write() afterwards.
+ *
+ * @param InitPtr Pointer to the SPI initialization structure containing configuration parameters.
+ * @param Length_ret Pointer to a variable where the number of bytes received in the frame is stored, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The frame was closed.
+ *     - E_NOT_OK: NULL @param InitPtr or the SPI module is not in a slave mode.
+ */
+Std_ReturnType SPI_Slave_EndOfFrame(const SPI_InitTypeDef * const InitPtr, uint8 * const Length_ret);
+
+#endif
+
 #endif /* _SPI_H_ */
\ No newline at end of file
@@ -0,0 +1,84 @@
+/**
+ * @file SPI_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief SPI Module Configuration
+ *
+ * The `SPI_Config.h` header file offers a centralized location to configure the SPI module, such as the
+ * interrupt-driven transaction queue of the master mode and the receive and transmit buffers of the slave mode.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SPI_CONFIG_H_
+#define _SPI_CONFIG_H_
+
+/**
+ * @def SPI_TRANSACTION_QUEUE_FEATURE
+ * @brief Control macro to enable or disable the SPI transaction queue.
+ *        Used when INTERRUPTS_MSSP_INTERRUPTS_OWNER is INTERRUPTS_MSSP_SPI.
+ *     - STD_ON: Transactions with their own device, chip select and clock mode are queued and run from the SPI
+ *               interrupt.
+ *     - STD_OFF: Only the blocking transfers are available.
+ */
+#define SPI_TRANSACTION_QUEUE_FEATURE                           STD_ON
+
+/**
+ * @def SPI_TRANSACTION_QUEUE_SIZE
+ * @brief Number of transactions the queue can hold, a power of two from 2 to 128.
+ */
+#define SPI_TRANSACTION_QUEUE_SIZE                              4
+
+/**
+ * @def SPI_SLAVE_BUFFERS_FEATURE
+ * @brief Control macro to enable or disable the buffered SPI slave mode.
+ *        Used when INTERRUPTS_MSSP_INTERRUPTS_OWNER is INTERRUPTS_MSSP_SPI.
+ *     - STD_ON: In the slave modes, the SPI interrupt stores the received bytes in a ring buffer and loads the next
+ *               response byte for the master.
+ *     - STD_OFF: Only the blocking transfers are available.
+ */
+#define SPI_SLAVE_BUFFERS_FEATURE                               STD_ON
+
+/**
+ * @def SPI_SLAVE_RX_BUFFER_SIZE
+ * @brief Number of bytes of the slave receive ring buffer, a power of two from 2 to 128.
+ */
+#define SPI_SLAVE_RX_BUFFER_SIZE                                32
+
+/**
+ * @def SPI_SLAVE_TX_BUFFER_SIZE
+ * @brief Number of bytes of the slave response ring buffer, a power of two from 2 to 128.
+ */
+#define SPI_SLAVE_TX_BUFFER_SIZE                                32
+
+/**
+ * @def SPI_SLAVE_FILL_BYTE
+ * @brief Byte sent by the slave when no response byte is waiting.
+ */
+#define SPI_SLAVE_FILL_BYTE                                     0xFF
+
+#if ((SPI_TRANSACTION_QUEUE_FEATURE != STD_ON) && (SPI_TRANSACTION_QUEUE_FEATURE != STD_OFF))
+#warning "'SPI_TRANSACTION_QUEUE_FEATURE' not configured in SPI_Config.h"
+#endif
+
+#if ((SPI_TRANSACTION_QUEUE_SIZE < 2) || (SPI_TRANSACTION_QUEUE_SIZE > 128) || \
+     ((SPI_TRANSACTION_QUEUE_SIZE & (SPI_TRANSACTION_QUEUE_SIZE - 1)) != 0))
+#error "'SPI_TRANSACTION_QUEUE_SIZE' must be a power of two from 2 to 128 in SPI_Config.h"
+#endif
+
+#if ((SPI_SLAVE_BUFFERS_FEATURE != STD_ON) && (SPI_SLAVE_BUFFERS_FEATURE != STD_OFF))
+#warning "'SPI_SLAVE_BUFFERS_FEATURE' not configured in SPI_Config.h"
+#endif
+
+#if ((SPI_SLAVE_RX_BUFFER_SIZE < 2) || (SPI_SLAVE_RX_BUFFER_SIZE > 128) || \
+     ((SPI_SLAVE_RX_BUFFER_SIZE & (SPI_SLAVE_RX_BUFFER_SIZE - 1)) != 0))
+#error "'SPI_SLAVE_RX_BUFFER_SIZE' must be a power of two from 2 to 128 in SPI_Config.h"
+#endif
+
+#if ((SPI_SLAVE_TX_BUFFER_SIZE < 2) || (SPI_SLAVE_TX_BUFFER_SIZE > 128) || \
+     ((SPI_SLAVE_TX_BUFFER_SIZE & (SPI_SLAVE_TX_BUFFER_SIZE - 1)) != 0))
+#error "'SPI_SLAVE_TX_BUFFER_SIZE' must be a power of two from 2 to 128 in SPI_Config.h"
+#endif
+
+#endif /* _SPI_CONFIG_H_ */
@@ -13,8 +13,8 @@
  *       not be accessed externally.
  * @note External users should refer to the public SPI interface provided in "SPI.h" for SPI module control.
  * 
- * @version 0.1
- * @date 19.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _SPI_PRIVATE_H_
@@ -29,9 +29,16 @@
 #define __SPI_ConfigSampleTime(x)           (SSPSTATbits.SMP = x)
 #define __SPI_ConfigSetupTime(x)            (SSPSTATbits.CKE = x)
 #define __SPI_ConfigMode(x)                 (SSPCON1bits.SSPM = x)
+#define __SPI_isMasterMode()                (SSPCON1bits.SSPM < 4)
+
+#define __SPI_InterruptStatus()             (PIE1bits.SSPIE)
+#define __SPI_SetInterruptStatus(x)         (PIE1bits.SSPIE = x)
+
+#define __SPI_isBufferFull()                (SSPSTATbits.BF)
 
 #define __SPI_isWriteCollisionDetected()    (SSPCON1bits.WCOL)
 #define __SPI_isReadCollisionDetected()     (SSPCON1bits.SSPOV)
 #define __SPI_ClearReadCollisionFlag()      (SSPCON1bits.SSPOV = 0)
+#define __SPI_ClearWriteCollisionFlag()     (SSPCON1bits.WCOL = 0)
 
 #endif /* _SPI_PRIVATE_H_ */
\ No newline at end of file
@@ -0,0 +1,286 @@
+/**
+ * @file SWTIMER.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "SWTIMER_Private.h"
+
+static SWTIMER_TimerTypeDef SWTIMER_Timers[SWTIMER_NUMBER_OF_TIMERS];
+static uint8 SWTIMER_Slots[SWTIMER_NUMBER_OF_SLOTS];
+static volatile uint16 SWTIMER_Now = 0;
+
+#if (SWTIMER_TIMER0_TICK_FEATURE == STD_ON)
+#if (INTERRUPTS_TIMER0_INTERRUPTS_FEATURE != STD_ON)
+#error "'SWTIMER_TIMER0_TICK_FEATURE' requires 'INTERRUPTS_TIMER0_INTERRUPTS_FEATURE' in Interrupts_Config.h"
+#endif
+
+/* 1 us counts at 8 MHz, TIMER0_ISR reloads the counter every tick */
+static const TIMER0_InitTypeDef SWTIMER_TickTimer = {
+    .Resolution = TIMER0_RESOLUTION_16BIT,
+    .Mode = TIMER0_MODE_TIMER,
+    .Prescaler = TIMER0_PRESCALER_2,
+    .InterruptHandler = SWTIMER_Tick,
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    .Priority = SWTIMER_TICK_PRIORITY
+    #endif
+};
+#endif
+
+static uint8 SWTIMER_EnterCriticalSection(void);
+static void SWTIMER_ExitCriticalSection(const uint8 loc_status);
+static void SWTIMER_Link(const SWTIMER_IdTypeDef loc_id);
+static void SWTIMER_Unlink(const SWTIMER_IdTypeDef loc_id);
+
+Std_ReturnType SWTIMER_Init(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+    for (loc_index = 0; loc_index < SWTIMER_NUMBER_OF_SLOTS; loc_index++)
+    {
+        SWTIMER_Slots[loc_index] = SWTIMER_NONE;
+    }
+
+    for (loc_index = 0; loc_index < SWTIMER_NUMBER_OF_TIMERS; loc_index++)
+    {
+        SWTIMER_Timers[loc_index].Callback = NULL_PTR;
+        SWTIMER_Timers[loc_index].Period = 0;
+        SWTIMER_Timers[loc_index].Slot = SWTIMER_NONE;
+    }
+
+    SWTIMER_Now = 0;
+
+#if (SWTIMER_TIMER0_TICK_FEATURE == STD_ON)
+    loc_ret = TIMER0_Init(&SWTIMER_TickTimer);
+    loc_ret |= TIMER0_StartTimer(&SWTIMER_TickTimer, SWTIMER_TICK_PERIOD_MS);
+#endif
+
+    return loc_ret;
+}
+
+Std_ReturnType SWTIMER_DeInit(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+#if (SWTIMER_TIMER0_TICK_FEATURE == STD_ON)
+    loc_ret = TIMER0_DeInit(&SWTIMER_TickTimer);
+#endif
+
+    for (loc_index = 0; loc_index < SWTIMER_NUMBER_OF_TIMERS; loc_index++)
+    {
+        (void)SWTIMER_Stop(loc_index);
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SWTIMER_Start(const SWTIMER_IdTypeDef Id, const uint32 Period_ms, const SWTIMER_ModeTypeDef Mode,
+                             void (* const Callback)(void))
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint32 loc_period = (Period_ms + (SWTIMER_TICK_PERIOD_MS - 1)) / SWTIMER_TICK_PERIOD_MS;
+    uint8 loc_status = 0;
+
+    if ((Id < SWTIMER_NUMBER_OF_TIMERS) && (Mode < SWTIMER_MODE_LIMIT) && (0 != loc_period) &&
+        (loc_period <= SWTIMER_MAX_PERIOD_TICKS))
+    {
+        loc_status = SWTIMER_EnterCriticalSection();
+
+        SWTIMER_Unlink(Id);
+
+        SWTIMER_Timers[Id].Callback = Callback;
+        SWTIMER_Timers[Id].Period = (uint16)loc_period;
+        SWTIMER_Timers[Id].Mode = Mode;
+        SWTIMER_Timers[Id].Expiry = SWTIMER_Now + (uint16)loc_period;
+
+        SWTIMER_Link(Id);
+
+        SWTIMER_ExitCriticalSection(loc_status);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SWTIMER_Stop(const SWTIMER_IdTypeDef Id)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = 0;
+
+    if (Id < SWTIMER_NUMBER_OF_TIMERS)
+    {
+        loc_status = SWTIMER_EnterCriticalSection();
+
+        SWTIMER_Unlink(Id);
+
+        SWTIMER_ExitCriticalSection(loc_status);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SWTIMER_Restart(const SWTIMER_IdTypeDef Id)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_status = 0;
+
+    if ((Id < SWTIMER_NUMBER_OF_TIMERS) && (0 != SWTIMER_Timers[Id].Period))
+    {
+        loc_status = SWTIMER_EnterCriticalSection();
+
+        SWTIMER_Unlink(Id);
+
+        SWTIMER_Timers[Id].Expiry = SWTIMER_Now + SWTIMER_Timers[Id].Period;
+
+        SWTIMER_Link(Id);
+
+        SWTIMER_ExitCriticalSection(loc_status);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SWTIMER_IsRunning(const SWTIMER_IdTypeDef Id, boolean * const Running_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((Id < SWTIMER_NUMBER_OF_TIMERS) && (NULL_PTR != Running_ret))
+    {
+        *Running_ret = (SWTIMER_NONE != SWTIMER_Timers[Id].Slot) ? TRUE : FALSE;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+void SWTIMER_Tick(void)
+{
+    uint8 loc_level = 0;
+    uint8 loc_shift = 0;
+    uint8 loc_slot = 0;
+    SWTIMER_IdTypeDef loc_id = 0;
+
+    SWTIMER_Now++;
+
+    /* Each level whose lower levels wrapped around hands its next slot down, lowest level first */
+    for (loc_level = 1, loc_shift = SWTIMER_WHEEL_SLOT_BITS;
+         (loc_level < SWTIMER_WHEEL_LEVELS) && (0 == (SWTIMER_Now & ((1U << loc_shift) - 1U)));
+         loc_level++, loc_shift += SWTIMER_WHEEL_SLOT_BITS)
+    {
+        loc_slot = (uint8)((loc_level * SWTIMER_WHEEL_SLOTS) + ((SWTIMER_Now >> loc_shift) & (SWTIMER_WHEEL_SLOTS - 1)));
+
+        while (SWTIMER_NONE != SWTIMER_Slots[loc_slot])
+        {
+            loc_id = SWTIMER_Slots[loc_slot];
+
+            SWTIMER_Unlink(loc_id);
+            SWTIMER_Link(loc_id);
+        }
+    }
+
+    /*
+     * Every timer of the due slot expires now. Nothing can be linked to this slot before the wheel turns again, the
+     * shortest period is 1 tick, so the callbacks are free to start and stop any timer.
+     */
+    loc_slot = (uint8)(SWTIMER_Now & (SWTIMER_WHEEL_SLOTS - 1));
+
+    while (SWTIMER_NONE != SWTIMER_Slots[loc_slot])
+    {
+        loc_id = SWTIMER_Slots[loc_slot];
+
+        SWTIMER_Unlink(loc_id);
+
+        if (SWTIMER_MODE_PERIODIC == SWTIMER_Timers[loc_id].Mode)
+        {
+            SWTIMER_Timers[loc_id].Expiry += SWTIMER_Timers[loc_id].Period;
+            SWTIMER_Link(loc_id);
+        }
+
+        if (NULL_PTR != SWTIMER_Timers[loc_id].Callback)
+        {
+            SWTIMER_Timers[loc_id].Callback();
+        }
+    }
+}
+
+static uint8 SWTIMER_EnterCriticalSection(void)
+{
+    uint8 loc_status = SWTIMER_TickInterruptStatus();
+
+    SWTIMER_SetTickInterruptStatus(0);
+
+    return loc_status;
+}
+
+static void SWTIMER_ExitCriticalSection(const uint8 loc_status)
+{
+    SWTIMER_SetTickInterruptStatus(loc_status);
+}
+
+static void SWTIMER_Link(const SWTIMER_IdTypeDef loc_id)
+{
+    SWTIMER_TimerTypeDef * const loc_timer = &SWTIMER_Timers[loc_id];
+    uint16 loc_remaining = loc_timer->Expiry - SWTIMER_Now;
+    uint8 loc_level = 0;
+    uint8 loc_shift = 0;
+
+    // The lowest level whose slots still reach the expiry tick.
+    while ((loc_level < (SWTIMER_WHEEL_LEVELS - 1)) && ((loc_remaining >> loc_shift) >= SWTIMER_WHEEL_SLOTS))
+    {
+        loc_level++;
+        loc_shift += SWTIMER_WHEEL_SLOT_BITS;
+    }
+
+    loc_timer->Slot = (uint8)((loc_level * SWTIMER_WHEEL_SLOTS) + ((loc_timer->Expiry >> loc_shift) & (SWTIMER_WHEEL_SLOTS - 1)));
+    loc_timer->Previous = SWTIMER_NONE;
+    loc_timer->Next = SWTIMER_Slots[loc_timer->Slot];
+
+    if (SWTIMER_NONE != loc_timer->Next)
+    {
+        SWTIMER_Timers[loc_timer->Next].Previous = loc_id;
+    }
+
+    SWTIMER_Slots[loc_timer->Slot] = loc_id;
+}
+
+static void SWTIMER_Unlink(const SWTIMER_IdTypeDef loc_id)
+{
+    SWTIMER_TimerTypeDef * const loc_timer = &SWTIMER_Timers[loc_id];
+
+    if (SWTIMER_NONE != loc_timer->Slot)
+    {
+        if (SWTIMER_NONE != loc_timer->Previous)
+        {
+            SWTIMER_Timers[loc_timer->Previous].Next = loc_timer->Next;
+        }
+        else
+        {
+            SWTIMER_Slots[loc_timer->Slot] = loc_timer->Next;
+        }
+
+        if (SWTIMER_NONE != loc_timer->Next)
+        {
+            SWTIMER_Timers[loc_timer->Next].Previous = loc_timer->Previous;
+        }
+
+        loc_timer->Slot = SWTIMER_NONE;
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file SWTIMER.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Software Timers Interface
+ *
+ * The software timers interface multiplexes any number of one-shot and periodic timers on a single hardware tick.
+ * Each timer is identified by a number from 0 to SWTIMER_NUMBER_OF_TIMERS - 1, assigned by the application, and
+ * calls its callback from the tick interrupt when it expires. Starting, stopping and the tick processing take the
+ * same time whatever the number of armed timers.
+ *
+ * @note Include this header file in your application code to access the software timers interface.
+ * @note The callbacks run in interrupt context, they can start, stop and restart any timer, including their own.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SWTIMER_H_
+#define _SWTIMER_H_
+
+#include "../TIMER0/TIMER0.h"
+#include "SWTIMER_Config.h"
+
+/**
+ * @brief Longest period of a software timer, in ticks.
+ */
+#define SWTIMER_MAX_PERIOD_TICKS                    0xFFFFU
+
+typedef uint8 SWTIMER_IdTypeDef;
+
+typedef enum
+{
+    SWTIMER_MODE_ONE_SHOT = 0,
+    SWTIMER_MODE_PERIODIC,
+    SWTIMER_MODE_LIMIT
+
+} SWTIMER_ModeTypeDef;
+
+/**
+ * @brief Initializes the software timer service.
+ *
+ * Every timer is stopped and the tick counter is cleared. With SWTIMER_TIMER0_TICK_FEATURE enabled, TIMER0 is
+ * initialized and started with a period of SWTIMER_TICK_PERIOD_MS.
+ *
+ * @return Std_ReturnType Error status indicating the success of the initialization.
+ *     - E_OK: The service was initialized successfully.
+ *     - E_NOT_OK: An error occurred while starting the hardware tick.
+ */
+Std_ReturnType SWTIMER_Init(void);
+
+/**
+ * @brief Deinitializes the software timer service, every timer is stopped and the hardware tick is released.
+ *
+ * @return Std_ReturnType Error status indicating the success of the deinitialization.
+ *     - E_OK: The service was deinitialized successfully.
+ *     - E_NOT_OK: An error occurred while releasing the hardware tick.
+ */
+Std_ReturnType SWTIMER_DeInit(void);
+
+/**
+ * @brief Starts a software timer, a timer that is already running is restarted with the new settings.
+ *
+ * @param Id Identifier of the timer.
+ * @param Period_ms Period of the timer in milliseconds, rounded up to a whole number of ticks.
+ * @param Mode SWTIMER_MODE_ONE_SHOT to expire once, SWTIMER_MODE_PERIODIC to expire every @param Period_ms.
+ * @param Callback Function called when the timer expires, NULL_PTR for a timer that is only polled.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The timer was started successfully.
+ *     - E_NOT_OK: An error occurred (e.g., invalid @param Id or @param Period_ms of 0 or above
+ *       SWTIMER_MAX_PERIOD_TICKS ticks).
+ *
+ * @note Periodic timers are re-armed from their previous expiry, so their period does not drift.
+ */
+Std_ReturnType SWTIMER_Start(const SWTIMER_IdTypeDef Id, const uint32 Period_ms, const SWTIMER_ModeTypeDef Mode,
+                             void (* const Callback)(void));
+
+/**
+ * @brief Stops a software timer, stopping a timer that is not running has no effect.
+ *
+ * @param Id Identifier of the timer.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The timer is stopped.
+ *     - E_NOT_OK: Invalid @param Id.
+ */
+Std_ReturnType SWTIMER_Stop(const SWTIMER_IdTypeDef Id);
+
+/**
+ * @brief Restarts a software timer from now with the settings of its last SWTIMER_Start().
+ *
+ * @param Id Identifier of the timer.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The timer was restarted successfully.
+ *     - E_NOT_OK: Invalid @param Id or the timer was never started.
+ */
+Std_ReturnType SWTIMER_Restart(const SWTIMER_IdTypeDef Id);
+
+/**
+ * @brief Retrieves whether a software timer is running.
+ *
+ * @param Id Identifier of the timer.
+ * @param Running_ret Pointer to a boolean variable, TRUE while the timer is armed.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The status was stored successfully.
+ *     - E_NOT_OK: Invalid @param Id or NULL @param Running_ret.
+ */
+Std_ReturnType SWTIMER_IsRunning(const SWTIMER_IdTypeDef Id, boolean * const Running_ret);
+
+/**
+ * @brief Advances the software timers by one tick and calls the callbacks of the expired timers.
+ *
+ * Called from TIMER0_ISR with SWTIMER_TIMER0_TICK_FEATURE enabled, otherwise from the application's periodic
+ * interrupt every SWTIMER_TICK_PERIOD_MS.
+ */
+void SWTIMER_Tick(void);
+
+#endif /* _SWTIMER_H_ */
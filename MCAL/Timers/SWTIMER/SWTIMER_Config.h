@@ -0,0 +1,55 @@
+/**
+ * @file SWTIMER_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief Software Timers Configuration
+ *
+ * The `SWTIMER_Config.h` header file offers a centralized location to configure the software timer service, such
+ * as the number of timers, the tick period and the hardware timer the tick is taken from.
+ * 
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SWTIMER_CONFIG_H_
+#define _SWTIMER_CONFIG_H_
+
+/**
+ * @def SWTIMER_NUMBER_OF_TIMERS
+ * @brief Number of software timers, identified from 0 to SWTIMER_NUMBER_OF_TIMERS - 1 (1 to 254).
+ */
+#define SWTIMER_NUMBER_OF_TIMERS                                8
+
+/**
+ * @def SWTIMER_TICK_PERIOD_MS
+ * @brief Period of the tick in milliseconds, the resolution of every software timer.
+ */
+#define SWTIMER_TICK_PERIOD_MS                                  1
+
+/**
+ * @def SWTIMER_TIMER0_TICK_FEATURE
+ * @brief Control macro to select the source of the tick.
+ *     - STD_ON: SWTIMER_Init() runs TIMER0 and SWTIMER_Tick() is called from TIMER0_ISR.
+ *     - STD_OFF: The application calls SWTIMER_Tick() every SWTIMER_TICK_PERIOD_MS from its own periodic interrupt.
+ */
+#define SWTIMER_TIMER0_TICK_FEATURE                             STD_ON
+
+/**
+ * @def SWTIMER_TICK_PRIORITY
+ * @brief Priority of the TIMER0 tick interrupt, used when INTERRUPTS_PRIORITY_FEATURE is STD_ON.
+ */
+#define SWTIMER_TICK_PRIORITY                                   INTERRUPTS_LOW_PRIORITY
+
+#if ((SWTIMER_NUMBER_OF_TIMERS < 1) || (SWTIMER_NUMBER_OF_TIMERS > 254))
+#error "'SWTIMER_NUMBER_OF_TIMERS' must be from 1 to 254 in SWTIMER_Config.h"
+#endif
+
+#if (SWTIMER_TICK_PERIOD_MS < 1)
+#error "'SWTIMER_TICK_PERIOD_MS' must be at least 1 in SWTIMER_Config.h"
+#endif
+
+#if ((SWTIMER_TIMER0_TICK_FEATURE != STD_ON) && (SWTIMER_TIMER0_TICK_FEATURE != STD_OFF))
+#warning "'SWTIMER_TIMER0_TICK_FEATURE' not configured in SWTIMER_Config.h"
+#endif
+
+#endif /* _SWTIMER_CONFIG_H_ */
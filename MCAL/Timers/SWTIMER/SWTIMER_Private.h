@@ -0,0 +1,57 @@
+/**
+ * @file SWTIMER_Private.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief Private Software Timers Services
+ *
+ * The SWTIMER_Private.h header file contains the timing wheel layout and the private services of the software
+ * timer module, meant for internal use only.
+ *
+ * The armed timers are kept in a hierarchical timing wheel of SWTIMER_WHEEL_LEVELS levels of SWTIMER_WHEEL_SLOTS
+ * slots each: a slot of level n spans SWTIMER_WHEEL_SLOTS^n ticks. A timer is linked in the slot of its expiry
+ * tick at the lowest level that can hold its remaining ticks, and moved down a level when the levels below it
+ * wrap around, so starting, stopping and the per tick processing never walk the timers that are not due.
+ *
+ * @note Include this header file only in implementation files that require access to private software timers
+ *       services.
+ * 
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SWTIMER_PRIVATE_H_
+#define _SWTIMER_PRIVATE_H_
+
+#include "SWTIMER.h"
+#include "../../mcu_registers.h"
+
+/* 4 levels of 16 slots cover the 16-bit tick counter, the longest period is 65535 ticks */
+#define SWTIMER_WHEEL_SLOT_BITS                     4
+#define SWTIMER_WHEEL_SLOTS                         (1 << SWTIMER_WHEEL_SLOT_BITS)
+#define SWTIMER_WHEEL_LEVELS                        4
+#define SWTIMER_NUMBER_OF_SLOTS                     (SWTIMER_WHEEL_LEVELS * SWTIMER_WHEEL_SLOTS)
+
+#define SWTIMER_NONE                                0xFF
+
+#if (SWTIMER_TIMER0_TICK_FEATURE == STD_ON)
+#define SWTIMER_TickInterruptStatus()               (INTCONbits.TMR0IE)
+#define SWTIMER_SetTickInterruptStatus(x)           (INTCONbits.TMR0IE = x)
+#else
+#define SWTIMER_TickInterruptStatus()               (INTCONbits.GIE)
+#define SWTIMER_SetTickInterruptStatus(x)           (INTCONbits.GIE = x)
+#endif
+
+typedef struct
+{
+    void (*Callback)(void);
+    uint16 Period;
+    uint16 Expiry;
+    SWTIMER_ModeTypeDef Mode;
+
+    uint8 Slot;
+    uint8 Next;
+    uint8 Previous;
+
+} SWTIMER_TimerTypeDef;
+
+#endif /* _SWTIMER_PRIVATE_H_ */
@@ -0,0 +1,159 @@
+/**
+ * @file TIME.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.2
+ * @date 18.10.26
+ */
+
+#include "TIME_Private.h"
+
+static volatile uint16 TIME_Overflows = 0;
+
+#if (TIME_TICKS_PER_MICROSECOND > 1)
+/* Microseconds and leftover ticks of the serviced overflows, so the microsecond count wraps at 2^32 */
+static volatile uint32 TIME_MicrosBase = 0;
+static volatile uint8 TIME_MicrosRemainder = 0;
+
+static void TIME_AddOverflowMicros(uint32 * const loc_base, uint8 * const loc_remainder);
+#endif
+
+static void TIME_OverflowHandler(void);
+
+static const TIME_InitTypeDef TIME_Timer = {
+    .Mode = TIME_TIMER_MODE,
+    .Prescaler = TIME_TIMER_PRESCALER,
+    .InterruptHandler = TIME_OverflowHandler,
+
+    #if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    .Priority = TIME_OVERFLOW_PRIORITY
+    #endif
+};
+
+static uint16 TIME_ReadCounter(void);
+
+Std_ReturnType TIME_Init(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    loc_ret = TIME_TimerInit(&TIME_Timer);
+
+    // TMR high byte first, both bytes are written together with the low byte.
+    TIME_CounterRegisterHigh() = 0;
+    TIME_CounterRegisterLow() = 0;
+    TIME_Overflows = 0;
+
+#if (TIME_TICKS_PER_MICROSECOND > 1)
+    TIME_MicrosBase = 0;
+    TIME_MicrosRemainder = 0;
+#endif
+
+    loc_ret |= TIME_TimerStart(&TIME_Timer);
+
+    return loc_ret;
+}
+
+Std_ReturnType TIME_DeInit(void)
+{
+    return TIME_TimerDeInit(&TIME_Timer);
+}
+
+uint32 TIME_GetTicks32(void)
+{
+    uint16 loc_overflows = 0;
+    uint16 loc_counter = 0;
+    uint8 loc_status = TIME_OverflowInterruptStatus();
+
+    TIME_SetOverflowInterruptStatus(0);
+
+    loc_overflows = TIME_Overflows;
+    loc_counter = TIME_ReadCounter();
+
+    /*
+     * A pending overflow is not counted in TIME_Overflows yet. The counter may have been read before or after it,
+     * it is read again to be sure it is past the overflow.
+     */
+    if (1 == TIME_OverflowFlag())
+    {
+        loc_counter = TIME_ReadCounter();
+        loc_overflows++;
+    }
+
+    TIME_SetOverflowInterruptStatus(loc_status);
+
+    return ((uint32)loc_overflows << 16) | loc_counter;
+}
+
+uint32 TIME_GetMicros(void)
+{
+#if (TIME_TICKS_PER_MICROSECOND > 1)
+    uint32 loc_base = 0;
+    uint8 loc_remainder = 0;
+    uint16 loc_counter = 0;
+    uint8 loc_status = TIME_OverflowInterruptStatus();
+
+    TIME_SetOverflowInterruptStatus(0);
+
+    loc_base = TIME_MicrosBase;
+    loc_remainder = TIME_MicrosRemainder;
+    loc_counter = TIME_ReadCounter();
+
+    // A pending overflow is handled as in TIME_GetTicks32().
+    if (1 == TIME_OverflowFlag())
+    {
+        loc_counter = TIME_ReadCounter();
+        TIME_AddOverflowMicros(&loc_base, &loc_remainder);
+    }
+
+    TIME_SetOverflowInterruptStatus(loc_status);
+
+    return loc_base + (((uint32)loc_remainder + loc_counter) / TIME_TICKS_PER_MICROSECOND);
+#else
+    return TIME_GetTicks32();
+#endif
+}
+
+uint32 TIME_ExtendTicks(const uint16 Ticks)
+{
+    uint32 loc_now = TIME_GetTicks32();
+
+    // Less than 2^16 ticks ago, the distance back to Ticks is the 16-bit difference whatever the overflows between.
+    return loc_now - (uint16)((uint16)loc_now - Ticks);
+}
+
+static void TIME_OverflowHandler(void)
+{
+#if (TIME_TICKS_PER_MICROSECOND > 1)
+    uint32 loc_base = TIME_MicrosBase;
+    uint8 loc_remainder = TIME_MicrosRemainder;
+
+    TIME_AddOverflowMicros(&loc_base, &loc_remainder);
+
+    TIME_MicrosBase = loc_base;
+    TIME_MicrosRemainder = loc_remainder;
+#endif
+
+    TIME_Overflows++;
+}
+
+#if (TIME_TICKS_PER_MICROSECOND > 1)
+static void TIME_AddOverflowMicros(uint32 * const loc_base, uint8 * const loc_remainder)
+{
+    // An overflow is 65536 ticks, the ticks short of a whole microsecond are carried to the next one.
+    *loc_base += 65536UL / TIME_TICKS_PER_MICROSECOND;
+    *loc_remainder += (uint8)(65536UL % TIME_TICKS_PER_MICROSECOND);
+
+    if (*loc_remainder >= TIME_TICKS_PER_MICROSECOND)
+    {
+        *loc_remainder -= TIME_TICKS_PER_MICROSECOND;
+        (*loc_base)++;
+    }
+}
+#endif
+
+static uint16 TIME_ReadCounter(void)
+{
+    // Reading the low byte first latches the high byte (16-bit read/write mode).
+    uint8 loc_low = (uint8)TIME_CounterRegisterLow();
+
+    return (uint16)(((uint16)TIME_CounterRegisterHigh() << 8) | loc_low);
+}
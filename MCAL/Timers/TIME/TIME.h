@@ -0,0 +1,80 @@
+/**
+ * @file TIME.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Free-Running Time Base Interface
+ *
+ * The time base runs TIMER1 (or TIMER3, see TIME_Config.h) free-running and extends its 16-bit count to 32 bits
+ * with an overflow counter kept by the overflow interrupt. The timestamps are monotonic and cheap to take, for
+ * profiling, protocol timeouts and capture arithmetic; differences of timestamps are correct across the 32-bit
+ * wrap around when computed in uint32.
+ *
+ * @note Include this header file in your application code to access the time base interface.
+ * @note The timestamps can be taken with the global interrupts disabled and from interrupt handlers, an overflow
+ *       that is not serviced yet is accounted for. The 32-bit count is only extended while overflows are serviced
+ *       at least once every 65536 ticks.
+ *
+ * @version 0.2
+ * @date 18.10.26
+ */
+
+#ifndef _TIME_H_
+#define _TIME_H_
+
+#include "../TIMER1/TIMER1.h"
+#include "../TIMER3/TIMER3.h"
+#include "TIME_Config.h"
+#include "../../mcu_config.h"
+
+/**
+ * @brief Number of time base ticks per second.
+ */
+#define TIME_TICKS_PER_SECOND                                   ((FOSC / 4UL) / TIME_PRESCALER)
+
+/**
+ * @brief Initializes the time base timer and starts it free-running from 0.
+ *
+ * @return Std_ReturnType Error status indicating the success of the initialization.
+ *     - E_OK: The time base was started successfully.
+ *     - E_NOT_OK: An error occurred while configuring the timer.
+ */
+Std_ReturnType TIME_Init(void);
+
+/**
+ * @brief Stops the time base timer and releases it.
+ *
+ * @return Std_ReturnType Error status indicating the success of the deinitialization.
+ *     - E_OK: The time base was stopped successfully.
+ *     - E_NOT_OK: An error occurred while releasing the timer.
+ */
+Std_ReturnType TIME_DeInit(void);
+
+/**
+ * @brief Returns the number of timer ticks since TIME_Init(), FOSC / 4 / TIME_PRESCALER ticks per second.
+ *
+ * @return uint32 32-bit tick count, wrapping around every 2^32 ticks.
+ */
+uint32 TIME_GetTicks32(void);
+
+/**
+ * @brief Returns the number of microseconds since TIME_Init().
+ *
+ * The count is kept in microseconds, it wraps around every 2^32 us (71 minutes) whatever the number of ticks per
+ * microsecond, so differences of microsecond timestamps are correct across the wrap around when computed in uint32.
+ *
+ * @return uint32 Microsecond count, wrapping around every 2^32 us.
+ */
+uint32 TIME_GetMicros(void);
+
+/**
+ * @brief Extends a 16-bit count of the time base timer to the 32-bit tick count of TIME_GetTicks32().
+ *
+ * Meant for counts latched by the hardware, such as a CCP capture of the time base timer, and read back from the
+ * interrupt handler.
+ *
+ * @param Ticks 16-bit timer count, taken less than 2^16 ticks ago.
+ * @return uint32 32-bit tick count of @param Ticks.
+ */
+uint32 TIME_ExtendTicks(const uint16 Ticks);
+
+#endif /* _TIME_H_ */
@@ -0,0 +1,50 @@
+/**
+ * @file TIME_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief Time Base Configuration
+ *
+ * The `TIME_Config.h` header file selects the hardware timer and the tick of the free-running time base.
+ * 
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _TIME_CONFIG_H_
+#define _TIME_CONFIG_H_
+
+#define TIME_TIMER1                                             1
+#define TIME_TIMER3                                             3
+
+/**
+ * @def TIME_TIMER
+ * @brief Hardware timer the time base runs on, TIME_TIMER1 or TIME_TIMER3.
+ *
+ * @note The timer is dedicated to the time base. ADC_StartTriggeredSampling() rejects it as the trigger timer,
+ *       the CCP2 special event would reset it on every match, the ADC has to be triggered from the other timer.
+ *       With TIME_TIMER3 the ADC trigger is left with TIMER1, which also takes CCP1 off the time base.
+ */
+#define TIME_TIMER                                              TIME_TIMER1
+
+/**
+ * @def TIME_PRESCALER
+ * @brief Prescaler of the time base timer (1, 2, 4 or 8), FOSC / 4 / TIME_PRESCALER must be a whole number of
+ *        MHz. 2 gives 1 us ticks at 8 MHz.
+ */
+#define TIME_PRESCALER                                          2
+
+/**
+ * @def TIME_OVERFLOW_PRIORITY
+ * @brief Priority of the overflow interrupt, used when INTERRUPTS_PRIORITY_FEATURE is STD_ON.
+ */
+#define TIME_OVERFLOW_PRIORITY                                  INTERRUPTS_HIGH_PRIORITY
+
+#if ((TIME_TIMER != TIME_TIMER1) && (TIME_TIMER != TIME_TIMER3))
+#error "'TIME_TIMER' must be TIME_TIMER1 or TIME_TIMER3 in TIME_Config.h"
+#endif
+
+#if ((TIME_PRESCALER != 1) && (TIME_PRESCALER != 2) && (TIME_PRESCALER != 4) && (TIME_PRESCALER != 8))
+#error "'TIME_PRESCALER' must be 1, 2, 4 or 8 in TIME_Config.h"
+#endif
+
+#endif /* _TIME_CONFIG_H_ */
@@ -0,0 +1,77 @@
+/**
+ * @file TIME_Private.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * 
+ * @brief Private Time Base Services
+ *
+ * The TIME_Private.h header file maps the time base onto the selected hardware timer, meant for internal use only.
+ *
+ * @note Include this header file only in implementation files that require access to private time base services.
+ * 
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _TIME_PRIVATE_H_
+#define _TIME_PRIVATE_H_
+
+#include "TIME.h"
+#include "../Timers_Private.h"
+
+#define TIME_TICKS_PER_MICROSECOND                  ((FOSC / 4000000UL) / TIME_PRESCALER)
+
+#if ((TIME_TICKS_PER_MICROSECOND < 1) || (((FOSC / 4000000UL) % TIME_PRESCALER) != 0) || ((FOSC % 4000000UL) != 0))
+#error "'TIME_PRESCALER' does not give a whole number of ticks per microsecond in TIME_Config.h"
+#endif
+
+#if (TIME_PRESCALER == 1)
+#define TIME_PRESCALER_SELECT(TIMER)                TIMER##_NO_PRESCALER
+#elif (TIME_PRESCALER == 2)
+#define TIME_PRESCALER_SELECT(TIMER)                TIMER##_PRESCALER_2
+#elif (TIME_PRESCALER == 4)
+#define TIME_PRESCALER_SELECT(TIMER)                TIMER##_PRESCALER_4
+#else
+#define TIME_PRESCALER_SELECT(TIMER)                TIMER##_PRESCALER_8
+#endif
+
+#if (TIME_TIMER == TIME_TIMER1)
+
+#if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE != STD_ON)
+#error "'TIME_TIMER1' requires 'INTERRUPTS_TIMER1_INTERRUPTS_FEATURE' in Interrupts_Config.h"
+#endif
+
+#define TIME_InitTypeDef                            TIMER1_InitTypeDef
+#define TIME_TIMER_MODE                             TIMER1_MODE_TIMER
+#define TIME_TIMER_PRESCALER                        TIME_PRESCALER_SELECT(TIMER1)
+#define TIME_TimerInit(x)                           TIMER1_Init(x)
+#define TIME_TimerDeInit(x)                         TIMER1_DeInit(x)
+#define TIME_TimerStart(x)                          TIMER1_StartFreeRunning(x)
+
+#define TIME_CounterRegisterLow()                   __TIMER1_CounterRegisterLow()
+#define TIME_CounterRegisterHigh()                  __TIMER1_CounterRegisterHigh()
+#define TIME_OverflowFlag()                         (PIR1bits.TMR1IF)
+#define TIME_OverflowInterruptStatus()              (PIE1bits.TMR1IE)
+#define TIME_SetOverflowInterruptStatus(x)          (PIE1bits.TMR1IE = x)
+
+#else
+
+#if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE != STD_ON)
+#error "'TIME_TIMER3' requires 'INTERRUPTS_TIMER3_INTERRUPTS_FEATURE' in Interrupts_Config.h"
+#endif
+
+#define TIME_InitTypeDef                            TIMER3_InitTypeDef
+#define TIME_TIMER_MODE                             TIMER3_MODE_TIMER
+#define TIME_TIMER_PRESCALER                        TIME_PRESCALER_SELECT(TIMER3)
+#define TIME_TimerInit(x)                           TIMER3_Init(x)
+#define TIME_TimerDeInit(x)                         TIMER3_DeInit(x)
+#define TIME_TimerStart(x)                          TIMER3_StartFreeRunning(x)
+
+#define TIME_CounterRegisterLow()                   __TIMER3_CounterRegisterLow()
+#define TIME_CounterRegisterHigh()                  __TIMER3_CounterRegisterHigh()
+#define TIME_OverflowFlag()                         (PIR2bits.TMR3IF)
+#define TIME_OverflowInterruptStatus()              (PIE2bits.TMR3IE)
+#define TIME_SetOverflowInterruptStatus(x)          (PIE2bits.TMR3IE = x)
+
+#endif
+
+#endif /* _TIME_PRIVATE_H_ */
@@ -1,8 +1,8 @@
 /**
  * @file TIMER1.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 07.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "../Timers_Private.h"
@@ -11,6 +11,7 @@
 static uint16 TIMER1_nRequiredInterrupts = 0;
 static uint16 TIMER1_DelayValue = 0;
 static const TIMER1_InitTypeDef * TIMER1_ObjBuffer = NULL_PTR;
+static boolean TIMER1_FreeRunning = FALSE;
 
 #if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE == STD_ON)
 static void (*TIMER1_InterruptHandler)(void) = NULL_PTR;
@@ -39,6 +40,9 @@ Std_ReturnType TIMER1_Init(const TIMER1_InitTypeDef * const InitPtr)
 
         TIMER1_ObjBuffer = InitPtr;
 
+        // TMR1H is latched when TMR1L is read and written with TMR1L, the 16-bit value is never torn.
+        __TIMER1_Enable16BitReadWrite();
+
         loc_ret = TIMER1_ConfigPrescaler(InitPtr);
 
         loc_ret |= TIMER1_ConfigMode(InitPtr);
@@ -91,6 +95,8 @@ Std_ReturnType TIMER1_StartTimer(const TIMER1_InitTypeDef * const InitPtr, const
 
     if ((NULL_PTR != InitPtr) && (TIMER1_MODE_TIMER == InitPtr->Mode))
     {
+        TIMER1_FreeRunning = FALSE;
+
         loc_ret = TIMER1_ConfigTimerDelay(InitPtr, delay_ms);
 
 #if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE == STD_ON)
@@ -107,12 +113,36 @@ Std_ReturnType TIMER1_StartTimer(const TIMER1_InitTypeDef * const InitPtr, const
     return loc_ret;
 }
 
+Std_ReturnType TIMER1_StartFreeRunning(const TIMER1_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (TIMER1_MODE_TIMER == InitPtr->Mode))
+    {
+        TIMER1_FreeRunning = TRUE;
+
+#if (INTERRUPTS_TIMER1_INTERRUPTS_FEATURE == STD_ON)
+        INTI_TIMER1_ClearFlag();
+        INTI_TIMER1_EnableInterrupt();
+#endif
+        __TIMER1_Enable();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
 Std_ReturnType TIMER1_StartCounter(const TIMER1_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
 
     if ((NULL_PTR != InitPtr) && (TIMER1_MODE_COUNTER == InitPtr->Mode))
     {
+        TIMER1_FreeRunning = FALSE;
+
         GPIO_InitTypeDef TIMER1_Channelx = {
             .Pin = GPIO_PIN0,
             .Port = GPIO_PORTC
@@ -156,8 +186,9 @@ Std_ReturnType TIMER1_ReadCounterValue(const TIMER1_InitTypeDef * const InitPtr,
 
     if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr))
     {
+        // Reading TMR1L first latches TMR1H.
         *DataBufferPtr  = (uint8) __TIMER1_CounterRegisterLow();
-        *DataBufferPtr |= (uint8)(__TIMER1_CounterRegisterHigh() << 8);
+        *DataBufferPtr |= (uint16)((uint16)__TIMER1_CounterRegisterHigh() << 8);
     }
     else 
     {
@@ -291,7 +322,14 @@ void TIMER1_ISR(void)
 
     static uint16 interruptCounter;
 
-    if ((NULL_PTR != TIMER1_InterruptHandler) && (++interruptCounter == TIMER1_nRequiredInterrupts))
+    if (TRUE == TIMER1_FreeRunning)
+    {
+        if (NULL_PTR != TIMER1_InterruptHandler)
+        {
+            TIMER1_InterruptHandler();
+        }
+    }
+    else if ((NULL_PTR != TIMER1_InterruptHandler) && (++interruptCounter == TIMER1_nRequiredInterrupts))
     {
         TIMER1_SetPreload(TIMER1_ObjBuffer, TIMER1_DelayValue);
 
@@ -13,8 +13,8 @@
  * @note The TIMER1 interface is designed to be portable and can be used with different microcontroller families and
  *       development environments.
  * 
- * @version 0.1
- * @date 07.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _TIMER1_H_
@@ -107,6 +107,19 @@ Std_ReturnType TIMER1_DeInit(const TIMER1_InitTypeDef * const InitPtr);
  */
 Std_ReturnType TIMER1_StartTimer(const TIMER1_InitTypeDef * const InitPtr, const uint32 delay_ms);
 
+/**
+ * @brief Start TIMER1 free-running from its current count.
+ *
+ * The counter is neither preloaded nor reloaded, it wraps around every 65536 ticks and the interrupt handler, if
+ * any, is called on every overflow. Used as the base of time-stamping services.
+ *
+ * @param InitPtr Pointer to the TIMER1 initialization structure containing configuration parameters.
+ * @return Std_ReturnType Error status indicating the success of starting the timer.
+ *     - E_OK: The timer was started successfully.
+ *     - E_NOT_OK: An error occurred (e.g., NULL @param InitPtr or counter mode).
+ */
+Std_ReturnType TIMER1_StartFreeRunning(const TIMER1_InitTypeDef * const InitPtr);
+
 /**
  * @brief Start TIMER1 as a counter.
  *
@@ -1,8 +1,8 @@
 /**
  * @file TIMER2.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 08.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "../Timers_Private.h"
@@ -173,6 +173,73 @@ Std_ReturnType TIMER2_ReadCompareValue(const TIMER2_InitTypeDef * const InitPtr,
     return loc_ret;
 }
 
+Std_ReturnType TIMER2_SolvePWMPeriod(const uint32 Frequency, TIMER2_PWMPeriodTypeDef * const Period_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    TIMER2_PrescalerTypeDef loc_Prescaler = TIMER2_PRESCALER_LIMIT;
+    uint32 loc_Counts = 0;
+    uint32 loc_Divider = 0;
+    uint8 loc_index = 0;
+
+    // From the finest to the coarsest resolution.
+    static const TIMER2_PrescalerTypeDef loc_Prescalers[] = {
+        TIMER2_NO_PRESCALER, TIMER2_PRESCALER_4, TIMER2_PRESCALER_16
+    };
+
+    if ((NULL_PTR != Period_ret) && (0 != Frequency) && (Frequency <= (FOSC / 4UL)))
+    {
+        for (loc_index = 0; (TIMER2_PRESCALER_LIMIT == loc_Prescaler) && (loc_index < 3); loc_index++)
+        {
+            loc_Counts = TIMER2_PWM_PERIOD_COUNTS(Frequency, TIMER2_PRESCALE_FACTOR(loc_Prescalers[loc_index]));
+
+            if ((0 != loc_Counts) && (loc_Counts <= 256UL))
+            {
+                loc_Prescaler = loc_Prescalers[loc_index];
+            }
+        }
+
+        if (TIMER2_PRESCALER_LIMIT != loc_Prescaler)
+        {
+            loc_Divider = TIMER2_PRESCALE_FACTOR(loc_Prescaler) * loc_Counts;
+
+            Period_ret->Prescaler = loc_Prescaler;
+            Period_ret->Period = (uint8)(loc_Counts - 1);
+            Period_ret->Frequency = ((FOSC / 4UL) + (loc_Divider / 2UL)) / loc_Divider;
+            Period_ret->Error = (sint32)Period_ret->Frequency - (sint32)Frequency;
+            Period_ret->ResolutionBits = TIMER2_PWM_RESOLUTION_BITS(loc_Counts);
+        }
+        else
+        {
+            loc_ret = E_NOT_OK;
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType TIMER2_ConfigPWMPeriod(TIMER2_InitTypeDef * const InitPtr, const TIMER2_PWMPeriodTypeDef * const PeriodPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (NULL_PTR != PeriodPtr) && (PeriodPtr->Prescaler < TIMER2_PRESCALER_LIMIT))
+    {
+        InitPtr->Prescaler = PeriodPtr->Prescaler;
+
+        loc_ret = TIMER2_ConfigPrescaler(InitPtr);
+        loc_ret |= TIMER2_SetCompareValue(InitPtr, PeriodPtr->Period);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
 #if (INTERRUPTS_TIMER2_INTERRUPTS_FEATURE == STD_ON)
 static Std_ReturnType TIMER2_InitInterruptHandler(const TIMER2_InitTypeDef * const InitPtr)
 {
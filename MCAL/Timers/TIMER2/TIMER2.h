@@ -13,8 +13,8 @@
  * @note The TIMER2 interface is designed to be portable and can be used with different microcontroller families and
  *       development environments.
  * 
- * @version 0.1
- * @date 08.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _TIMER2_H_
@@ -22,6 +22,7 @@
 
 #include "../../../lib/Std_Types.h"
 #include "../../Interrupts/Interrupts.h"
+#include "../../mcu_config.h"
 
 typedef enum
 {
@@ -77,6 +78,65 @@ typedef struct
 #endif
 } TIMER2_InitTypeDef;
 
+/**
+ * @brief PWM period settings of TIMER2, computed by TIMER2_SolvePWMPeriod() or TIMER2_PWM_PERIOD_INIT().
+ */
+typedef struct
+{
+    TIMER2_PrescalerTypeDef     Prescaler;
+    uint8                       Period;             /* PR2 value */
+    uint32                      Frequency;          /* Achieved PWM frequency in Hz */
+    sint32                      Error;              /* Achieved minus requested frequency in Hz */
+    uint8                       ResolutionBits;     /* Duty cycle resolution in bits */
+
+} TIMER2_PWMPeriodTypeDef;
+
+/* Division factor of a TIMER2_PrescalerTypeDef value */
+#define TIMER2_PRESCALE_FACTOR(Prescaler)       ((TIMER2_NO_PRESCALER == (Prescaler)) ? 1UL : (2UL << (Prescaler)))
+
+/* Number of timer counts (PR2 + 1) in one period of PWMFrequency, rounded to the nearest count */
+#define TIMER2_PWM_PERIOD_COUNTS(PWMFrequency, Factor)                                                                      \
+    (((FOSC / 4UL) + (((uint32)(PWMFrequency) * (Factor)) / 2UL)) / ((uint32)(PWMFrequency) * (Factor)))
+
+/* Duty cycle resolution in bits of a period of Counts timer counts, log2(4 * Counts) */
+#define TIMER2_PWM_RESOLUTION_BITS(Counts)                                                                                  \
+    (((Counts) >= 256UL) ? 10U : ((Counts) >= 128UL) ? 9U : ((Counts) >= 64UL) ? 8U : ((Counts) >= 32UL) ? 7U :             \
+     ((Counts) >= 16UL) ? 6U : ((Counts) >= 8UL) ? 5U : ((Counts) >= 4UL) ? 4U : ((Counts) >= 2UL) ? 3U : 2U)
+
+/**
+ * @brief Smallest prescaler, so the largest PR2 and the finest duty cycle, that reaches a PWM frequency.
+ *
+ * Evaluates to TIMER2_PRESCALER_LIMIT when the frequency is out of range.
+ */
+#define TIMER2_PWM_PRESCALER(PWMFrequency)                                                                                  \
+    (((TIMER2_PWM_PERIOD_COUNTS(PWMFrequency, 1UL) - 1UL) <= 0xFFUL) ? TIMER2_NO_PRESCALER :                                \
+     ((TIMER2_PWM_PERIOD_COUNTS(PWMFrequency, 4UL) - 1UL) <= 0xFFUL) ? TIMER2_PRESCALER_4 :                                 \
+     ((TIMER2_PWM_PERIOD_COUNTS(PWMFrequency, 16UL) - 1UL) <= 0xFFUL) ? TIMER2_PRESCALER_16 : TIMER2_PRESCALER_LIMIT)
+
+#define TIMER2_PWM_COUNTS(PWMFrequency)                                                                                     \
+    TIMER2_PWM_PERIOD_COUNTS(PWMFrequency, TIMER2_PRESCALE_FACTOR(TIMER2_PWM_PRESCALER(PWMFrequency)))
+
+#define TIMER2_PWM_DIVIDER(PWMFrequency)                                                                                    \
+    (TIMER2_PRESCALE_FACTOR(TIMER2_PWM_PRESCALER(PWMFrequency)) * TIMER2_PWM_COUNTS(PWMFrequency))
+
+#define TIMER2_PWM_ACHIEVED_FREQUENCY(PWMFrequency)                                                                         \
+    (((FOSC / 4UL) + (TIMER2_PWM_DIVIDER(PWMFrequency) / 2UL)) / TIMER2_PWM_DIVIDER(PWMFrequency))
+
+/**
+ * @brief Compile-time initializer of a TIMER2_PWMPeriodTypeDef for a constant, non-zero PWM frequency in Hz.
+ *
+ * Gives the same settings as TIMER2_SolvePWMPeriod() without any runtime division, for example:
+ *     static const TIMER2_PWMPeriodTypeDef MotorPeriod = TIMER2_PWM_PERIOD_INIT(20000UL);
+ */
+#define TIMER2_PWM_PERIOD_INIT(PWMFrequency)                                                                                \
+{                                                                                                                           \
+    .Prescaler = TIMER2_PWM_PRESCALER(PWMFrequency),                                                                        \
+    .Period = (uint8)(TIMER2_PWM_COUNTS(PWMFrequency) - 1UL),                                                               \
+    .Frequency = TIMER2_PWM_ACHIEVED_FREQUENCY(PWMFrequency),                                                               \
+    .Error = (sint32)TIMER2_PWM_ACHIEVED_FREQUENCY(PWMFrequency) - (sint32)(PWMFrequency),                                  \
+    .ResolutionBits = TIMER2_PWM_RESOLUTION_BITS(TIMER2_PWM_COUNTS(PWMFrequency))                                           \
+}
+
 /**
  * @brief Initialize TIMER2 with the provided configuration.
  *
@@ -201,4 +261,34 @@ Std_ReturnType TIMER2_WriteCompareValue(const TIMER2_InitTypeDef * const InitPtr
  */
 Std_ReturnType TIMER2_ReadCompareValue(const TIMER2_InitTypeDef * const InitPtr, uint8 * const DataBufferPtr);
 
+/**
+ * @brief Compute the TIMER2 PWM period settings of a PWM frequency.
+ *
+ * The smallest prescaler whose PR2 still reaches the frequency is chosen, it gives the largest PR2 and so the finest
+ * duty cycle resolution. PR2 is rounded to the nearest period, the achieved frequency and its error are reported.
+ *
+ * @param Frequency The desired PWM frequency in Hertz (Hz).
+ * @param Period_ret Pointer to the settings to fill.
+ * @return Std_ReturnType Error status indicating the success of the computation.
+ *     - E_OK: The settings were computed successfully.
+ *     - E_NOT_OK: NULL @param Period_ret or @param Frequency out of the range of TIMER2
+ *       (FOSC / 16384 to FOSC / 4 Hz, about 488 Hz to 2 MHz at 8 MHz).
+ *
+ * @note Use TIMER2_PWM_PERIOD_INIT() instead when the frequency is a constant.
+ */
+Std_ReturnType TIMER2_SolvePWMPeriod(const uint32 Frequency, TIMER2_PWMPeriodTypeDef * const Period_ret);
+
+/**
+ * @brief Apply PWM period settings to TIMER2.
+ *
+ * The prescaler of @param InitPtr is updated to the one of the settings, then the prescaler and PR2 are written.
+ *
+ * @param InitPtr Pointer to the TIMER2 initialization structure to update.
+ * @param PeriodPtr Pointer to the settings computed by TIMER2_SolvePWMPeriod() or TIMER2_PWM_PERIOD_INIT().
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The settings were applied successfully.
+ *     - E_NOT_OK: NULL pointer or settings of an out of range frequency.
+ */
+Std_ReturnType TIMER2_ConfigPWMPeriod(TIMER2_InitTypeDef * const InitPtr, const TIMER2_PWMPeriodTypeDef * const PeriodPtr);
+
 #endif /* _TIMER2_H_ */
\ No newline at end of file
@@ -1,8 +1,8 @@
 /**
  * @file TIMER3.c
  * @author Ahmed Alaa (4hmedalaa@gmail.com)
- * @version 0.1
- * @date 08.09.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #include "../Timers_Private.h"
@@ -11,6 +11,7 @@
 static uint16 TIMER3_nRequiredInterrupts = 0;
 static uint16 TIMER3_DelayValue = 0;
 static const TIMER3_InitTypeDef * TIMER3_ObjBuffer = NULL_PTR;
+static boolean TIMER3_FreeRunning = FALSE;
 
 #if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE == STD_ON)
 static void (*TIMER3_InterruptHandler)(void) = NULL_PTR;
@@ -39,6 +40,9 @@ Std_ReturnType TIMER3_Init(const TIMER3_InitTypeDef * const InitPtr)
 
         TIMER3_ObjBuffer = InitPtr;
 
+        // TMR3H is latched when TMR3L is read and written with TMR3L, the 16-bit value is never torn.
+        __TIMER3_Enable16BitReadWrite();
+
         loc_ret = TIMER3_ConfigPrescaler(InitPtr);
 
         loc_ret |= TIMER3_ConfigMode(InitPtr);
@@ -91,6 +95,8 @@ Std_ReturnType TIMER3_StartTimer(const TIMER3_InitTypeDef * const InitPtr, const
 
     if ((NULL_PTR != InitPtr) && (TIMER3_MODE_TIMER == InitPtr->Mode))
     {
+        TIMER3_FreeRunning = FALSE;
+
         loc_ret = TIMER3_ConfigTimerDelay(InitPtr, delay_ms);
 
 #if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE == STD_ON)
@@ -107,12 +113,36 @@ Std_ReturnType TIMER3_StartTimer(const TIMER3_InitTypeDef * const InitPtr, const
     return loc_ret;
 }
 
+Std_ReturnType TIMER3_StartFreeRunning(const TIMER3_InitTypeDef * const InitPtr)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if ((NULL_PTR != InitPtr) && (TIMER3_MODE_TIMER == InitPtr->Mode))
+    {
+        TIMER3_FreeRunning = TRUE;
+
+#if (INTERRUPTS_TIMER3_INTERRUPTS_FEATURE == STD_ON)
+        INTI_TIMER3_ClearFlag();
+        INTI_TIMER3_EnableInterrupt();
+#endif
+        __TIMER3_Enable();
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
 Std_ReturnType TIMER3_StartCounter(const TIMER3_InitTypeDef * const InitPtr)
 {
     Std_ReturnType loc_ret = E_OK;
 
     if ((NULL_PTR != InitPtr) && (TIMER3_MODE_COUNTER == InitPtr->Mode))
     {
+        TIMER3_FreeRunning = FALSE;
+
         GPIO_InitTypeDef TIMER3_Channelx = {
             .Pin = GPIO_PIN0,
             .Port = GPIO_PORTC
@@ -156,8 +186,9 @@ Std_ReturnType TIMER3_ReadCounterValue(const TIMER3_InitTypeDef * const InitPtr,
 
     if ((NULL_PTR != InitPtr) && (NULL_PTR != DataBufferPtr))
     {
+        // Reading TMR3L first latches TMR3H.
         *DataBufferPtr  = (uint8) __TIMER3_CounterRegisterLow();
-        *DataBufferPtr |= (uint8)(__TIMER3_CounterRegisterHigh() << 8);
+        *DataBufferPtr |= (uint16)((uint16)__TIMER3_CounterRegisterHigh() << 8);
     }
     else 
     {
@@ -291,7 +322,14 @@ void TIMER3_ISR(void)
 
     static uint16 interruptCounter;
 
-    if ((NULL_PTR != TIMER3_InterruptHandler) && (++interruptCounter == TIMER3_nRequiredInterrupts))
+    if (TRUE == TIMER3_FreeRunning)
+    {
+        if (NULL_PTR != TIMER3_InterruptHandler)
+        {
+            TIMER3_InterruptHandler();
+        }
+    }
+    else if ((NULL_PTR != TIMER3_InterruptHandler) && (++interruptCounter == TIMER3_nRequiredInterrupts))
     {
         TIMER3_SetPreload(TIMER3_ObjBuffer, TIMER3_DelayValue);
 
@@ -15,8 +15,8 @@
  * @note The `Timers_Private.h` interface improves code organization and maintainability by isolating internal
  *       timer-related operations from the main public interface.
  * 
- * @version 0.1
- * @date 22.08.23
+ * @version 0.2
+ * @date 18.10.26
  */
 
 #ifndef _TIMERS_PRIVATE_H_
@@ -40,6 +40,7 @@
 #define __TIMER1_Disable()                          (T1CONbits.TMR1ON = 0)       
 #define __TIMER1_ConfigMode(x)                      (T1CONbits.TMR1CS = x)
 #define __TIMER1_ConfigPrescaler(x)                 (T1CONbits.T1CKPS = x)     
+#define __TIMER1_Enable16BitReadWrite()             (T1CONbits.RD16 = 1)
 #define __TIMER1_CounterRegisterLow()               (TMR1L)
 #define __TIMER1_CounterRegisterHigh()              (TMR1H)
 
@@ -54,6 +55,7 @@
 #define __TIMER3_Disable()                          (T3CONbits.TMR3ON = 0)       
 #define __TIMER3_ConfigMode(x)                      (T3CONbits.TMR3CS = x)
 #define __TIMER3_ConfigPrescaler(x)                 (T3CONbits.T3CKPS = x)     
+#define __TIMER3_Enable16BitReadWrite()             (T3CONbits.RD16 = 1)
 #define __TIMER3_CounterRegisterLow()               (TMR3L)
 #define __TIMER3_CounterRegisterHigh()              (TMR3H)
 
@@ -2,7 +2,24 @@
 #define _MCU_REGISTERS_H_
 
 #include "../lib/compiler.h"
+#if defined(__XC8)
 #include <../proc/pic18f4620.h>
 #include <../pic18.h>
+#else
+#include "../SIM/SIM_Registers.h"
+#endif
+
+/*
+ * Registers reached through constant pointer tables (the GPIO ports): MCU_SFR_ADDRESS() takes the address of a
+ * register for the table and MCU_SFR() accesses the register a table entry points to, on the host through
+ * SIM_Access() so the simulator sees the access.
+ */
+#if defined(__XC8)
+#define MCU_SFR_ADDRESS(name)               (&(name))
+#define MCU_SFR(pointer)                    (*(pointer))
+#else
+#define MCU_SFR_ADDRESS(name)               SIM_ADDRESS(SIM_##name##_ADDRESS)
+#define MCU_SFR(pointer)                    SIM_POINTED(pointer)
+#endif
 
 #endif /* _MCU_REGISTERS_H_ */
\ No newline at end of file
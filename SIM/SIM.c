@@ -0,0 +1,1764 @@
+/**
+ * @file SIM.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include <string.h>
+
+#include "SIM_Registers.h"
+
+#define SIM_NO_ACCESS                       0x0000
+#define SIM_INDEX(address)                  ((address) - SIM_SFR_BASE_ADDRESS)
+#define SIM_READ(address)                   (SIM_RegisterFile[SIM_INDEX(address)])
+#define SIM_IS_SET(address, mask)           (0 != (SIM_READ(address) & (mask)))
+
+/* Upper byte kept in the buffer cell until the firmware writes it */
+#define SIM_BUFFER_UNTOUCHED                0x0100
+
+#define SIM_INTCON_RBIF                     0x01
+#define SIM_INTCON_INT0IF                   0x02
+#define SIM_INTCON_TMR0IF                   0x04
+#define SIM_INTCON_PEIE                     0x40
+#define SIM_INTCON_GIE                      0x80
+#define SIM_INTCON_GIEL                     SIM_INTCON_PEIE
+#define SIM_INTCON_GIEH                     SIM_INTCON_GIE
+#define SIM_INTCON2_RBIP                    0x01
+#define SIM_INTCON2_TMR0IP                  0x04
+#define SIM_INTCON2_INTEDG2                 0x10
+#define SIM_INTCON2_INTEDG1                 0x20
+#define SIM_INTCON2_INTEDG0                 0x40
+#define SIM_INTCON3_INT1IF                  0x01
+#define SIM_INTCON3_INT2IF                  0x02
+#define SIM_INTCON3_INT1IP                  0x40
+#define SIM_INTCON3_INT2IP                  0x80
+#define SIM_RCON_IPEN                       0x80
+
+#define SIM_PIR1_TMR1IF                     0x01
+#define SIM_PIR1_TMR2IF                     0x02
+#define SIM_PIR1_CCP1IF                     0x04
+#define SIM_PIR1_SSPIF                      0x08
+#define SIM_PIR1_TXIF                       0x10
+#define SIM_PIR1_RCIF                       0x20
+#define SIM_PIR1_ADIF                       0x40
+#define SIM_PIR2_CCP2IF                     0x01
+#define SIM_PIR2_TMR3IF                     0x02
+#define SIM_PIR2_EEIF                       0x10
+#define SIM_PIR2_BCLIF                      0x08
+
+#define SIM_EECON1_RD                       0x01
+#define SIM_EECON1_WR                       0x02
+#define SIM_EECON1_WREN                     0x04
+#define SIM_EECON1_CFGS                     0x40
+#define SIM_EECON1_EEPGD                    0x80
+
+#define SIM_TXSTA_TX9D                      0x01
+#define SIM_TXSTA_TRMT                      0x02
+#define SIM_TXSTA_BRGH                      0x04
+#define SIM_TXSTA_TXEN                      0x20
+#define SIM_TXSTA_TX9                       0x40
+#define SIM_RCSTA_RX9D                      0x01
+#define SIM_RCSTA_OERR                      0x02
+#define SIM_RCSTA_CREN                      0x10
+#define SIM_RCSTA_SPEN                      0x80
+#define SIM_BAUDCON_BRG16                   0x08
+
+#define SIM_T0CON_T08BIT                    0x40
+#define SIM_T0CON_T0CS                      0x20
+#define SIM_T0CON_PSA                       0x08
+#define SIM_T0CON_TMR0ON                    0x80
+#define SIM_TxCON_TMRxON                    0x01
+#define SIM_TxCON_TMRxCS                    0x02
+#define SIM_TxCON_RD16                      0x80
+#define SIM_T2CON_TMR2ON                    0x04
+#define SIM_T3CON_T3CCP1                    0x08
+#define SIM_T3CON_T3CCP2                    0x40
+
+#define SIM_CCPxCON_CCPxM                   0x0F
+#define SIM_CCPxM_COMPARE_TOGGLE            0x02
+#define SIM_CCPxM_CAPTURE_FALLING           0x04
+#define SIM_CCPxM_CAPTURE_RISING            0x05
+#define SIM_CCPxM_CAPTURE_4TH_RISING        0x06
+#define SIM_CCPxM_CAPTURE_16TH_RISING       0x07
+#define SIM_CCPxM_COMPARE                   0x08
+#define SIM_CCPxM_SPECIAL_EVENT             0x0B
+
+#define SIM_ADCON0_ADON                     0x01
+#define SIM_ADCON0_GO                       0x02
+#define SIM_ADCON2_ADFM                     0x80
+
+#define SIM_SSPSTAT_BF                      0x01
+#define SIM_SSPCON1_SSPOV                   0x40
+#define SIM_SSPCON1_SSPEN                   0x20
+#define SIM_SSPCON1_WCOL                    0x80
+#define SIM_SSPCON1_SSPM                    0x0F
+#define SIM_SSPM_SPI_MASTER_TMR2            0x03
+#define SIM_SSPM_SPI_SLAVE_SS               0x04
+#define SIM_SSPM_SPI_SLAVE                  0x05
+#define SIM_SSPM_I2C_MASTER                 0x08
+#define SIM_SSPCON2_SEN                     0x01
+#define SIM_SSPCON2_RSEN                    0x02
+#define SIM_SSPCON2_PEN                     0x04
+#define SIM_SSPCON2_RCEN                    0x08
+#define SIM_SSPCON2_ACKEN                   0x10
+#define SIM_SSPCON2_ACKSTAT                 0x40
+#define SIM_SSPCON2_EVENTS                  0x1F
+#define SIM_I2C_WRITE_EVENT                 0x80
+#define SIM_PORTA_SS                        0x20
+
+typedef struct
+{
+    uint16 ControlAddress;
+    uint16 LowAddress;
+    uint16 HighAddress;
+    uint16 FlagAddress;
+    uint8 FlagMask;
+    uint16 Counter;
+    uint32 PrescalerCycles;
+    uint8 HighBuffer;
+    uint8 LatchedHigh;
+    boolean HighBufferWritten;
+
+} SIM_TimerTypeDef;
+
+typedef enum
+{
+    SIM_TIMER0,
+    SIM_TIMER1,
+    SIM_TIMER3,
+    SIM_TIMER_LIMIT
+
+} SIM_TimerIndexTypeDef;
+
+typedef struct
+{
+    uint16 ControlAddress;
+    uint16 LowAddress;
+    uint16 HighAddress;
+    uint16 FlagAddress;
+    uint8 FlagMask;
+    uint8 PinMask;                      /* PORTC pin, RC2 for CCP1 and RC1 (CCP2MX set) for CCP2 */
+
+} SIM_CcpTypeDef;
+
+typedef enum
+{
+    SIM_CCP1,
+    SIM_CCP2,
+    SIM_CCP_LIMIT
+
+} SIM_CcpIndexTypeDef;
+
+typedef struct
+{
+    uint16 Address;
+    uint8 FlagMask;
+    uint16 EnableAddress;
+    uint8 EnableMask;
+    uint16 PriorityAddress;
+    uint8 PriorityMask;
+    boolean Peripheral;
+
+} SIM_InterruptSourceTypeDef;
+
+volatile uint8 SIM_RegisterFile[SIM_SFR_COUNT];
+
+static uint8 SIM_ShadowFile[SIM_SFR_COUNT];
+static uint32 SIM_RegisterAccesses[SIM_SFR_COUNT];
+static SIM_WriteHookTypeDef SIM_WriteHooks[SIM_SFR_COUNT];
+static volatile uint16 SIM_BufferCell;
+
+static boolean SIM_Initialized = FALSE;
+static uint16 SIM_LastAccess = SIM_NO_ACCESS;
+static uint32 SIM_Cycles;
+static uint32 SIM_Accesses;
+
+static SIM_VectorTypeDef SIM_HighVector;
+static SIM_VectorTypeDef SIM_LowVector;
+
+static uint8 SIM_PortInputs[NUMBER_OF_PORTS];
+
+static SIM_TimerTypeDef SIM_Timers[SIM_TIMER_LIMIT];
+static uint32 SIM_Timer2PrescalerCycles;
+static uint8 SIM_Timer2Postscaler;
+
+static uint8 SIM_CcpPrescalers[SIM_CCP_LIMIT];     /* Rising edges counted towards the next 4th/16th edge capture */
+
+static SIM_SpiDeviceTypeDef SIM_SpiDevice;
+static boolean SIM_SpiBusy;
+static uint8 SIM_SpiTxByte;             /* Shift register, loaded by SSPBUF writes */
+static uint32 SIM_SpiRemainingCycles;
+
+static SIM_I2cDeviceTypeDef SIM_I2cDevice;
+static uint8 SIM_I2cEvent;              /* SSPCON2 bit of the event in progress, SIM_I2C_WRITE_EVENT for a byte */
+static uint8 SIM_I2cTxByte;
+static uint32 SIM_I2cRemainingCycles;
+
+static SIM_EusartDeviceTypeDef SIM_EusartDevice;
+static boolean SIM_EusartShiftBusy;
+static uint16 SIM_EusartShiftFrame;
+static uint32 SIM_EusartRemainingCycles;
+static boolean SIM_EusartTxRegFull;
+static uint16 SIM_EusartTxRegFrame;
+static uint16 SIM_EusartRxFifo[SIM_EUSART_RX_FIFO_SIZE];
+static uint8 SIM_EusartRxCount;
+
+static uint16 SIM_AdcInputs[SIM_ADC_CHANNELS];
+static boolean SIM_AdcBusy;
+static uint8 SIM_AdcChannel;
+static uint32 SIM_AdcRemainingCycles;
+
+static uint8 SIM_Eeprom[SIM_EEPROM_SIZE];
+static uint8 SIM_EepromUnlockStep;
+static boolean SIM_EepromBusy;
+static uint16 SIM_EepromAddress;
+static uint8 SIM_EepromData;
+static uint32 SIM_EepromRemainingCycles;
+static uint32 SIM_EepromWrites;
+
+static const SIM_CcpTypeDef SIM_Ccps[SIM_CCP_LIMIT] =
+{
+    {SIM_CCP1CON_ADDRESS, SIM_CCPR1L_ADDRESS, SIM_CCPR1H_ADDRESS, SIM_PIR1_ADDRESS, SIM_PIR1_CCP1IF, 0x04},
+    {SIM_CCP2CON_ADDRESS, SIM_CCPR2L_ADDRESS, SIM_CCPR2H_ADDRESS, SIM_PIR2_ADDRESS, SIM_PIR2_CCP2IF, 0x02},
+};
+
+static const SIM_InterruptSourceTypeDef SIM_InterruptSources[] =
+{
+    {SIM_INTCON_ADDRESS,  SIM_INTCON_INT0IF,  SIM_INTCON_ADDRESS,  0x10, SIM_NO_ACCESS,       0x00,                 FALSE},
+    {SIM_INTCON_ADDRESS,  SIM_INTCON_TMR0IF,  SIM_INTCON_ADDRESS,  0x20, SIM_INTCON2_ADDRESS, SIM_INTCON2_TMR0IP,   FALSE},
+    {SIM_INTCON_ADDRESS,  SIM_INTCON_RBIF,    SIM_INTCON_ADDRESS,  0x08, SIM_INTCON2_ADDRESS, SIM_INTCON2_RBIP,     FALSE},
+    {SIM_INTCON3_ADDRESS, SIM_INTCON3_INT1IF, SIM_INTCON3_ADDRESS, 0x08, SIM_INTCON3_ADDRESS, SIM_INTCON3_INT1IP,   FALSE},
+    {SIM_INTCON3_ADDRESS, SIM_INTCON3_INT2IF, SIM_INTCON3_ADDRESS, 0x10, SIM_INTCON3_ADDRESS, SIM_INTCON3_INT2IP,   FALSE},
+    {SIM_PIR1_ADDRESS,    0xFF,               SIM_PIE1_ADDRESS,    0xFF, SIM_IPR1_ADDRESS,    0xFF,                 TRUE },
+    {SIM_PIR2_ADDRESS,    0xFF,               SIM_PIE2_ADDRESS,    0xFF, SIM_IPR2_ADDRESS,    0xFF,                 TRUE },
+};
+
+static void SIM_Step(const uint32 Cycles);
+static void SIM_ProcessFirmwareAccess(void);
+static void SIM_ProcessLastAccess(void);
+static void SIM_ProcessWrites(void);
+static void SIM_OnWrite(const uint16 Address, const uint8 OldValue, const uint8 NewValue);
+static void SIM_Advance(const uint32 Cycles);
+static void SIM_RefreshPorts(void);
+static void SIM_DispatchInterrupts(void);
+static void SIM_Publish(const uint16 Address, const uint8 Value);
+static void SIM_SetBits(const uint16 Address, const uint8 Mask);
+static void SIM_ClearBits(const uint16 Address, const uint8 Mask);
+
+static boolean SIM_TimerIsBuffered(const SIM_TimerTypeDef * const Timer);
+static void SIM_TimerAccessLow(SIM_TimerTypeDef * const Timer);
+static void SIM_TimerWriteHigh(SIM_TimerTypeDef * const Timer, const uint8 Value);
+static void SIM_TimerAdvance(SIM_TimerTypeDef * const Timer, const uint32 Cycles);
+static void SIM_Timer2Advance(const uint32 Cycles);
+
+static const SIM_TimerTypeDef * SIM_CcpTimer(const SIM_CcpIndexTypeDef Ccp);
+static boolean SIM_CcpCompareAdvance(SIM_TimerTypeDef * const Timer, const uint32 Ticks);
+static void SIM_CcpCaptureEdge(const SIM_CcpIndexTypeDef Ccp, const boolean Rising);
+
+static void SIM_SpiWrite(const uint8 Value);
+static void SIM_SpiAdvance(const uint32 Cycles);
+
+static boolean SIM_I2cIsMaster(void);
+static void SIM_I2cStartEvent(const uint8 Event, const uint32 Bits);
+static void SIM_I2cAdvance(const uint32 Cycles);
+
+static uint32 SIM_EusartFrameCycles(void);
+static void SIM_EusartWrite(const uint8 Value);
+static void SIM_EusartRead(void);
+static void SIM_EusartLoadShiftRegister(void);
+static void SIM_EusartAdvance(const uint32 Cycles);
+static void SIM_EusartPublishRx(void);
+
+static void SIM_AdcStart(void);
+static void SIM_AdcAdvance(const uint32 Cycles);
+
+static uint16 SIM_EepromCurrentAddress(void);
+static void SIM_EepromStartWrite(void);
+static void SIM_EepromAdvance(const uint32 Cycles);
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          Register access                                                           */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+volatile uint8 * SIM_Access(const uint16 Address)
+{
+    if (FALSE == SIM_Initialized)
+    {
+        SIM_Reset();
+    }
+
+    SIM_Step(SIM_CYCLES_PER_ACCESS);
+
+    SIM_Accesses++;
+    SIM_RegisterAccesses[SIM_INDEX(Address)]++;
+    SIM_LastAccess = Address;
+
+    return &SIM_RegisterFile[SIM_INDEX(Address)];
+}
+
+volatile uint16 * SIM_AccessBuffer(const uint16 Address)
+{
+    (void)SIM_Access(Address);
+
+    SIM_BufferCell = SIM_BUFFER_UNTOUCHED | SIM_READ(Address);
+
+    return &SIM_BufferCell;
+}
+
+void SIM_Reset(void)
+{
+    SIM_Initialized = TRUE;
+
+    memset((void *)SIM_RegisterFile, 0, sizeof(SIM_RegisterFile));
+
+    SIM_RegisterFile[SIM_INDEX(SIM_TRISA_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_TRISB_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_TRISC_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_TRISD_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_TRISE_ADDRESS)] = 0x07;
+    SIM_RegisterFile[SIM_INDEX(SIM_IPR1_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_IPR2_ADDRESS)] = 0xDF;
+    SIM_RegisterFile[SIM_INDEX(SIM_TXSTA_ADDRESS)] = SIM_TXSTA_TRMT;
+    SIM_RegisterFile[SIM_INDEX(SIM_BAUDCON_ADDRESS)] = 0x40;
+    SIM_RegisterFile[SIM_INDEX(SIM_T0CON_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_PR2_ADDRESS)] = 0xFF;
+    SIM_RegisterFile[SIM_INDEX(SIM_RCON_ADDRESS)] = 0x1C;
+    SIM_RegisterFile[SIM_INDEX(SIM_INTCON2_ADDRESS)] = 0xF5;
+    SIM_RegisterFile[SIM_INDEX(SIM_INTCON3_ADDRESS)] = 0xC0;
+
+    memcpy(SIM_ShadowFile, (const void *)SIM_RegisterFile, sizeof(SIM_ShadowFile));
+    memset(SIM_RegisterAccesses, 0, sizeof(SIM_RegisterAccesses));
+    memset(SIM_WriteHooks, 0, sizeof(SIM_WriteHooks));
+    memset(SIM_PortInputs, 0, sizeof(SIM_PortInputs));
+    memset(SIM_Timers, 0, sizeof(SIM_Timers));
+    memset(SIM_AdcInputs, 0, sizeof(SIM_AdcInputs));
+    memset(SIM_Eeprom, 0xFF, sizeof(SIM_Eeprom));
+
+    SIM_Timers[SIM_TIMER0].ControlAddress = SIM_T0CON_ADDRESS;
+    SIM_Timers[SIM_TIMER0].LowAddress = SIM_TMR0L_ADDRESS;
+    SIM_Timers[SIM_TIMER0].HighAddress = SIM_TMR0H_ADDRESS;
+    SIM_Timers[SIM_TIMER0].FlagAddress = SIM_INTCON_ADDRESS;
+    SIM_Timers[SIM_TIMER0].FlagMask = SIM_INTCON_TMR0IF;
+
+    SIM_Timers[SIM_TIMER1].ControlAddress = SIM_T1CON_ADDRESS;
+    SIM_Timers[SIM_TIMER1].LowAddress = SIM_TMR1L_ADDRESS;
+    SIM_Timers[SIM_TIMER1].HighAddress = SIM_TMR1H_ADDRESS;
+    SIM_Timers[SIM_TIMER1].FlagAddress = SIM_PIR1_ADDRESS;
+    SIM_Timers[SIM_TIMER1].FlagMask = SIM_PIR1_TMR1IF;
+
+    SIM_Timers[SIM_TIMER3].ControlAddress = SIM_T3CON_ADDRESS;
+    SIM_Timers[SIM_TIMER3].LowAddress = SIM_TMR3L_ADDRESS;
+    SIM_Timers[SIM_TIMER3].HighAddress = SIM_TMR3H_ADDRESS;
+    SIM_Timers[SIM_TIMER3].FlagAddress = SIM_PIR2_ADDRESS;
+    SIM_Timers[SIM_TIMER3].FlagMask = SIM_PIR2_TMR3IF;
+
+    SIM_BufferCell = 0;
+    SIM_LastAccess = SIM_NO_ACCESS;
+    SIM_Cycles = 0;
+    SIM_Accesses = 0;
+    SIM_HighVector = NULL_PTR;
+    SIM_LowVector = NULL_PTR;
+
+    SIM_Timer2PrescalerCycles = 0;
+    SIM_Timer2Postscaler = 0;
+
+    memset(SIM_CcpPrescalers, 0, sizeof(SIM_CcpPrescalers));
+
+    SIM_SpiDevice = NULL_PTR;
+    SIM_SpiBusy = FALSE;
+    SIM_SpiTxByte = 0;
+    SIM_SpiRemainingCycles = 0;
+
+    SIM_I2cDevice = NULL_PTR;
+    SIM_I2cEvent = 0;
+    SIM_I2cTxByte = 0;
+    SIM_I2cRemainingCycles = 0;
+
+    SIM_EusartDevice = NULL_PTR;
+    SIM_EusartShiftBusy = FALSE;
+    SIM_EusartShiftFrame = 0;
+    SIM_EusartRemainingCycles = 0;
+    SIM_EusartTxRegFull = FALSE;
+    SIM_EusartTxRegFrame = 0;
+    SIM_EusartRxCount = 0;
+
+    SIM_AdcBusy = FALSE;
+    SIM_AdcChannel = 0;
+    SIM_AdcRemainingCycles = 0;
+
+    SIM_EepromUnlockStep = 0;
+    SIM_EepromBusy = FALSE;
+    SIM_EepromAddress = 0;
+    SIM_EepromData = 0;
+    SIM_EepromRemainingCycles = 0;
+    SIM_EepromWrites = 0;
+
+    SIM_RefreshPorts();
+}
+
+void SIM_Sync(void)
+{
+    if (FALSE == SIM_Initialized)
+    {
+        SIM_Reset();
+    }
+
+    SIM_Step(0);
+}
+
+void SIM_DelayCycles(const uint32 Cycles)
+{
+    uint32 loc_remaining = Cycles;
+    uint32 loc_step = 0;
+
+    if (FALSE == SIM_Initialized)
+    {
+        SIM_Reset();
+    }
+
+    do
+    {
+        loc_step = (loc_remaining > SIM_DELAY_STEP_CYCLES) ? SIM_DELAY_STEP_CYCLES : loc_remaining;
+        SIM_Step(loc_step);
+        loc_remaining -= loc_step;
+
+    } while (loc_remaining > 0);
+}
+
+uint32 SIM_GetCycleCount(void)
+{
+    return SIM_Cycles;
+}
+
+uint32 SIM_GetAccessCount(void)
+{
+    return SIM_Accesses;
+}
+
+uint32 SIM_GetRegisterAccessCount(const uint16 Address)
+{
+    uint32 loc_count = 0;
+
+    if ((Address >= SIM_SFR_BASE_ADDRESS) && (Address < (SIM_SFR_BASE_ADDRESS + SIM_SFR_COUNT)))
+    {
+        loc_count = SIM_RegisterAccesses[SIM_INDEX(Address)];
+    }
+
+    return loc_count;
+}
+
+void SIM_SetInterruptVectors(const SIM_VectorTypeDef HighVector, const SIM_VectorTypeDef LowVector)
+{
+    SIM_Sync();
+
+    SIM_HighVector = HighVector;
+    SIM_LowVector = LowVector;
+}
+
+Std_ReturnType SIM_SetWriteHook(const uint16 Address, const SIM_WriteHookTypeDef Hook)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    SIM_Sync();
+
+    if ((Address >= SIM_SFR_BASE_ADDRESS) && (Address < (SIM_SFR_BASE_ADDRESS + SIM_SFR_COUNT)))
+    {
+        SIM_WriteHooks[SIM_INDEX(Address)] = Hook;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SIM_SetPortInput(const uint8 Port, const uint8 Value)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    SIM_Sync();
+
+    if (Port < NUMBER_OF_PORTS)
+    {
+        SIM_PortInputs[Port] = Value;
+        SIM_Step(0);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SIM_SetAdcInput(const uint8 Channel, const uint16 Value)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    if (Channel < SIM_ADC_CHANNELS)
+    {
+        SIM_AdcInputs[Channel] = Value & 0x3FF;
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+void SIM_SetSpiDevice(const SIM_SpiDeviceTypeDef Device)
+{
+    SIM_SpiDevice = Device;
+}
+
+void SIM_SetI2cDevice(const SIM_I2cDeviceTypeDef Device)
+{
+    SIM_I2cDevice = Device;
+}
+
+Std_ReturnType SIM_I2cBusCollision(void)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    SIM_Sync();
+
+    if (0 != SIM_I2cEvent)
+    {
+        SIM_I2cEvent = 0;
+        SIM_I2cRemainingCycles = 0;
+
+        SIM_ClearBits(SIM_SSPCON2_ADDRESS, SIM_SSPCON2_EVENTS);
+        SIM_SetBits(SIM_PIR2_ADDRESS, SIM_PIR2_BCLIF);
+        SIM_Step(0);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+void SIM_SetEusartDevice(const SIM_EusartDeviceTypeDef Device)
+{
+    SIM_EusartDevice = Device;
+}
+
+Std_ReturnType SIM_SpiSlaveExchange(const uint8 Mosi, uint8 * const Miso_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_control = 0;
+
+    SIM_Sync();
+
+    loc_control = SIM_READ(SIM_SSPCON1_ADDRESS);
+
+    if ((0 == (loc_control & SIM_SSPCON1_SSPEN)) ||
+        (((loc_control & SIM_SSPCON1_SSPM) != SIM_SSPM_SPI_SLAVE_SS) &&
+         ((loc_control & SIM_SSPCON1_SSPM) != SIM_SSPM_SPI_SLAVE)) ||
+        (((loc_control & SIM_SSPCON1_SSPM) == SIM_SSPM_SPI_SLAVE_SS) && (0 != (SIM_PortInputs[0] & SIM_PORTA_SS))))
+    {
+        loc_ret = E_NOT_OK;
+    }
+    else
+    {
+        if (NULL_PTR != Miso_ret)
+        {
+            *Miso_ret = SIM_SpiTxByte;
+        }
+
+        /* Unless SSPBUF is written again, the received byte is shifted back out with the next one */
+        SIM_SpiTxByte = Mosi;
+
+        if (SIM_IS_SET(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF))
+        {
+            SIM_SetBits(SIM_SSPCON1_ADDRESS, SIM_SSPCON1_SSPOV);
+        }
+        else
+        {
+            SIM_Publish(SIM_SSPBUF_ADDRESS, Mosi);
+            SIM_SetBits(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF);
+        }
+
+        SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_SSPIF);
+        SIM_Step(0);
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType SIM_EusartReceive(const uint16 Frame)
+{
+    Std_ReturnType loc_ret = E_OK;
+
+    SIM_Sync();
+
+    if ((!SIM_IS_SET(SIM_RCSTA_ADDRESS, SIM_RCSTA_SPEN)) || (!SIM_IS_SET(SIM_RCSTA_ADDRESS, SIM_RCSTA_CREN)) ||
+        (SIM_IS_SET(SIM_RCSTA_ADDRESS, SIM_RCSTA_OERR)))
+    {
+        loc_ret = E_NOT_OK;
+    }
+    else if (SIM_EusartRxCount >= SIM_EUSART_RX_FIFO_SIZE)
+    {
+        SIM_SetBits(SIM_RCSTA_ADDRESS, SIM_RCSTA_OERR);
+        loc_ret = E_NOT_OK;
+    }
+    else
+    {
+        SIM_EusartRxFifo[SIM_EusartRxCount++] = Frame & 0x1FF;
+        SIM_EusartPublishRx();
+        SIM_Step(0);
+    }
+
+    return loc_ret;
+}
+
+uint8 SIM_EepromRead(const uint16 Address)
+{
+    return SIM_Eeprom[Address % SIM_EEPROM_SIZE];
+}
+
+void SIM_EepromWrite(const uint16 Address, const uint8 Value)
+{
+    SIM_Eeprom[Address % SIM_EEPROM_SIZE] = Value;
+}
+
+uint32 SIM_GetEepromWriteCount(void)
+{
+    return SIM_EepromWrites;
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          Simulation core                                                           */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static void SIM_Step(const uint32 Cycles)
+{
+    SIM_ProcessFirmwareAccess();
+    SIM_Advance(Cycles);
+    SIM_RefreshPorts();
+    SIM_DispatchInterrupts();
+}
+
+static void SIM_ProcessFirmwareAccess(void)
+{
+    SIM_ProcessLastAccess();
+    SIM_ProcessWrites();
+}
+
+static void SIM_ProcessLastAccess(void)
+{
+    const uint16 loc_address = SIM_LastAccess;
+    uint8 loc_value = 0;
+
+    SIM_LastAccess = SIM_NO_ACCESS;
+
+    if (SIM_NO_ACCESS != loc_address)
+    {
+        loc_value = SIM_READ(loc_address);
+
+        if ((SIM_EECON1_ADDRESS != loc_address) && (SIM_EECON2_ADDRESS != loc_address))
+        {
+            SIM_EepromUnlockStep = 0;
+        }
+
+        switch (loc_address)
+        {
+            case SIM_TXREG_ADDRESS:
+                SIM_ShadowFile[SIM_INDEX(loc_address)] = loc_value;
+                SIM_EusartWrite(loc_value);
+                break;
+
+            case SIM_RCREG_ADDRESS:
+                SIM_EusartRead();
+                break;
+
+            case SIM_EECON2_ADDRESS:
+                SIM_ShadowFile[SIM_INDEX(loc_address)] = loc_value;
+
+                if (0x55 == loc_value)
+                {
+                    SIM_EepromUnlockStep = 1;
+                }
+                else if ((0xAA == loc_value) && (1 == SIM_EepromUnlockStep))
+                {
+                    SIM_EepromUnlockStep = 2;
+                }
+                else
+                {
+                    SIM_EepromUnlockStep = 0;
+                }
+
+                if (NULL_PTR != SIM_WriteHooks[SIM_INDEX(loc_address)])
+                {
+                    SIM_WriteHooks[SIM_INDEX(loc_address)](loc_address, loc_value);
+                }
+
+                /* EECON2 is not a physical register, it always reads back as zero */
+                SIM_Publish(loc_address, 0x00);
+                break;
+
+            case SIM_SSPBUF_ADDRESS:
+                if (0 == (SIM_BufferCell & 0xFF00))
+                {
+                    SIM_SpiWrite((uint8)SIM_BufferCell);
+
+                    if (NULL_PTR != SIM_WriteHooks[SIM_INDEX(loc_address)])
+                    {
+                        SIM_WriteHooks[SIM_INDEX(loc_address)](loc_address, (uint8)SIM_BufferCell);
+                    }
+                }
+                else
+                {
+                    SIM_ClearBits(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF);
+                }
+
+                SIM_BufferCell = SIM_BUFFER_UNTOUCHED | SIM_READ(loc_address);
+                break;
+
+            case SIM_TMR0L_ADDRESS:
+                SIM_TimerAccessLow(&SIM_Timers[SIM_TIMER0]);
+                break;
+
+            case SIM_TMR1L_ADDRESS:
+                SIM_TimerAccessLow(&SIM_Timers[SIM_TIMER1]);
+                break;
+
+            case SIM_TMR3L_ADDRESS:
+                SIM_TimerAccessLow(&SIM_Timers[SIM_TIMER3]);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static void SIM_ProcessWrites(void)
+{
+    uint8 loc_index = 0;
+    uint8 loc_old = 0;
+
+    if (0 != memcmp(SIM_ShadowFile, (const void *)SIM_RegisterFile, sizeof(SIM_ShadowFile)))
+    {
+        for (loc_index = 0; loc_index < SIM_SFR_COUNT; loc_index++)
+        {
+            if (SIM_ShadowFile[loc_index] != SIM_RegisterFile[loc_index])
+            {
+                loc_old = SIM_ShadowFile[loc_index];
+                SIM_ShadowFile[loc_index] = SIM_RegisterFile[loc_index];
+
+                SIM_OnWrite(SIM_SFR_BASE_ADDRESS + loc_index, loc_old, SIM_RegisterFile[loc_index]);
+            }
+        }
+    }
+}
+
+static void SIM_OnWrite(const uint16 Address, const uint8 OldValue, const uint8 NewValue)
+{
+    const uint8 loc_rising = (uint8)(NewValue & ~OldValue);
+    const uint8 loc_falling = (uint8)(OldValue & ~NewValue);
+
+    switch (Address)
+    {
+        case SIM_PORTA_ADDRESS:
+        case SIM_PORTB_ADDRESS:
+        case SIM_PORTC_ADDRESS:
+        case SIM_PORTD_ADDRESS:
+        case SIM_PORTE_ADDRESS:
+            /* Writing PORTx writes the output latch */
+            SIM_Publish(Address - SIM_PORTA_ADDRESS + SIM_LATA_ADDRESS, NewValue);
+            break;
+
+        case SIM_EECON1_ADDRESS:
+            if (0 != (loc_rising & SIM_EECON1_RD))
+            {
+                if (0 == (NewValue & (SIM_EECON1_EEPGD | SIM_EECON1_CFGS)))
+                {
+                    SIM_Publish(SIM_EEDATA_ADDRESS, SIM_Eeprom[SIM_EepromCurrentAddress()]);
+                }
+
+                SIM_ClearBits(SIM_EECON1_ADDRESS, SIM_EECON1_RD);
+            }
+
+            if (0 != (loc_rising & SIM_EECON1_WR))
+            {
+                SIM_EepromStartWrite();
+            }
+
+            SIM_EepromUnlockStep = 0;
+            break;
+
+        case SIM_ADCON0_ADDRESS:
+            if (0 != (loc_rising & SIM_ADCON0_GO))
+            {
+                SIM_AdcStart();
+            }
+            else if ((0 != (loc_falling & (SIM_ADCON0_GO | SIM_ADCON0_ADON))) && (TRUE == SIM_AdcBusy))
+            {
+                SIM_AdcBusy = FALSE;
+                SIM_ClearBits(SIM_ADCON0_ADDRESS, SIM_ADCON0_GO);
+            }
+            break;
+
+        case SIM_RCSTA_ADDRESS:
+            if (0 != (loc_falling & SIM_RCSTA_CREN))
+            {
+                SIM_ClearBits(SIM_RCSTA_ADDRESS, SIM_RCSTA_OERR);
+            }
+            break;
+
+        case SIM_TMR0H_ADDRESS:
+            SIM_TimerWriteHigh(&SIM_Timers[SIM_TIMER0], NewValue);
+            break;
+
+        case SIM_TMR1H_ADDRESS:
+            SIM_TimerWriteHigh(&SIM_Timers[SIM_TIMER1], NewValue);
+            break;
+
+        case SIM_TMR3H_ADDRESS:
+            SIM_TimerWriteHigh(&SIM_Timers[SIM_TIMER3], NewValue);
+            break;
+
+        case SIM_T2CON_ADDRESS:
+            SIM_Timer2PrescalerCycles = 0;
+            SIM_Timer2Postscaler = 0;
+            break;
+
+        /* Changing the mode clears the capture prescaler */
+        case SIM_CCP1CON_ADDRESS:
+            SIM_CcpPrescalers[SIM_CCP1] = 0;
+            break;
+
+        case SIM_CCP2CON_ADDRESS:
+            SIM_CcpPrescalers[SIM_CCP2] = 0;
+            break;
+
+        case SIM_SSPCON2_ADDRESS:
+            /* An event requested while another one is in progress is ignored, as on the part */
+            if ((0 != (loc_rising & SIM_SSPCON2_EVENTS)) && (TRUE == SIM_I2cIsMaster()) && (0 == SIM_I2cEvent))
+            {
+                if (0 != (loc_rising & SIM_SSPCON2_RCEN))
+                {
+                    SIM_I2cStartEvent(SIM_SSPCON2_RCEN, 8);
+                }
+                else
+                {
+                    SIM_I2cStartEvent(loc_rising & SIM_SSPCON2_EVENTS, 1);
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (NULL_PTR != SIM_WriteHooks[SIM_INDEX(Address)])
+    {
+        SIM_WriteHooks[SIM_INDEX(Address)](Address, NewValue);
+    }
+}
+
+static void SIM_Advance(const uint32 Cycles)
+{
+    uint8 loc_index = 0;
+
+    SIM_Cycles += Cycles;
+
+    for (loc_index = 0; loc_index < SIM_TIMER_LIMIT; loc_index++)
+    {
+        SIM_TimerAdvance(&SIM_Timers[loc_index], Cycles);
+    }
+
+    SIM_Timer2Advance(Cycles);
+    SIM_SpiAdvance(Cycles);
+    SIM_I2cAdvance(Cycles);
+    SIM_EusartAdvance(Cycles);
+    SIM_AdcAdvance(Cycles);
+    SIM_EepromAdvance(Cycles);
+}
+
+static void SIM_RefreshPorts(void)
+{
+    uint8 loc_port = 0;
+    uint8 loc_tris = 0;
+    uint8 loc_value = 0;
+    uint8 loc_changed = 0;
+    uint8 loc_rising = 0;
+    uint8 loc_edges = 0;
+    uint8 loc_ccp = 0;
+    const uint8 loc_oldPortB = SIM_READ(SIM_PORTB_ADDRESS);
+    const uint8 loc_oldPortC = SIM_READ(SIM_PORTC_ADDRESS);
+
+    for (loc_port = 0; loc_port < NUMBER_OF_PORTS; loc_port++)
+    {
+        loc_tris = SIM_READ(SIM_TRISA_ADDRESS + loc_port);
+        loc_value = (uint8)((SIM_READ(SIM_LATA_ADDRESS + loc_port) & ~loc_tris) | (SIM_PortInputs[loc_port] & loc_tris));
+
+        SIM_Publish(SIM_PORTA_ADDRESS + loc_port, loc_value);
+    }
+
+    /* External interrupts only see edges on pins configured as inputs */
+    loc_tris = SIM_READ(SIM_TRISB_ADDRESS);
+    loc_changed = (uint8)((loc_oldPortB ^ SIM_READ(SIM_PORTB_ADDRESS)) & loc_tris);
+    loc_rising = (uint8)(loc_changed & SIM_READ(SIM_PORTB_ADDRESS));
+
+    if (0 != (loc_changed & 0xF0))
+    {
+        SIM_SetBits(SIM_INTCON_ADDRESS, SIM_INTCON_RBIF);
+    }
+
+    loc_edges = SIM_READ(SIM_INTCON2_ADDRESS);
+
+    if ((0 != (loc_changed & 0x01)) && ((0 != (loc_rising & 0x01)) == (0 != (loc_edges & SIM_INTCON2_INTEDG0))))
+    {
+        SIM_SetBits(SIM_INTCON_ADDRESS, SIM_INTCON_INT0IF);
+    }
+
+    if ((0 != (loc_changed & 0x02)) && ((0 != (loc_rising & 0x02)) == (0 != (loc_edges & SIM_INTCON2_INTEDG1))))
+    {
+        SIM_SetBits(SIM_INTCON3_ADDRESS, SIM_INTCON3_INT1IF);
+    }
+
+    if ((0 != (loc_changed & 0x04)) && ((0 != (loc_rising & 0x04)) == (0 != (loc_edges & SIM_INTCON2_INTEDG2))))
+    {
+        SIM_SetBits(SIM_INTCON3_ADDRESS, SIM_INTCON3_INT2IF);
+    }
+
+    /* The capture inputs likewise */
+    loc_changed = (uint8)((loc_oldPortC ^ SIM_READ(SIM_PORTC_ADDRESS)) & SIM_READ(SIM_TRISC_ADDRESS));
+
+    for (loc_ccp = 0; loc_ccp < SIM_CCP_LIMIT; loc_ccp++)
+    {
+        if (0 != (loc_changed & SIM_Ccps[loc_ccp].PinMask))
+        {
+            SIM_CcpCaptureEdge((SIM_CcpIndexTypeDef)loc_ccp,
+                               (0 != (SIM_READ(SIM_PORTC_ADDRESS) & SIM_Ccps[loc_ccp].PinMask)));
+        }
+    }
+}
+
+static void SIM_DispatchInterrupts(void)
+{
+    const boolean loc_priorities = SIM_IS_SET(SIM_RCON_ADDRESS, SIM_RCON_IPEN);
+    const uint8 loc_intcon = SIM_READ(SIM_INTCON_ADDRESS);
+    boolean loc_highPending = FALSE;
+    boolean loc_lowPending = FALSE;
+    uint8 loc_source = 0;
+    uint8 loc_active = 0;
+    uint8 loc_high = 0;
+    const SIM_InterruptSourceTypeDef * loc_entry = NULL_PTR;
+
+    for (loc_source = 0; loc_source < (sizeof(SIM_InterruptSources) / sizeof(SIM_InterruptSources[0])); loc_source++)
+    {
+        loc_entry = &SIM_InterruptSources[loc_source];
+
+        loc_active = (uint8)(SIM_READ(loc_entry->Address) & loc_entry->FlagMask);
+
+        /* Core flags share their register with their enable bits, the flag mask selects the single source */
+        if (FALSE == loc_entry->Peripheral)
+        {
+            loc_active = (0 != loc_active) && SIM_IS_SET(loc_entry->EnableAddress, loc_entry->EnableMask);
+            loc_high = (SIM_NO_ACCESS == loc_entry->PriorityAddress) ||
+                       SIM_IS_SET(loc_entry->PriorityAddress, loc_entry->PriorityMask);
+            loc_high = loc_high ? loc_active : 0;
+        }
+        else
+        {
+            loc_active &= SIM_READ(loc_entry->EnableAddress);
+            loc_high = (uint8)(loc_active & SIM_READ(loc_entry->PriorityAddress));
+
+            if ((FALSE == loc_priorities) && (0 == (loc_intcon & SIM_INTCON_PEIE)))
+            {
+                loc_active = 0;
+            }
+        }
+
+        if (0 != loc_active)
+        {
+            if ((FALSE == loc_priorities) || (0 != loc_high))
+            {
+                loc_highPending = TRUE;
+            }
+            else
+            {
+                loc_lowPending = TRUE;
+            }
+        }
+    }
+
+    if (FALSE == loc_priorities)
+    {
+        if ((TRUE == loc_highPending) && (0 != (loc_intcon & SIM_INTCON_GIE)) && (NULL_PTR != SIM_HighVector))
+        {
+            SIM_ClearBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIE);
+            SIM_HighVector();
+            SIM_ProcessFirmwareAccess();
+            SIM_SetBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIE);
+        }
+    }
+    else if ((TRUE == loc_highPending) && (0 != (loc_intcon & SIM_INTCON_GIEH)) && (NULL_PTR != SIM_HighVector))
+    {
+        SIM_ClearBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIEH);
+        SIM_HighVector();
+        SIM_ProcessFirmwareAccess();
+        SIM_SetBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIEH);
+    }
+    else if ((TRUE == loc_lowPending) && (SIM_INTCON_GIEH | SIM_INTCON_GIEL) == (loc_intcon & (SIM_INTCON_GIEH | SIM_INTCON_GIEL)) &&
+             (NULL_PTR != SIM_LowVector))
+    {
+        SIM_ClearBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIEL);
+        SIM_LowVector();
+        SIM_ProcessFirmwareAccess();
+        SIM_SetBits(SIM_INTCON_ADDRESS, SIM_INTCON_GIEL);
+    }
+    else
+    {
+        /* Nothing to dispatch */
+    }
+}
+
+static void SIM_Publish(const uint16 Address, const uint8 Value)
+{
+    SIM_RegisterFile[SIM_INDEX(Address)] = Value;
+    SIM_ShadowFile[SIM_INDEX(Address)] = Value;
+}
+
+static void SIM_SetBits(const uint16 Address, const uint8 Mask)
+{
+    SIM_Publish(Address, (uint8)(SIM_READ(Address) | Mask));
+}
+
+static void SIM_ClearBits(const uint16 Address, const uint8 Mask)
+{
+    SIM_Publish(Address, (uint8)(SIM_READ(Address) & ~Mask));
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          TIMER0, TIMER1, TIMER2, TIMER3                                            */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static boolean SIM_TimerIsBuffered(const SIM_TimerTypeDef * const Timer)
+{
+    /* TMR0H is always a buffer, TMR1H/TMR3H only in 16-bit read/write mode */
+    return (SIM_T0CON_ADDRESS == Timer->ControlAddress) || SIM_IS_SET(Timer->ControlAddress, SIM_TxCON_RD16);
+}
+
+static void SIM_TimerAccessLow(SIM_TimerTypeDef * const Timer)
+{
+    const uint8 loc_low = SIM_READ(Timer->LowAddress);
+    const boolean loc_written = (loc_low != SIM_ShadowFile[SIM_INDEX(Timer->LowAddress)]) ||
+                                ((TRUE == SIM_TimerIsBuffered(Timer)) && (TRUE == Timer->HighBufferWritten));
+
+    SIM_ShadowFile[SIM_INDEX(Timer->LowAddress)] = loc_low;
+
+    if (TRUE == loc_written)
+    {
+        if (TRUE == SIM_TimerIsBuffered(Timer))
+        {
+            Timer->Counter = (uint16)(((uint16)Timer->HighBuffer << 8) | loc_low);
+            Timer->HighBufferWritten = FALSE;
+        }
+        else
+        {
+            Timer->Counter = (uint16)((Timer->Counter & 0xFF00) | loc_low);
+        }
+
+        Timer->PrescalerCycles = 0;
+
+        if (NULL_PTR != SIM_WriteHooks[SIM_INDEX(Timer->LowAddress)])
+        {
+            SIM_WriteHooks[SIM_INDEX(Timer->LowAddress)](Timer->LowAddress, loc_low);
+        }
+    }
+    else if (TRUE == SIM_TimerIsBuffered(Timer))
+    {
+        /* Reading the low byte latches the high byte that belongs to it */
+        Timer->HighBuffer = Timer->LatchedHigh;
+        SIM_Publish(Timer->HighAddress, Timer->HighBuffer);
+    }
+    else
+    {
+        /* Plain read */
+    }
+}
+
+static void SIM_TimerWriteHigh(SIM_TimerTypeDef * const Timer, const uint8 Value)
+{
+    if (TRUE == SIM_TimerIsBuffered(Timer))
+    {
+        Timer->HighBuffer = Value;
+        Timer->HighBufferWritten = TRUE;
+    }
+    else
+    {
+        Timer->Counter = (uint16)(((uint16)Value << 8) | (Timer->Counter & 0x00FF));
+    }
+}
+
+static void SIM_TimerAdvance(SIM_TimerTypeDef * const Timer, const uint32 Cycles)
+{
+    const uint8 loc_control = SIM_READ(Timer->ControlAddress);
+    boolean loc_running = FALSE;
+    boolean loc_8bit = FALSE;
+    uint32 loc_prescaler = 1;
+    uint32 loc_ticks = 0;
+    uint32 loc_count = 0;
+
+    if (SIM_T0CON_ADDRESS == Timer->ControlAddress)
+    {
+        loc_running = (0 != (loc_control & SIM_T0CON_TMR0ON)) && (0 == (loc_control & SIM_T0CON_T0CS));
+        loc_8bit = (0 != (loc_control & SIM_T0CON_T08BIT));
+        loc_prescaler = (0 != (loc_control & SIM_T0CON_PSA)) ? 1UL : (2UL << (loc_control & 0x07));
+    }
+    else
+    {
+        loc_running = (0 != (loc_control & SIM_TxCON_TMRxON)) && (0 == (loc_control & SIM_TxCON_TMRxCS));
+        loc_prescaler = 1UL << ((loc_control >> 4) & 0x03);
+    }
+
+    if ((TRUE == loc_running) && (Cycles > 0))
+    {
+        Timer->PrescalerCycles += Cycles;
+        loc_ticks = Timer->PrescalerCycles / loc_prescaler;
+        Timer->PrescalerCycles %= loc_prescaler;
+
+        if (TRUE == loc_8bit)
+        {
+            loc_count = (Timer->Counter & 0x00FF) + loc_ticks;
+            Timer->Counter = (uint16)((Timer->Counter & 0xFF00) | (loc_count & 0x00FF));
+
+            if (loc_count > 0xFF)
+            {
+                SIM_SetBits(Timer->FlagAddress, Timer->FlagMask);
+            }
+        }
+        else if (TRUE == SIM_CcpCompareAdvance(Timer, loc_ticks))
+        {
+            /* The counter was reset by a special event trigger */
+        }
+        else
+        {
+            loc_count = (uint32)Timer->Counter + loc_ticks;
+            Timer->Counter = (uint16)loc_count;
+
+            if (loc_count > 0xFFFF)
+            {
+                SIM_SetBits(Timer->FlagAddress, Timer->FlagMask);
+            }
+        }
+    }
+
+    SIM_Publish(Timer->LowAddress, (uint8)Timer->Counter);
+    Timer->LatchedHigh = (uint8)(Timer->Counter >> 8);
+
+    if (FALSE == SIM_TimerIsBuffered(Timer))
+    {
+        SIM_Publish(Timer->HighAddress, Timer->LatchedHigh);
+    }
+}
+
+static void SIM_Timer2Advance(const uint32 Cycles)
+{
+    static const uint8 loc_prescalers[4] = {1, 4, 16, 16};
+    const uint8 loc_control = SIM_READ(SIM_T2CON_ADDRESS);
+    const uint8 loc_period = SIM_READ(SIM_PR2_ADDRESS);
+    uint8 loc_counter = SIM_READ(SIM_TMR2_ADDRESS);
+    uint32 loc_ticks = 0;
+
+    if (0 != (loc_control & SIM_T2CON_TMR2ON))
+    {
+        SIM_Timer2PrescalerCycles += Cycles;
+        loc_ticks = SIM_Timer2PrescalerCycles / loc_prescalers[loc_control & 0x03];
+        SIM_Timer2PrescalerCycles %= loc_prescalers[loc_control & 0x03];
+
+        while (loc_ticks > 0)
+        {
+            if (loc_counter == loc_period)
+            {
+                loc_counter = 0;
+
+                if (SIM_Timer2Postscaler >= ((loc_control >> 3) & 0x0F))
+                {
+                    SIM_Timer2Postscaler = 0;
+                    SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_TMR2IF);
+                }
+                else
+                {
+                    SIM_Timer2Postscaler++;
+                }
+            }
+            else
+            {
+                loc_counter++;
+            }
+
+            loc_ticks--;
+        }
+
+        SIM_Publish(SIM_TMR2_ADDRESS, loc_counter);
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          MSSP (SPI)                                                                */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static void SIM_SpiWrite(const uint8 Value)
+{
+    const uint8 loc_control = SIM_READ(SIM_SSPCON1_ADDRESS);
+    uint32 loc_bitCycles = 0;
+
+    if ((0 != (loc_control & SIM_SSPCON1_SSPEN)) && ((loc_control & SIM_SSPCON1_SSPM) <= SIM_SSPM_SPI_MASTER_TMR2))
+    {
+        if (TRUE == SIM_SpiBusy)
+        {
+            SIM_SetBits(SIM_SSPCON1_ADDRESS, SIM_SSPCON1_WCOL);
+        }
+        else
+        {
+            switch (loc_control & SIM_SSPCON1_SSPM)
+            {
+                case 0x00: loc_bitCycles = 1; break;
+                case 0x01: loc_bitCycles = 4; break;
+                case 0x02: loc_bitCycles = 16; break;
+                default:   loc_bitCycles = 2UL * ((uint32)SIM_READ(SIM_PR2_ADDRESS) + 1UL); break;
+            }
+
+            SIM_SpiBusy = TRUE;
+            SIM_SpiTxByte = Value;
+            SIM_SpiRemainingCycles = 8UL * loc_bitCycles;
+            SIM_Publish(SIM_SSPBUF_ADDRESS, Value);
+        }
+    }
+    else if (TRUE == SIM_I2cIsMaster())
+    {
+        if (0 != SIM_I2cEvent)
+        {
+            SIM_SetBits(SIM_SSPCON1_ADDRESS, SIM_SSPCON1_WCOL);
+        }
+        else
+        {
+            /* The byte and the acknowledge clock of the device */
+            SIM_I2cTxByte = Value;
+            SIM_I2cStartEvent(SIM_I2C_WRITE_EVENT, 9);
+            SIM_Publish(SIM_SSPBUF_ADDRESS, Value);
+        }
+    }
+    else
+    {
+        /* In slave mode the byte waits in the shift register for the external master */
+        SIM_SpiTxByte = Value;
+        SIM_Publish(SIM_SSPBUF_ADDRESS, Value);
+    }
+}
+
+static void SIM_SpiAdvance(const uint32 Cycles)
+{
+    uint8 loc_miso = 0xFF;
+
+    if (TRUE == SIM_SpiBusy)
+    {
+        if (SIM_SpiRemainingCycles > Cycles)
+        {
+            SIM_SpiRemainingCycles -= Cycles;
+        }
+        else
+        {
+            SIM_SpiBusy = FALSE;
+            SIM_SpiRemainingCycles = 0;
+
+            if (NULL_PTR != SIM_SpiDevice)
+            {
+                loc_miso = SIM_SpiDevice(SIM_SpiTxByte);
+            }
+
+            if (SIM_IS_SET(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF))
+            {
+                SIM_SetBits(SIM_SSPCON1_ADDRESS, SIM_SSPCON1_SSPOV);
+            }
+            else
+            {
+                SIM_Publish(SIM_SSPBUF_ADDRESS, loc_miso);
+                SIM_SetBits(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF);
+            }
+
+            SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_SSPIF);
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          MSSP (I2C master)                                                         */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static boolean SIM_I2cIsMaster(void)
+{
+    const uint8 loc_control = SIM_READ(SIM_SSPCON1_ADDRESS);
+
+    return ((0 != (loc_control & SIM_SSPCON1_SSPEN)) && ((loc_control & SIM_SSPCON1_SSPM) == SIM_SSPM_I2C_MASTER))
+               ? TRUE : FALSE;
+}
+
+static void SIM_I2cStartEvent(const uint8 Event, const uint32 Bits)
+{
+    /* SCL frequency = FOSC / (4 * (SSPADD + 1)), a bit lasts SSPADD + 1 instruction cycles */
+    SIM_I2cEvent = Event;
+    SIM_I2cRemainingCycles = Bits * ((uint32)SIM_READ(SIM_SSPADD_ADDRESS) + 1UL);
+}
+
+static void SIM_I2cAdvance(const uint32 Cycles)
+{
+    const uint8 loc_event = SIM_I2cEvent;
+    uint8 loc_data = 0xFF;
+    boolean loc_acknowledged = FALSE;
+
+    if (0 != loc_event)
+    {
+        if (SIM_I2cRemainingCycles > Cycles)
+        {
+            SIM_I2cRemainingCycles -= Cycles;
+        }
+        else
+        {
+            SIM_I2cEvent = 0;
+            SIM_I2cRemainingCycles = 0;
+
+            if (0 != (loc_event & (SIM_SSPCON2_SEN | SIM_SSPCON2_RSEN)))
+            {
+                if (NULL_PTR != SIM_I2cDevice)
+                {
+                    (void)SIM_I2cDevice(SIM_I2C_START, &loc_data);
+                }
+            }
+            else if (0 != (loc_event & SIM_SSPCON2_PEN))
+            {
+                if (NULL_PTR != SIM_I2cDevice)
+                {
+                    (void)SIM_I2cDevice(SIM_I2C_STOP, &loc_data);
+                }
+            }
+            else if (SIM_I2C_WRITE_EVENT == loc_event)
+            {
+                loc_data = SIM_I2cTxByte;
+
+                if (NULL_PTR != SIM_I2cDevice)
+                {
+                    loc_acknowledged = SIM_I2cDevice(SIM_I2C_WRITE, &loc_data);
+                }
+
+                if (TRUE == loc_acknowledged)
+                {
+                    SIM_ClearBits(SIM_SSPCON2_ADDRESS, SIM_SSPCON2_ACKSTAT);
+                }
+                else
+                {
+                    SIM_SetBits(SIM_SSPCON2_ADDRESS, SIM_SSPCON2_ACKSTAT);
+                }
+            }
+            else if (0 != (loc_event & SIM_SSPCON2_RCEN))
+            {
+                if (NULL_PTR != SIM_I2cDevice)
+                {
+                    (void)SIM_I2cDevice(SIM_I2C_READ, &loc_data);
+                }
+
+                if (SIM_IS_SET(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF))
+                {
+                    SIM_SetBits(SIM_SSPCON1_ADDRESS, SIM_SSPCON1_SSPOV);
+                }
+                else
+                {
+                    SIM_Publish(SIM_SSPBUF_ADDRESS, loc_data);
+                    SIM_SetBits(SIM_SSPSTAT_ADDRESS, SIM_SSPSTAT_BF);
+                }
+            }
+            else
+            {
+                /* Acknowledge sequence, nothing to report to the device */
+            }
+
+            /* The event bits clear themselves once the event is complete */
+            SIM_ClearBits(SIM_SSPCON2_ADDRESS, (uint8)(loc_event & SIM_SSPCON2_EVENTS));
+            SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_SSPIF);
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          EUSART                                                                    */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static uint32 SIM_EusartFrameCycles(void)
+{
+    const boolean loc_brg16 = SIM_IS_SET(SIM_BAUDCON_ADDRESS, SIM_BAUDCON_BRG16);
+    const boolean loc_brgh = SIM_IS_SET(SIM_TXSTA_ADDRESS, SIM_TXSTA_BRGH);
+    uint32 loc_generator = SIM_READ(SIM_SPBRG_ADDRESS);
+    uint32 loc_bitCycles = 0;
+
+    if (TRUE == loc_brg16)
+    {
+        loc_generator |= ((uint32)SIM_READ(SIM_SPBRGH_ADDRESS) << 8);
+    }
+
+    /* Baud rate = FOSC / (n * (SPBRG + 1)) with n = 64, 16, 16 or 4, expressed here in instruction cycles */
+    if ((FALSE == loc_brg16) && (FALSE == loc_brgh))
+    {
+        loc_bitCycles = 16UL * (loc_generator + 1UL);
+    }
+    else if ((TRUE == loc_brg16) && (TRUE == loc_brgh))
+    {
+        loc_bitCycles = loc_generator + 1UL;
+    }
+    else
+    {
+        loc_bitCycles = 4UL * (loc_generator + 1UL);
+    }
+
+    return loc_bitCycles * (SIM_IS_SET(SIM_TXSTA_ADDRESS, SIM_TXSTA_TX9) ? 11UL : 10UL);
+}
+
+static void SIM_EusartWrite(const uint8 Value)
+{
+    uint16 loc_frame = Value;
+
+    if (SIM_IS_SET(SIM_TXSTA_ADDRESS, SIM_TXSTA_TX9) && SIM_IS_SET(SIM_TXSTA_ADDRESS, SIM_TXSTA_TX9D))
+    {
+        loc_frame |= 0x100;
+    }
+
+    if (NULL_PTR != SIM_WriteHooks[SIM_INDEX(SIM_TXREG_ADDRESS)])
+    {
+        SIM_WriteHooks[SIM_INDEX(SIM_TXREG_ADDRESS)](SIM_TXREG_ADDRESS, Value);
+    }
+
+    SIM_EusartTxRegFrame = loc_frame;
+    SIM_EusartTxRegFull = TRUE;
+
+    SIM_EusartLoadShiftRegister();
+}
+
+static void SIM_EusartRead(void)
+{
+    uint8 loc_index = 0;
+
+    if (SIM_EusartRxCount > 0)
+    {
+        for (loc_index = 1; loc_index < SIM_EusartRxCount; loc_index++)
+        {
+            SIM_EusartRxFifo[loc_index - 1] = SIM_EusartRxFifo[loc_index];
+        }
+
+        SIM_EusartRxCount--;
+    }
+
+    SIM_EusartPublishRx();
+}
+
+static void SIM_EusartLoadShiftRegister(void)
+{
+    const boolean loc_enabled = SIM_IS_SET(SIM_TXSTA_ADDRESS, SIM_TXSTA_TXEN) && SIM_IS_SET(SIM_RCSTA_ADDRESS, SIM_RCSTA_SPEN);
+
+    if ((TRUE == loc_enabled) && (FALSE == SIM_EusartShiftBusy) && (TRUE == SIM_EusartTxRegFull))
+    {
+        SIM_EusartShiftFrame = SIM_EusartTxRegFrame;
+        SIM_EusartTxRegFull = FALSE;
+        SIM_EusartShiftBusy = TRUE;
+        SIM_EusartRemainingCycles = SIM_EusartFrameCycles();
+        SIM_ClearBits(SIM_TXSTA_ADDRESS, SIM_TXSTA_TRMT);
+    }
+
+    /* TXIF mirrors an empty TXREG while the transmitter is enabled */
+    if ((TRUE == loc_enabled) && (FALSE == SIM_EusartTxRegFull))
+    {
+        SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_TXIF);
+    }
+    else
+    {
+        SIM_ClearBits(SIM_PIR1_ADDRESS, SIM_PIR1_TXIF);
+    }
+}
+
+static void SIM_EusartAdvance(const uint32 Cycles)
+{
+    if (TRUE == SIM_EusartShiftBusy)
+    {
+        if (SIM_EusartRemainingCycles > Cycles)
+        {
+            SIM_EusartRemainingCycles -= Cycles;
+        }
+        else
+        {
+            SIM_EusartShiftBusy = FALSE;
+            SIM_EusartRemainingCycles = 0;
+            SIM_SetBits(SIM_TXSTA_ADDRESS, SIM_TXSTA_TRMT);
+
+            if (NULL_PTR != SIM_EusartDevice)
+            {
+                SIM_EusartDevice(SIM_EusartShiftFrame);
+            }
+        }
+    }
+
+    SIM_EusartLoadShiftRegister();
+}
+
+static void SIM_EusartPublishRx(void)
+{
+    if (SIM_EusartRxCount > 0)
+    {
+        SIM_Publish(SIM_RCREG_ADDRESS, (uint8)SIM_EusartRxFifo[0]);
+
+        if (0 != (SIM_EusartRxFifo[0] & 0x100))
+        {
+            SIM_SetBits(SIM_RCSTA_ADDRESS, SIM_RCSTA_RX9D);
+        }
+        else
+        {
+            SIM_ClearBits(SIM_RCSTA_ADDRESS, SIM_RCSTA_RX9D);
+        }
+
+        SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_RCIF);
+    }
+    else
+    {
+        SIM_ClearBits(SIM_PIR1_ADDRESS, SIM_PIR1_RCIF);
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          CCP1, CCP2 capture and compare                                            */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static const SIM_TimerTypeDef * SIM_CcpTimer(const SIM_CcpIndexTypeDef Ccp)
+{
+    const uint8 loc_control = SIM_READ(SIM_T3CON_ADDRESS);
+    const SIM_TimerTypeDef *loc_timer = &SIM_Timers[SIM_TIMER1];
+
+    /* T3CCP2 gives TIMER3 to both modules, T3CCP1 alone gives it to CCP2 only */
+    if ((0 != (loc_control & SIM_T3CON_T3CCP2)) ||
+        ((SIM_CCP2 == Ccp) && (0 != (loc_control & SIM_T3CON_T3CCP1))))
+    {
+        loc_timer = &SIM_Timers[SIM_TIMER3];
+    }
+
+    return loc_timer;
+}
+
+static boolean SIM_CcpCompareAdvance(SIM_TimerTypeDef * const Timer, const uint32 Ticks)
+{
+    uint8 loc_ccp = 0;
+    uint8 loc_mode = 0;
+    uint16 loc_compare = 0;
+    uint16 loc_counter = Timer->Counter;
+    uint32 loc_distance = 0;
+    uint32 loc_period = 0;
+    uint32 loc_remaining = 0;
+    boolean loc_reset = FALSE;
+
+    for (loc_ccp = 0; loc_ccp < SIM_CCP_LIMIT; loc_ccp++)
+    {
+        loc_mode = SIM_READ(SIM_Ccps[loc_ccp].ControlAddress) & SIM_CCPxCON_CCPxM;
+
+        if (((SIM_CCPxM_COMPARE_TOGGLE == loc_mode) || (SIM_CCPxM_COMPARE == (loc_mode & 0x0C))) &&
+            (Timer == SIM_CcpTimer((SIM_CcpIndexTypeDef)loc_ccp)))
+        {
+            loc_compare = (uint16)(((uint16)SIM_READ(SIM_Ccps[loc_ccp].HighAddress) << 8) |
+                                   SIM_READ(SIM_Ccps[loc_ccp].LowAddress));
+
+            /* A special event resets the timer on the tick after the match, CCPRx + 1 ticks per period */
+            loc_period = (SIM_CCPxM_SPECIAL_EVENT == loc_mode) ? ((uint32)loc_compare + 1UL) : 0x10000UL;
+            loc_distance = (uint16)(loc_compare - Timer->Counter);
+
+            if (0 == loc_distance)
+            {
+                loc_distance = loc_period;
+            }
+
+            if (Ticks >= loc_distance)
+            {
+                SIM_SetBits(SIM_Ccps[loc_ccp].FlagAddress, SIM_Ccps[loc_ccp].FlagMask);
+
+                if (SIM_CCPxM_SPECIAL_EVENT == loc_mode)
+                {
+                    if (Timer->Counter > loc_compare)
+                    {
+                        SIM_SetBits(Timer->FlagAddress, Timer->FlagMask);
+                    }
+
+                    loc_remaining = (Ticks - loc_distance) % loc_period;
+                    loc_counter = (0 == loc_remaining) ? loc_compare : (uint16)(loc_remaining - 1UL);
+                    loc_reset = TRUE;
+
+                    /* The CCP2 special event also starts an A/D conversion when the ADC is on */
+                    if ((SIM_CCP2 == loc_ccp) && (FALSE == SIM_AdcBusy) &&
+                        SIM_IS_SET(SIM_ADCON0_ADDRESS, SIM_ADCON0_ADON))
+                    {
+                        SIM_SetBits(SIM_ADCON0_ADDRESS, SIM_ADCON0_GO);
+                        SIM_AdcStart();
+                    }
+                }
+            }
+        }
+    }
+
+    Timer->Counter = loc_counter;
+
+    return loc_reset;
+}
+
+static void SIM_CcpCaptureEdge(const SIM_CcpIndexTypeDef Ccp, const boolean Rising)
+{
+    const uint8 loc_mode = SIM_READ(SIM_Ccps[Ccp].ControlAddress) & SIM_CCPxCON_CCPxM;
+    boolean loc_capture = FALSE;
+
+    switch (loc_mode)
+    {
+        case SIM_CCPxM_CAPTURE_FALLING:
+            loc_capture = (FALSE == Rising);
+            break;
+
+        case SIM_CCPxM_CAPTURE_RISING:
+            loc_capture = Rising;
+            break;
+
+        case SIM_CCPxM_CAPTURE_4TH_RISING:
+        case SIM_CCPxM_CAPTURE_16TH_RISING:
+            if (TRUE == Rising)
+            {
+                SIM_CcpPrescalers[Ccp]++;
+
+                if (SIM_CcpPrescalers[Ccp] >= ((SIM_CCPxM_CAPTURE_4TH_RISING == loc_mode) ? 4 : 16))
+                {
+                    SIM_CcpPrescalers[Ccp] = 0;
+                    loc_capture = TRUE;
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (TRUE == loc_capture)
+    {
+        SIM_Publish(SIM_Ccps[Ccp].LowAddress, (uint8)SIM_CcpTimer(Ccp)->Counter);
+        SIM_Publish(SIM_Ccps[Ccp].HighAddress, (uint8)(SIM_CcpTimer(Ccp)->Counter >> 8));
+        SIM_SetBits(SIM_Ccps[Ccp].FlagAddress, SIM_Ccps[Ccp].FlagMask);
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          ADC                                                                       */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static void SIM_AdcStart(void)
+{
+    static const uint8 loc_acquisitionTads[8] = {0, 2, 4, 6, 8, 12, 16, 20};
+    static const uint32 loc_tadCycles[8] = {1, 2, 8, SIM_ADC_RC_TAD_CYCLES, 1, 4, 16, SIM_ADC_RC_TAD_CYCLES};
+    const uint8 loc_adcon2 = SIM_READ(SIM_ADCON2_ADDRESS);
+
+    if (SIM_IS_SET(SIM_ADCON0_ADDRESS, SIM_ADCON0_ADON))
+    {
+        SIM_AdcBusy = TRUE;
+        SIM_AdcChannel = (uint8)((SIM_READ(SIM_ADCON0_ADDRESS) >> 2) & 0x0F);
+        SIM_AdcRemainingCycles = (loc_acquisitionTads[(loc_adcon2 >> 3) & 0x07] + 11UL) * loc_tadCycles[loc_adcon2 & 0x07];
+    }
+    else
+    {
+        SIM_ClearBits(SIM_ADCON0_ADDRESS, SIM_ADCON0_GO);
+    }
+}
+
+static void SIM_AdcAdvance(const uint32 Cycles)
+{
+    uint16 loc_result = 0;
+
+    if (TRUE == SIM_AdcBusy)
+    {
+        if (SIM_AdcRemainingCycles > Cycles)
+        {
+            SIM_AdcRemainingCycles -= Cycles;
+        }
+        else
+        {
+            SIM_AdcBusy = FALSE;
+            SIM_AdcRemainingCycles = 0;
+
+            if (SIM_AdcChannel < SIM_ADC_CHANNELS)
+            {
+                loc_result = SIM_AdcInputs[SIM_AdcChannel];
+            }
+
+            if (SIM_IS_SET(SIM_ADCON2_ADDRESS, SIM_ADCON2_ADFM))
+            {
+                SIM_Publish(SIM_ADRESH_ADDRESS, (uint8)(loc_result >> 8));
+                SIM_Publish(SIM_ADRESL_ADDRESS, (uint8)loc_result);
+            }
+            else
+            {
+                SIM_Publish(SIM_ADRESH_ADDRESS, (uint8)(loc_result >> 2));
+                SIM_Publish(SIM_ADRESL_ADDRESS, (uint8)(loc_result << 6));
+            }
+
+            SIM_ClearBits(SIM_ADCON0_ADDRESS, SIM_ADCON0_GO);
+            SIM_SetBits(SIM_PIR1_ADDRESS, SIM_PIR1_ADIF);
+        }
+    }
+}
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          Data EEPROM                                                               */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+static uint16 SIM_EepromCurrentAddress(void)
+{
+    return (uint16)((((uint16)SIM_READ(SIM_EEADRH_ADDRESS) << 8) | SIM_READ(SIM_EEADR_ADDRESS)) % SIM_EEPROM_SIZE);
+}
+
+static void SIM_EepromStartWrite(void)
+{
+    const uint8 loc_control = SIM_READ(SIM_EECON1_ADDRESS);
+
+    if ((2 == SIM_EepromUnlockStep) && (FALSE == SIM_EepromBusy) && (0 != (loc_control & SIM_EECON1_WREN)) &&
+        (0 == (loc_control & (SIM_EECON1_EEPGD | SIM_EECON1_CFGS))))
+    {
+        SIM_EepromBusy = TRUE;
+        SIM_EepromAddress = SIM_EepromCurrentAddress();
+        SIM_EepromData = SIM_READ(SIM_EEDATA_ADDRESS);
+        SIM_EepromRemainingCycles = SIM_EEPROM_WRITE_CYCLES;
+    }
+    else if (FALSE == SIM_EepromBusy)
+    {
+        /* The write is ignored without the 0x55/0xAA unlock sequence */
+        SIM_ClearBits(SIM_EECON1_ADDRESS, SIM_EECON1_WR);
+    }
+    else
+    {
+        /* A write is already in progress */
+    }
+}
+
+static void SIM_EepromAdvance(const uint32 Cycles)
+{
+    if (TRUE == SIM_EepromBusy)
+    {
+        if (SIM_EepromRemainingCycles > Cycles)
+        {
+            SIM_EepromRemainingCycles -= Cycles;
+        }
+        else
+        {
+            SIM_EepromBusy = FALSE;
+            SIM_EepromRemainingCycles = 0;
+            SIM_Eeprom[SIM_EepromAddress] = SIM_EepromData;
+            SIM_EepromWrites++;
+
+            SIM_ClearBits(SIM_EECON1_ADDRESS, SIM_EECON1_WR);
+            SIM_SetBits(SIM_PIR2_ADDRESS, SIM_PIR2_EEIF);
+        }
+    }
+}
@@ -0,0 +1,210 @@
+/**
+ * @file SIM.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Host Simulator Interface
+ *
+ * The host simulator lets the MCAL and ECUAL drivers be compiled with a host compiler (gcc) and exercised off-target.
+ * It owns a simulated PIC18F4620 register file, keeps an instruction-cycle clock and models the side effects of the
+ * peripherals the drivers rely on: PORT read-back, TIMER0..3 counting and overflow flags, the CCP1/CCP2 compare
+ * match and special event trigger, the MSSP in SPI master and slave modes and in I2C master mode, the EUSART
+ * transmitter and receiver, the ADC conversion sequence, the data EEPROM read/write sequence and interrupt dispatch
+ * through the registered vectors.
+ *
+ * Every register access made by a driver goes through `SIM_Access()`, so the simulator can report how many SFR
+ * accesses and simulated instruction cycles a driver call costs.
+ *
+ * @note This header is only used by host builds, it is pulled in by `lib/compiler.h` and `MCAL/mcu_registers.h`
+ *       when the compiler is not XC8.
+ * @note A register write is observed by the simulator on the next SFR access, on the next `SIM_Sync()` call or on
+ *       the next call to any other function of this interface, the same way a peripheral on the real part reacts
+ *       one instruction after the write.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include "../lib/Std_Types.h"
+#include "SIM_Config.h"
+
+#define SIM_SFR_BASE_ADDRESS                            0xF80
+#define SIM_SFR_COUNT                                   128
+
+typedef void (*SIM_VectorTypeDef)(void);
+typedef void (*SIM_WriteHookTypeDef)(const uint16 Address, const uint8 Value);
+typedef uint8 (*SIM_SpiDeviceTypeDef)(const uint8 Mosi);
+typedef void (*SIM_EusartDeviceTypeDef)(const uint16 Frame);
+
+typedef enum
+{
+    SIM_I2C_START = 0,          /* START or repeated START */
+    SIM_I2C_WRITE,              /* Address or data byte from the master in *Data, TRUE acknowledges it */
+    SIM_I2C_READ,               /* The device stores the byte read by the master in *Data */
+    SIM_I2C_STOP,
+
+} SIM_I2cEventTypeDef;
+
+typedef boolean (*SIM_I2cDeviceTypeDef)(const SIM_I2cEventTypeDef Event, uint8 * const Data);
+
+extern volatile uint8 SIM_RegisterFile[SIM_SFR_COUNT];
+
+/**
+ * @brief Accesses a special function register.
+ *
+ * Counts the access, advances the simulated clock by `SIM_CYCLES_PER_ACCESS`, lets the peripheral models react to
+ * the previous access and services pending interrupts, then returns the address of the register cell.
+ *
+ * @param Address Data memory address of the SFR (0xF80..0xFFF).
+ * @return volatile uint8* Address of the simulated register.
+ *
+ * @note Drivers never call this function directly, it is used by the register names in `SIM_Registers.h`.
+ */
+volatile uint8 * SIM_Access(const uint16 Address);
+
+/**
+ * @brief Accesses a buffer register whose writes must be detected even when the written value does not change
+ *        (SSPBUF).
+ *
+ * @param Address Data memory address of the SFR.
+ * @return volatile uint16* Address of a write-detection cell holding the current register value.
+ */
+volatile uint16 * SIM_AccessBuffer(const uint16 Address);
+
+/**
+ * @brief Restores every register, peripheral model, counter and device hook to its power-on state.
+ */
+void SIM_Reset(void);
+
+/**
+ * @brief Lets the peripheral models observe the last register access without advancing the simulated clock.
+ */
+void SIM_Sync(void);
+
+/**
+ * @brief Advances the simulated clock, servicing interrupts along the way.
+ *
+ * @param Cycles Number of instruction cycles to elapse.
+ */
+void SIM_DelayCycles(const uint32 Cycles);
+
+/**
+ * @brief Returns the number of instruction cycles elapsed since the last `SIM_Reset()`.
+ */
+uint32 SIM_GetCycleCount(void);
+
+/**
+ * @brief Returns the number of SFR accesses made since the last `SIM_Reset()`.
+ */
+uint32 SIM_GetAccessCount(void);
+
+/**
+ * @brief Returns the number of accesses made to a single SFR since the last `SIM_Reset()`.
+ *
+ * @param Address Data memory address of the SFR.
+ */
+uint32 SIM_GetRegisterAccessCount(const uint16 Address);
+
+/**
+ * @brief Registers the interrupt vectors called when an enabled interrupt flag is raised.
+ *
+ * With priorities disabled (RCON.IPEN = 0) only @param HighVector is used, matching the single vector at 0x0008.
+ *
+ * @param HighVector Function called for high priority (or all) interrupts, NULL_PTR disables dispatch.
+ * @param LowVector Function called for low priority interrupts, NULL_PTR disables dispatch.
+ */
+void SIM_SetInterruptVectors(const SIM_VectorTypeDef HighVector, const SIM_VectorTypeDef LowVector);
+
+/**
+ * @brief Installs a hook called after the firmware writes to an SFR.
+ *
+ * @param Address Data memory address of the SFR.
+ * @param Hook Function receiving the address and the written value, NULL_PTR removes the hook.
+ * @return Std_ReturnType E_NOT_OK if @param Address is outside the SFR space.
+ */
+Std_ReturnType SIM_SetWriteHook(const uint16 Address, const SIM_WriteHookTypeDef Hook);
+
+/**
+ * @brief Drives the external level of the pins of a port, visible on the pins configured as inputs.
+ *
+ * Edges on the input pins raise the external interrupts (RB0..RB2), the interrupt on change (RB4..RB7) and the
+ * captures of CCP1 (RC2) and CCP2 (RC1).
+ *
+ * @param Port Port index (0 = PORTA .. 4 = PORTE).
+ * @param Value Pin levels.
+ * @return Std_ReturnType E_NOT_OK if @param Port is invalid.
+ */
+Std_ReturnType SIM_SetPortInput(const uint8 Port, const uint8 Value);
+
+/**
+ * @brief Sets the 10-bit value converted by the ADC on an analog channel.
+ *
+ * @param Channel Analog channel (AN0..AN12).
+ * @param Value Conversion result, 0..1023.
+ * @return Std_ReturnType E_NOT_OK if @param Channel is invalid.
+ */
+Std_ReturnType SIM_SetAdcInput(const uint8 Channel, const uint16 Value);
+
+/**
+ * @brief Connects a device to the SPI bus, called with every byte shifted out by the MSSP master.
+ *
+ * @param Device Function returning the byte shifted back on SDI, NULL_PTR keeps SDI pulled high (0xFF).
+ */
+void SIM_SetSpiDevice(const SIM_SpiDeviceTypeDef Device);
+
+/**
+ * @brief Clocks a byte into the MSSP in SPI slave mode, as an external master would.
+ *
+ * @param Mosi Byte shifted in on SDI.
+ * @param Miso_ret Pointer to a variable where the byte shifted out on SDO is stored, or NULL_PTR.
+ * @return Std_ReturnType E_NOT_OK if the MSSP is not an enabled SPI slave or RA5 (SS) is high in the SS mode.
+ */
+Std_ReturnType SIM_SpiSlaveExchange(const uint8 Mosi, uint8 * const Miso_ret);
+
+/**
+ * @brief Connects a device to the I2C bus, called with every bus event generated by the MSSP master.
+ *
+ * @param Device Function handling the bus events, NULL_PTR leaves the bus without device (no acknowledge, 0xFF).
+ */
+void SIM_SetI2cDevice(const SIM_I2cDeviceTypeDef Device);
+
+/**
+ * @brief Makes the MSSP master lose the bus in the middle of its current START, STOP, byte or acknowledge.
+ *
+ * @return Std_ReturnType E_NOT_OK if the I2C master is idle.
+ */
+Std_ReturnType SIM_I2cBusCollision(void);
+
+/**
+ * @brief Connects a device to the EUSART TX line, called with every frame once its stop bit has been shifted out.
+ *
+ * @param Device Function receiving the 8 or 9-bit frame, NULL_PTR discards transmitted frames.
+ */
+void SIM_SetEusartDevice(const SIM_EusartDeviceTypeDef Device);
+
+/**
+ * @brief Delivers a frame on the EUSART RX line.
+ *
+ * @param Frame 8 or 9-bit frame.
+ * @return Std_ReturnType E_NOT_OK if the receiver is disabled or the frame was lost to an overrun.
+ */
+Std_ReturnType SIM_EusartReceive(const uint16 Frame);
+
+/**
+ * @brief Reads the simulated data EEPROM without going through the EECON1 sequence.
+ */
+uint8 SIM_EepromRead(const uint16 Address);
+
+/**
+ * @brief Writes the simulated data EEPROM without going through the EECON1 sequence.
+ */
+void SIM_EepromWrite(const uint16 Address, const uint8 Value);
+
+/**
+ * @brief Returns the number of EEPROM cells programmed by the firmware since the last `SIM_Reset()`.
+ */
+uint32 SIM_GetEepromWriteCount(void);
+
+#endif /* _SIM_H_ */
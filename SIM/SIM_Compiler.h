@@ -0,0 +1,32 @@
+/**
+ * @file SIM_Compiler.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief XC8 Built-ins For Host Builds
+ *
+ * Provides the XC8 keywords and built-ins used by the drivers (`__interrupt()`, `NOP()`, `__delay_ms()`,
+ * `__delay_us()`, `di()`, `ei()`) so they compile with a host compiler. Delays and `NOP()` advance the simulated
+ * instruction clock instead of burning host time.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SIM_COMPILER_H_
+#define _SIM_COMPILER_H_
+
+#include "SIM.h"
+
+#define __interrupt(...)
+#define __at(x)
+
+#define NOP()                       SIM_DelayCycles(1)
+#define CLRWDT()                    SIM_DelayCycles(1)
+
+#define __delay_us(x)               SIM_DelayCycles((uint32)(((uint64)(x) * (_XTAL_FREQ / 4UL)) / 1000000UL))
+#define __delay_ms(x)               SIM_DelayCycles((uint32)(((uint64)(x) * (_XTAL_FREQ / 4UL)) / 1000UL))
+
+#define di()                        (INTCONbits.GIE = 0)
+#define ei()                        (INTCONbits.GIE = 1)
+
+#endif /* _SIM_COMPILER_H_ */
@@ -0,0 +1,60 @@
+/**
+ * @file SIM_Config.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Host Simulator Configuration
+ *
+ * Timing constants used by the peripheral models of the host simulator. All durations are expressed in
+ * instruction cycles (FOSC / 4), the same unit the simulator clock is kept in.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SIM_CONFIG_H_
+#define _SIM_CONFIG_H_
+
+#include "../MCAL/mcu_config.h"
+
+/**
+ * @brief Instruction cycles charged for every SFR access routed through `SIM_Access()`.
+ */
+#define SIM_CYCLES_PER_ACCESS                       1
+
+/**
+ * @brief Number of instruction cycles per second of simulated time.
+ */
+#define SIM_INSTRUCTION_FREQUENCY                   (FOSC / 4UL)
+
+/**
+ * @brief Granularity used when `__delay_ms()`/`__delay_us()` advance the simulated clock, interrupts are
+ *        serviced between two steps.
+ */
+#define SIM_DELAY_STEP_CYCLES                       32UL
+
+/**
+ * @brief Self-timed EEPROM write duration (4 ms typical on the PIC18F4620).
+ */
+#define SIM_EEPROM_WRITE_CYCLES                     (SIM_INSTRUCTION_FREQUENCY / 250UL)
+
+/**
+ * @brief Size of the data EEPROM of the PIC18F4620.
+ */
+#define SIM_EEPROM_SIZE                             1024
+
+/**
+ * @brief Duration of one ADC conversion TAD when the internal RC oscillator is selected.
+ */
+#define SIM_ADC_RC_TAD_CYCLES                       6UL
+
+/**
+ * @brief Number of ADC channels (AN0..AN12).
+ */
+#define SIM_ADC_CHANNELS                            13
+
+/**
+ * @brief Depth of the EUSART receive FIFO (RCREG plus one buffered frame).
+ */
+#define SIM_EUSART_RX_FIFO_SIZE                     2
+
+#endif /* _SIM_CONFIG_H_ */
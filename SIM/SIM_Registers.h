@@ -0,0 +1,386 @@
+/**
+ * @file SIM_Registers.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Simulated PIC18F4620 Special Function Register Map
+ *
+ * The `SIM_Registers.h` header file stands in for `pic18f4620.h` when the drivers are compiled for the host.
+ * It exposes the same register names and `XXXbits` bit-field views that XC8 provides, backed by the simulated
+ * register file in `SIM.c`.
+ *
+ * Every `XXXbits` view and every plain byte register goes through `SIM_Access()`, which counts the access,
+ * advances the simulated instruction clock and runs the peripheral models, exactly like an instruction
+ * touching the SFR on the real part. The GPIO driver builds constant pointer tables to `PORTx`, `LATx` and `TRISx`
+ * with SIM_ADDRESS() and accesses them with SIM_POINTED(), which goes through `SIM_Access()` as well.
+ *
+ * @note Only the registers and bits used by the drivers are described, the remaining SFRs still exist
+ *       in the register file and can be reached through `SIM_Access()`.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _SIM_REGISTERS_H_
+#define _SIM_REGISTERS_H_
+
+#include "SIM.h"
+
+#define SIM_PORTA_ADDRESS               0xF80
+#define SIM_PORTB_ADDRESS               0xF81
+#define SIM_PORTC_ADDRESS               0xF82
+#define SIM_PORTD_ADDRESS               0xF83
+#define SIM_PORTE_ADDRESS               0xF84
+#define SIM_LATA_ADDRESS                0xF89
+#define SIM_LATB_ADDRESS                0xF8A
+#define SIM_LATC_ADDRESS                0xF8B
+#define SIM_LATD_ADDRESS                0xF8C
+#define SIM_LATE_ADDRESS                0xF8D
+#define SIM_TRISA_ADDRESS               0xF92
+#define SIM_TRISB_ADDRESS               0xF93
+#define SIM_TRISC_ADDRESS               0xF94
+#define SIM_TRISD_ADDRESS               0xF95
+#define SIM_TRISE_ADDRESS               0xF96
+#define SIM_PIE1_ADDRESS                0xF9D
+#define SIM_PIR1_ADDRESS                0xF9E
+#define SIM_IPR1_ADDRESS                0xF9F
+#define SIM_PIE2_ADDRESS                0xFA0
+#define SIM_PIR2_ADDRESS                0xFA1
+#define SIM_IPR2_ADDRESS                0xFA2
+#define SIM_EECON1_ADDRESS              0xFA6
+#define SIM_EECON2_ADDRESS              0xFA7
+#define SIM_EEDATA_ADDRESS              0xFA8
+#define SIM_EEADR_ADDRESS               0xFA9
+#define SIM_EEADRH_ADDRESS              0xFAA
+#define SIM_RCSTA_ADDRESS               0xFAB
+#define SIM_TXSTA_ADDRESS               0xFAC
+#define SIM_TXREG_ADDRESS               0xFAD
+#define SIM_RCREG_ADDRESS               0xFAE
+#define SIM_SPBRG_ADDRESS               0xFAF
+#define SIM_SPBRGH_ADDRESS              0xFB0
+#define SIM_T3CON_ADDRESS               0xFB1
+#define SIM_TMR3L_ADDRESS               0xFB2
+#define SIM_TMR3H_ADDRESS               0xFB3
+#define SIM_BAUDCON_ADDRESS             0xFB8
+#define SIM_CCP2CON_ADDRESS             0xFBA
+#define SIM_CCPR2L_ADDRESS              0xFBB
+#define SIM_CCPR2H_ADDRESS              0xFBC
+#define SIM_CCP1CON_ADDRESS             0xFBD
+#define SIM_CCPR1L_ADDRESS              0xFBE
+#define SIM_CCPR1H_ADDRESS              0xFBF
+#define SIM_ADCON2_ADDRESS              0xFC0
+#define SIM_ADCON1_ADDRESS              0xFC1
+#define SIM_ADCON0_ADDRESS              0xFC2
+#define SIM_ADRESL_ADDRESS              0xFC3
+#define SIM_ADRESH_ADDRESS              0xFC4
+#define SIM_SSPCON2_ADDRESS             0xFC5
+#define SIM_SSPCON1_ADDRESS             0xFC6
+#define SIM_SSPSTAT_ADDRESS             0xFC7
+#define SIM_SSPADD_ADDRESS              0xFC8
+#define SIM_SSPBUF_ADDRESS              0xFC9
+#define SIM_T2CON_ADDRESS               0xFCA
+#define SIM_PR2_ADDRESS                 0xFCB
+#define SIM_TMR2_ADDRESS                0xFCC
+#define SIM_T1CON_ADDRESS               0xFCD
+#define SIM_TMR1L_ADDRESS               0xFCE
+#define SIM_TMR1H_ADDRESS               0xFCF
+#define SIM_RCON_ADDRESS                0xFD0
+#define SIM_T0CON_ADDRESS               0xFD5
+#define SIM_TMR0L_ADDRESS               0xFD6
+#define SIM_TMR0H_ADDRESS               0xFD7
+#define SIM_INTCON3_ADDRESS             0xFF0
+#define SIM_INTCON2_ADDRESS             0xFF1
+#define SIM_INTCON_ADDRESS              0xFF2
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          Bit-field views                                                           */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+#define SIM_PORT_BITS(x)                                                                                            \
+typedef union                                                                                                       \
+{                                                                                                                   \
+    struct { uint8 R##x##0:1; uint8 R##x##1:1; uint8 R##x##2:1; uint8 R##x##3:1;                                    \
+             uint8 R##x##4:1; uint8 R##x##5:1; uint8 R##x##6:1; uint8 R##x##7:1; };                                 \
+} SIM_PORT##x##bits_t;                                                                                              \
+typedef union                                                                                                       \
+{                                                                                                                   \
+    struct { uint8 LAT##x##0:1; uint8 LAT##x##1:1; uint8 LAT##x##2:1; uint8 LAT##x##3:1;                            \
+             uint8 LAT##x##4:1; uint8 LAT##x##5:1; uint8 LAT##x##6:1; uint8 LAT##x##7:1; };                         \
+} SIM_LAT##x##bits_t;                                                                                               \
+typedef union                                                                                                       \
+{                                                                                                                   \
+    struct { uint8 TRIS##x##0:1; uint8 TRIS##x##1:1; uint8 TRIS##x##2:1; uint8 TRIS##x##3:1;                        \
+             uint8 TRIS##x##4:1; uint8 TRIS##x##5:1; uint8 TRIS##x##6:1; uint8 TRIS##x##7:1; };                     \
+    struct { uint8 R##x##0:1; uint8 R##x##1:1; uint8 R##x##2:1; uint8 R##x##3:1;                                    \
+             uint8 R##x##4:1; uint8 R##x##5:1; uint8 R##x##6:1; uint8 R##x##7:1; };                                 \
+} SIM_TRIS##x##bits_t
+
+SIM_PORT_BITS(A);
+SIM_PORT_BITS(B);
+SIM_PORT_BITS(C);
+SIM_PORT_BITS(D);
+SIM_PORT_BITS(E);
+
+typedef union
+{
+    struct { uint8 RBIF:1; uint8 INT0IF:1; uint8 TMR0IF:1; uint8 RBIE:1; uint8 INT0IE:1; uint8 TMR0IE:1; uint8 PEIE:1; uint8 GIE:1; };
+    struct { uint8 :1; uint8 INT0F:1; uint8 T0IF:1; uint8 :1; uint8 INT0E:1; uint8 T0IE:1; uint8 GIEL:1; uint8 GIEH:1; };
+} SIM_INTCONbits_t;
+
+typedef union
+{
+    struct { uint8 RBIP:1; uint8 :1; uint8 TMR0IP:1; uint8 :1; uint8 INTEDG2:1; uint8 INTEDG1:1; uint8 INTEDG0:1; uint8 nRBPU:1; };
+    struct { uint8 :2; uint8 T0IP:1; uint8 :4; uint8 RBPU:1; };
+} SIM_INTCON2bits_t;
+
+typedef union
+{
+    struct { uint8 INT1IF:1; uint8 INT2IF:1; uint8 :1; uint8 INT1IE:1; uint8 INT2IE:1; uint8 :1; uint8 INT1IP:1; uint8 INT2IP:1; };
+    struct { uint8 INT1F:1; uint8 INT2F:1; uint8 :1; uint8 INT1E:1; uint8 INT2E:1; uint8 :1; uint8 INT1P:1; uint8 INT2P:1; };
+} SIM_INTCON3bits_t;
+
+typedef union
+{
+    struct { uint8 TMR1IF:1; uint8 TMR2IF:1; uint8 CCP1IF:1; uint8 SSPIF:1; uint8 TXIF:1; uint8 RCIF:1; uint8 ADIF:1; uint8 PSPIF:1; };
+} SIM_PIR1bits_t;
+
+typedef union
+{
+    struct { uint8 TMR1IE:1; uint8 TMR2IE:1; uint8 CCP1IE:1; uint8 SSPIE:1; uint8 TXIE:1; uint8 RCIE:1; uint8 ADIE:1; uint8 PSPIE:1; };
+} SIM_PIE1bits_t;
+
+typedef union
+{
+    struct { uint8 TMR1IP:1; uint8 TMR2IP:1; uint8 CCP1IP:1; uint8 SSPIP:1; uint8 TXIP:1; uint8 RCIP:1; uint8 ADIP:1; uint8 PSPIP:1; };
+} SIM_IPR1bits_t;
+
+typedef union
+{
+    struct { uint8 CCP2IF:1; uint8 TMR3IF:1; uint8 HLVDIF:1; uint8 BCLIF:1; uint8 EEIF:1; uint8 :1; uint8 CMIF:1; uint8 OSCFIF:1; };
+} SIM_PIR2bits_t;
+
+typedef union
+{
+    struct { uint8 CCP2IE:1; uint8 TMR3IE:1; uint8 HLVDIE:1; uint8 BCLIE:1; uint8 EEIE:1; uint8 :1; uint8 CMIE:1; uint8 OSCFIE:1; };
+} SIM_PIE2bits_t;
+
+typedef union
+{
+    struct { uint8 CCP2IP:1; uint8 TMR3IP:1; uint8 HLVDIP:1; uint8 BCLIP:1; uint8 EEIP:1; uint8 :1; uint8 CMIP:1; uint8 OSCFIP:1; };
+} SIM_IPR2bits_t;
+
+typedef union
+{
+    struct { uint8 nBOR:1; uint8 nPOR:1; uint8 nPD:1; uint8 nTO:1; uint8 nRI:1; uint8 :1; uint8 SBOREN:1; uint8 IPEN:1; };
+} SIM_RCONbits_t;
+
+typedef union
+{
+    struct { uint8 RD:1; uint8 WR:1; uint8 WREN:1; uint8 WRERR:1; uint8 FREE:1; uint8 :1; uint8 CFGS:1; uint8 EEPGD:1; };
+} SIM_EECON1bits_t;
+
+typedef union
+{
+    struct { uint8 RX9D:1; uint8 OERR:1; uint8 FERR:1; uint8 ADDEN:1; uint8 CREN:1; uint8 SREN:1; uint8 RX9:1; uint8 SPEN:1; };
+} SIM_RCSTAbits_t;
+
+typedef union
+{
+    struct { uint8 TX9D:1; uint8 TRMT:1; uint8 BRGH:1; uint8 SENDB:1; uint8 SYNC:1; uint8 TXEN:1; uint8 TX9:1; uint8 CSRC:1; };
+} SIM_TXSTAbits_t;
+
+typedef union
+{
+    struct { uint8 ABDEN:1; uint8 WUE:1; uint8 :1; uint8 BRG16:1; uint8 TXCKP:1; uint8 RXDTP:1; uint8 RCIDL:1; uint8 ABDOVF:1; };
+} SIM_BAUDCONbits_t;
+
+typedef union
+{
+    struct { uint8 T0PS:3; uint8 PSA:1; uint8 T0SE:1; uint8 T0CS:1; uint8 T08BIT:1; uint8 TMR0ON:1; };
+} SIM_T0CONbits_t;
+
+typedef union
+{
+    struct { uint8 TMR1ON:1; uint8 TMR1CS:1; uint8 nT1SYNC:1; uint8 T1OSCEN:1; uint8 T1CKPS:2; uint8 T1RUN:1; uint8 RD16:1; };
+} SIM_T1CONbits_t;
+
+typedef union
+{
+    struct { uint8 T2CKPS:2; uint8 TMR2ON:1; uint8 TOUTPS:4; uint8 :1; };
+} SIM_T2CONbits_t;
+
+typedef union
+{
+    struct { uint8 TMR3ON:1; uint8 TMR3CS:1; uint8 nT3SYNC:1; uint8 T3CCP1:1; uint8 T3CKPS:2; uint8 T3CCP2:1; uint8 RD16:1; };
+} SIM_T3CONbits_t;
+
+typedef union
+{
+    struct { uint8 CCP1M:4; uint8 DC1B:2; uint8 P1M:2; };
+} SIM_CCP1CONbits_t;
+
+typedef union
+{
+    struct { uint8 CCP2M:4; uint8 DC2B:2; uint8 :2; };
+} SIM_CCP2CONbits_t;
+
+typedef union
+{
+    struct { uint8 ADON:1; uint8 GO_nDONE:1; uint8 CHS:4; uint8 :2; };
+    struct { uint8 :1; uint8 GO:1; uint8 :6; };
+    struct { uint8 :1; uint8 GO_DONE:1; uint8 :6; };
+} SIM_ADCON0bits_t;
+
+typedef union
+{
+    struct { uint8 PCFG:4; uint8 VCFG:2; uint8 :2; };
+    struct { uint8 :4; uint8 VCFG0:1; uint8 VCFG1:1; uint8 :2; };
+} SIM_ADCON1bits_t;
+
+typedef union
+{
+    struct { uint8 ADCS:3; uint8 ACQT:3; uint8 :1; uint8 ADFM:1; };
+} SIM_ADCON2bits_t;
+
+typedef union
+{
+    struct { uint8 BF:1; uint8 UA:1; uint8 R_nW:1; uint8 S:1; uint8 P:1; uint8 D_nA:1; uint8 CKE:1; uint8 SMP:1; };
+} SIM_SSPSTATbits_t;
+
+typedef union
+{
+    struct { uint8 SSPM:4; uint8 CKP:1; uint8 SSPEN:1; uint8 SSPOV:1; uint8 WCOL:1; };
+} SIM_SSPCON1bits_t;
+
+typedef union
+{
+    struct { uint8 SEN:1; uint8 RSEN:1; uint8 PEN:1; uint8 RCEN:1; uint8 ACKEN:1; uint8 ACKDT:1; uint8 ACKSTAT:1; uint8 GCEN:1; };
+} SIM_SSPCON2bits_t;
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+/*                                          Register names                                                            */
+/* ----------------------------------------------------------------------------------------------------------------- */
+
+#define SIM_REGISTER(address)                           (*SIM_Access(address))
+#define SIM_BITS(type, address)                         (*(volatile type *)SIM_Access(address))
+#define SIM_ADDRESS(address)                            (&SIM_RegisterFile[(address) - SIM_SFR_BASE_ADDRESS])
+#define SIM_POINTED(pointer)                            \
+        (*SIM_Access((uint16)(SIM_SFR_BASE_ADDRESS + ((pointer) - SIM_RegisterFile))))
+
+#define PORTA                                           SIM_REGISTER(SIM_PORTA_ADDRESS)
+#define PORTB                                           SIM_REGISTER(SIM_PORTB_ADDRESS)
+#define PORTC                                           SIM_REGISTER(SIM_PORTC_ADDRESS)
+#define PORTD                                           SIM_REGISTER(SIM_PORTD_ADDRESS)
+#define PORTE                                           SIM_REGISTER(SIM_PORTE_ADDRESS)
+#define LATA                                            SIM_REGISTER(SIM_LATA_ADDRESS)
+#define LATB                                            SIM_REGISTER(SIM_LATB_ADDRESS)
+#define LATC                                            SIM_REGISTER(SIM_LATC_ADDRESS)
+#define LATD                                            SIM_REGISTER(SIM_LATD_ADDRESS)
+#define LATE                                            SIM_REGISTER(SIM_LATE_ADDRESS)
+#define TRISA                                           SIM_REGISTER(SIM_TRISA_ADDRESS)
+#define TRISB                                           SIM_REGISTER(SIM_TRISB_ADDRESS)
+#define TRISC                                           SIM_REGISTER(SIM_TRISC_ADDRESS)
+#define TRISD                                           SIM_REGISTER(SIM_TRISD_ADDRESS)
+#define TRISE                                           SIM_REGISTER(SIM_TRISE_ADDRESS)
+
+#define PORTAbits                                       SIM_BITS(SIM_PORTAbits_t, SIM_PORTA_ADDRESS)
+#define PORTBbits                                       SIM_BITS(SIM_PORTBbits_t, SIM_PORTB_ADDRESS)
+#define PORTCbits                                       SIM_BITS(SIM_PORTCbits_t, SIM_PORTC_ADDRESS)
+#define PORTDbits                                       SIM_BITS(SIM_PORTDbits_t, SIM_PORTD_ADDRESS)
+#define PORTEbits                                       SIM_BITS(SIM_PORTEbits_t, SIM_PORTE_ADDRESS)
+#define LATAbits                                        SIM_BITS(SIM_LATAbits_t, SIM_LATA_ADDRESS)
+#define LATBbits                                        SIM_BITS(SIM_LATBbits_t, SIM_LATB_ADDRESS)
+#define LATCbits                                        SIM_BITS(SIM_LATCbits_t, SIM_LATC_ADDRESS)
+#define LATDbits                                        SIM_BITS(SIM_LATDbits_t, SIM_LATD_ADDRESS)
+#define LATEbits                                        SIM_BITS(SIM_LATEbits_t, SIM_LATE_ADDRESS)
+#define TRISAbits                                       SIM_BITS(SIM_TRISAbits_t, SIM_TRISA_ADDRESS)
+#define TRISBbits                                       SIM_BITS(SIM_TRISBbits_t, SIM_TRISB_ADDRESS)
+#define TRISCbits                                       SIM_BITS(SIM_TRISCbits_t, SIM_TRISC_ADDRESS)
+#define TRISDbits                                       SIM_BITS(SIM_TRISDbits_t, SIM_TRISD_ADDRESS)
+#define TRISEbits                                       SIM_BITS(SIM_TRISEbits_t, SIM_TRISE_ADDRESS)
+
+#define PIE1                                            SIM_REGISTER(SIM_PIE1_ADDRESS)
+#define PIR1                                            SIM_REGISTER(SIM_PIR1_ADDRESS)
+#define IPR1                                            SIM_REGISTER(SIM_IPR1_ADDRESS)
+#define PIE2                                            SIM_REGISTER(SIM_PIE2_ADDRESS)
+#define PIR2                                            SIM_REGISTER(SIM_PIR2_ADDRESS)
+#define IPR2                                            SIM_REGISTER(SIM_IPR2_ADDRESS)
+#define PIE1bits                                        SIM_BITS(SIM_PIE1bits_t, SIM_PIE1_ADDRESS)
+#define PIR1bits                                        SIM_BITS(SIM_PIR1bits_t, SIM_PIR1_ADDRESS)
+#define IPR1bits                                        SIM_BITS(SIM_IPR1bits_t, SIM_IPR1_ADDRESS)
+#define PIE2bits                                        SIM_BITS(SIM_PIE2bits_t, SIM_PIE2_ADDRESS)
+#define PIR2bits                                        SIM_BITS(SIM_PIR2bits_t, SIM_PIR2_ADDRESS)
+#define IPR2bits                                        SIM_BITS(SIM_IPR2bits_t, SIM_IPR2_ADDRESS)
+
+#define EECON1                                          SIM_REGISTER(SIM_EECON1_ADDRESS)
+#define EECON1bits                                      SIM_BITS(SIM_EECON1bits_t, SIM_EECON1_ADDRESS)
+#define EECON2                                          SIM_REGISTER(SIM_EECON2_ADDRESS)
+#define EEDATA                                          SIM_REGISTER(SIM_EEDATA_ADDRESS)
+#define EEADR                                           SIM_REGISTER(SIM_EEADR_ADDRESS)
+#define EEADRH                                          SIM_REGISTER(SIM_EEADRH_ADDRESS)
+
+#define RCSTA                                           SIM_REGISTER(SIM_RCSTA_ADDRESS)
+#define RCSTAbits                                       SIM_BITS(SIM_RCSTAbits_t, SIM_RCSTA_ADDRESS)
+#define TXSTA                                           SIM_REGISTER(SIM_TXSTA_ADDRESS)
+#define TXSTAbits                                       SIM_BITS(SIM_TXSTAbits_t, SIM_TXSTA_ADDRESS)
+#define TXSTA1bits                                      SIM_BITS(SIM_TXSTAbits_t, SIM_TXSTA_ADDRESS)
+#define TXREG                                           SIM_REGISTER(SIM_TXREG_ADDRESS)
+#define RCREG                                           SIM_REGISTER(SIM_RCREG_ADDRESS)
+#define SPBRG                                           SIM_REGISTER(SIM_SPBRG_ADDRESS)
+#define SPBRGH                                          SIM_REGISTER(SIM_SPBRGH_ADDRESS)
+#define BAUDCON                                         SIM_REGISTER(SIM_BAUDCON_ADDRESS)
+#define BAUDCONbits                                     SIM_BITS(SIM_BAUDCONbits_t, SIM_BAUDCON_ADDRESS)
+
+#define T0CON                                           SIM_REGISTER(SIM_T0CON_ADDRESS)
+#define T0CONbits                                       SIM_BITS(SIM_T0CONbits_t, SIM_T0CON_ADDRESS)
+#define TMR0L                                           SIM_REGISTER(SIM_TMR0L_ADDRESS)
+#define TMR0H                                           SIM_REGISTER(SIM_TMR0H_ADDRESS)
+#define T1CON                                           SIM_REGISTER(SIM_T1CON_ADDRESS)
+#define T1CONbits                                       SIM_BITS(SIM_T1CONbits_t, SIM_T1CON_ADDRESS)
+#define TMR1L                                           SIM_REGISTER(SIM_TMR1L_ADDRESS)
+#define TMR1H                                           SIM_REGISTER(SIM_TMR1H_ADDRESS)
+#define T2CON                                           SIM_REGISTER(SIM_T2CON_ADDRESS)
+#define T2CONbits                                       SIM_BITS(SIM_T2CONbits_t, SIM_T2CON_ADDRESS)
+#define TMR2                                            SIM_REGISTER(SIM_TMR2_ADDRESS)
+#define PR2                                             SIM_REGISTER(SIM_PR2_ADDRESS)
+#define T3CON                                           SIM_REGISTER(SIM_T3CON_ADDRESS)
+#define T3CONbits                                       SIM_BITS(SIM_T3CONbits_t, SIM_T3CON_ADDRESS)
+#define TMR3L                                           SIM_REGISTER(SIM_TMR3L_ADDRESS)
+#define TMR3H                                           SIM_REGISTER(SIM_TMR3H_ADDRESS)
+
+#define CCP1CON                                         SIM_REGISTER(SIM_CCP1CON_ADDRESS)
+#define CCP1CONbits                                     SIM_BITS(SIM_CCP1CONbits_t, SIM_CCP1CON_ADDRESS)
+#define CCPR1L                                          SIM_REGISTER(SIM_CCPR1L_ADDRESS)
+#define CCPR1H                                          SIM_REGISTER(SIM_CCPR1H_ADDRESS)
+#define CCP2CON                                         SIM_REGISTER(SIM_CCP2CON_ADDRESS)
+#define CCP2CONbits                                     SIM_BITS(SIM_CCP2CONbits_t, SIM_CCP2CON_ADDRESS)
+#define CCPR2L                                          SIM_REGISTER(SIM_CCPR2L_ADDRESS)
+#define CCPR2H                                          SIM_REGISTER(SIM_CCPR2H_ADDRESS)
+
+#define ADCON0                                          SIM_REGISTER(SIM_ADCON0_ADDRESS)
+#define ADCON0bits                                      SIM_BITS(SIM_ADCON0bits_t, SIM_ADCON0_ADDRESS)
+#define ADCON1                                          SIM_REGISTER(SIM_ADCON1_ADDRESS)
+#define ADCON1bits                                      SIM_BITS(SIM_ADCON1bits_t, SIM_ADCON1_ADDRESS)
+#define ADCON2                                          SIM_REGISTER(SIM_ADCON2_ADDRESS)
+#define ADCON2bits                                      SIM_BITS(SIM_ADCON2bits_t, SIM_ADCON2_ADDRESS)
+#define ADRESL                                          SIM_REGISTER(SIM_ADRESL_ADDRESS)
+#define ADRESH                                          SIM_REGISTER(SIM_ADRESH_ADDRESS)
+
+#define SSPSTAT                                         SIM_REGISTER(SIM_SSPSTAT_ADDRESS)
+#define SSPSTATbits                                     SIM_BITS(SIM_SSPSTATbits_t, SIM_SSPSTAT_ADDRESS)
+#define SSPCON1                                         SIM_REGISTER(SIM_SSPCON1_ADDRESS)
+#define SSPCON1bits                                     SIM_BITS(SIM_SSPCON1bits_t, SIM_SSPCON1_ADDRESS)
+#define SSPCON2                                         SIM_REGISTER(SIM_SSPCON2_ADDRESS)
+#define SSPCON2bits                                     SIM_BITS(SIM_SSPCON2bits_t, SIM_SSPCON2_ADDRESS)
+#define SSPADD                                          SIM_REGISTER(SIM_SSPADD_ADDRESS)
+#define SSPBUF                                          (*SIM_AccessBuffer(SIM_SSPBUF_ADDRESS))
+
+#define RCON                                            SIM_REGISTER(SIM_RCON_ADDRESS)
+#define RCONbits                                        SIM_BITS(SIM_RCONbits_t, SIM_RCON_ADDRESS)
+#define INTCON                                          SIM_REGISTER(SIM_INTCON_ADDRESS)
+#define INTCONbits                                      SIM_BITS(SIM_INTCONbits_t, SIM_INTCON_ADDRESS)
+#define INTCON2                                         SIM_REGISTER(SIM_INTCON2_ADDRESS)
+#define INTCON2bits                                     SIM_BITS(SIM_INTCON2bits_t, SIM_INTCON2_ADDRESS)
+#define INTCON3                                         SIM_REGISTER(SIM_INTCON3_ADDRESS)
+#define INTCON3bits                                     SIM_BITS(SIM_INTCON3bits_t, SIM_INTCON3_ADDRESS)
+
+#endif /* _SIM_REGISTERS_H_ */
@@ -0,0 +1,55 @@
+/**
+ * @file TEST.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#include <stdio.h>
+
+static uint16 TEST_Cases = 0;
+static uint16 TEST_FailedCases = 0;
+static uint16 TEST_CaseFailures = 0;
+
+void TEST_Run(const char * const Name, void (* const Case)(void))
+{
+    SIM_Reset();
+
+#if (INTERRUPTS_PRIORITY_FEATURE == STD_ON)
+    SIM_SetInterruptVectors(HighPriorityInterruptHandler, LowPriorityInterruptHandler);
+#else
+    SIM_SetInterruptVectors(InterruptHandler, NULL_PTR);
+#endif
+
+    INTI_EnableInterrupts();
+
+    TEST_CaseFailures = 0;
+    Case();
+
+    TEST_Cases++;
+
+    if (0 != TEST_CaseFailures)
+    {
+        TEST_FailedCases++;
+    }
+
+    printf("%s %s\n", (0 == TEST_CaseFailures) ? "PASS" : "FAIL", Name);
+}
+
+void TEST_Check(const boolean Condition, const char * const Description)
+{
+    if (FALSE == Condition)
+    {
+        TEST_CaseFailures++;
+        printf("     failed: %s\n", Description);
+    }
+}
+
+int TEST_Summary(void)
+{
+    printf("%u of %u cases failed\n", (unsigned)TEST_FailedCases, (unsigned)TEST_Cases);
+
+    return (0 == TEST_FailedCases) ? 0 : 1;
+}
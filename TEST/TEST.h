@@ -0,0 +1,45 @@
+/**
+ * @file TEST.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Host Driver Tests
+ *
+ * Every TEST/TEST_*.c file is a test program run by `make test` on the host simulator. The drivers are built for
+ * each program with the configuration the Makefile gives it (TEST_<name>_DEFINES), on top of the default one. A
+ * program runs its cases one after the other, each from a freshly reset simulator with the interrupt vectors
+ * installed, prints the checks that failed and exits with a non-zero status if any did.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include "../APP/app.h"
+#include "../MCAL/Interrupts/Interrupts_Handler.h"
+
+/**
+ * @brief Runs a test case from a reset simulator, with the global interrupts enabled.
+ *
+ * @param Name Name of the case, printed with its result.
+ * @param Case Function running the checks of the case.
+ */
+void TEST_Run(const char * const Name, void (* const Case)(void));
+
+/**
+ * @brief Checks a condition of the running test case, a failed check is printed and fails the case.
+ *
+ * @param Condition Condition expected to hold.
+ * @param Description What is checked, printed when @param Condition does not hold.
+ */
+void TEST_Check(const boolean Condition, const char * const Description);
+
+/**
+ * @brief Prints the number of failed cases of the program.
+ *
+ * @return int Exit status of the program, 0 if every case passed.
+ */
+int TEST_Summary(void);
+
+#endif /* _TEST_H_ */
@@ -0,0 +1,170 @@
+/**
+ * @file TEST_CCP1_Capture.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the CCP1 capture engine, built with CCP1 in capture mode.
+ *
+ * The input is driven on RC2 at fixed cycle counts. An interrupt serviced at the end of a delay makes an edge a few
+ * cycles late, so the measurements are checked to a TIME tick, a missed overflow would be 65536 ticks off.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_PORTC                          2
+#define TEST_CCP1_PIN                       0x04
+#define TEST_CYCLES_PER_TICK                ((FOSC / 4UL) / TIME_TICKS_PER_SECOND)
+
+static CCP1_InitTypeDef TEST_Ccp1 = {
+    .Mode = CPP1_MODE_CAPTURE_EVERY_RISING_EDGE,
+    .CCPxTIMERx = CCPx_TIMER1_FOR_CCPx,
+    .InterruptHandler = NULL_PTR
+};
+
+static uint32 TEST_NextEdge = 0;
+
+static boolean TEST_Near(const uint32 Value, const uint32 Expected);
+static void TEST_Setup(const CCP1_ModeTypeDef Mode);
+static void TEST_Wave(const uint32 PeriodTicks, const uint32 HighTicks, const uint16 Periods);
+
+static void TEST_PeriodAcrossOverflows(void);
+static void TEST_PeriodLongerThanTimer(void);
+static void TEST_PulseWidth(void);
+static void TEST_Every16thRisingEdge(void);
+static void TEST_Stop(void);
+
+int main(void)
+{
+    TEST_Run("capture period across TIMER1 overflows", TEST_PeriodAcrossOverflows);
+    TEST_Run("capture period longer than a TIMER1 period", TEST_PeriodLongerThanTimer);
+    TEST_Run("capture pulse width", TEST_PulseWidth);
+    TEST_Run("capture every 16th rising edge", TEST_Every16thRisingEdge);
+    TEST_Run("capture stop", TEST_Stop);
+
+    return TEST_Summary();
+}
+
+static boolean TEST_Near(const uint32 Value, const uint32 Expected)
+{
+    return ((Value + 1) >= Expected) && (Value <= (Expected + 1));
+}
+
+static void TEST_Setup(const CCP1_ModeTypeDef Mode)
+{
+    TEST_Ccp1.Mode = Mode;
+
+    TEST_Check(E_OK == TIME_Init(), "TIME_Init");
+    TEST_Check(E_OK == CCP1_Init(&TEST_Ccp1), "CCP1_Init");
+
+    (void)SIM_SetPortInput(TEST_PORTC, 0x00);
+    TEST_NextEdge = SIM_GetCycleCount() + 1000;
+}
+
+/* Rising edge every PeriodTicks, falling edge HighTicks later */
+static void TEST_Wave(const uint32 PeriodTicks, const uint32 HighTicks, const uint16 Periods)
+{
+    uint16 loc_period = 0;
+
+    for (loc_period = 0; loc_period < Periods; loc_period++)
+    {
+        SIM_DelayCycles(TEST_NextEdge - SIM_GetCycleCount());
+        (void)SIM_SetPortInput(TEST_PORTC, TEST_CCP1_PIN);
+
+        SIM_DelayCycles((TEST_NextEdge + (HighTicks * TEST_CYCLES_PER_TICK)) - SIM_GetCycleCount());
+        (void)SIM_SetPortInput(TEST_PORTC, 0x00);
+
+        TEST_NextEdge += PeriodTicks * TEST_CYCLES_PER_TICK;
+    }
+}
+
+static void TEST_PeriodAcrossOverflows(void)
+{
+    uint32 loc_period = 0;
+    uint32 loc_frequency = 0;
+
+    TEST_Setup(CPP1_MODE_CAPTURE_EVERY_RISING_EDGE);
+    TEST_Check(E_OK == CCP1_Capture_Start(&TEST_Ccp1, CCP1_CAPTURE_PERIOD), "CCP1_Capture_Start");
+    TEST_Check(E_NOT_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "no period before the second edge");
+
+    // 3000 ticks per period, the 16-bit capture wraps every 22 periods.
+    TEST_Wave(3000, 1000, 100);
+
+    TEST_Check(E_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "CCP1_Capture_GetPeriod");
+    TEST_Check(TEST_Near(loc_period, 3000), "period of 3000 ticks");
+    TEST_Check(E_OK == CCP1_Capture_GetFrequency(&TEST_Ccp1, &loc_frequency), "CCP1_Capture_GetFrequency");
+    TEST_Check((0 != loc_period) && (((TIME_TICKS_PER_SECOND * 1000UL) / loc_period) == loc_frequency),
+               "frequency of the period");
+    TEST_Check(E_NOT_OK == CCP1_Capture_GetPulseWidth(&TEST_Ccp1, &loc_period), "no pulse width measured");
+}
+
+static void TEST_PeriodLongerThanTimer(void)
+{
+    uint32 loc_period = 0;
+
+    TEST_Setup(CPP1_MODE_CAPTURE_EVERY_RISING_EDGE);
+    TEST_Check(E_OK == CCP1_Capture_Start(&TEST_Ccp1, CCP1_CAPTURE_PERIOD), "CCP1_Capture_Start");
+
+    // Every capture lands on another 16-bit wrap than the previous one.
+    TEST_Wave(100000, 50000, 5);
+
+    TEST_Check(E_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "CCP1_Capture_GetPeriod");
+    TEST_Check(TEST_Near(loc_period, 100000), "period of 100000 ticks");
+}
+
+static void TEST_PulseWidth(void)
+{
+    uint32 loc_period = 0;
+    uint32 loc_width = 0;
+
+    TEST_Setup(CPP1_MODE_CAPTURE_EVERY_RISING_EDGE);
+    TEST_Check(E_OK == CCP1_Capture_Start(&TEST_Ccp1, CCP1_CAPTURE_PULSE_WIDTH), "CCP1_Capture_Start");
+
+    TEST_Wave(2000, 500, 80);
+
+    TEST_Check(E_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "CCP1_Capture_GetPeriod");
+    TEST_Check(TEST_Near(loc_period, 2000), "period of 2000 ticks");
+    TEST_Check(E_OK == CCP1_Capture_GetPulseWidth(&TEST_Ccp1, &loc_width), "CCP1_Capture_GetPulseWidth");
+    TEST_Check(TEST_Near(loc_width, 500), "pulse width of 500 ticks");
+}
+
+static void TEST_Every16thRisingEdge(void)
+{
+    uint32 loc_period = 0;
+
+    TEST_Setup(CPP1_MODE_CAPTURE_EVERY_16th_RISING_EDGE);
+    TEST_Check(E_OK == CCP1_Capture_Start(&TEST_Ccp1, CCP1_CAPTURE_PERIOD), "CCP1_Capture_Start");
+
+    // 16 input periods of 5000 ticks per capture, 80000 ticks between captures.
+    TEST_Wave(5000, 2500, 16 * 6);
+
+    TEST_Check(E_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "CCP1_Capture_GetPeriod");
+    TEST_Check(TEST_Near(loc_period, 5000), "input period of 5000 ticks");
+}
+
+static void TEST_Stop(void)
+{
+    uint32 loc_period = 0;
+
+    TEST_Setup(CPP1_MODE_CAPTURE_EVERY_RISING_EDGE);
+    TEST_Check(E_OK == CCP1_Capture_Start(&TEST_Ccp1, CCP1_CAPTURE_PERIOD), "CCP1_Capture_Start");
+
+    TEST_Wave(1000, 500, 10);
+
+    // A capture latched while the interrupts are off must not be serviced after the stop.
+    INTI_DisableInterrupts();
+    TEST_Wave(1000, 500, 1);
+    TEST_Check(1 == PIR1bits.CCP1IF, "capture latched with the interrupts off");
+
+    TEST_Check(E_OK == CCP1_Capture_Stop(&TEST_Ccp1), "CCP1_Capture_Stop");
+    TEST_Check(0 == PIE1bits.CCP1IE, "CCP1 interrupt disabled");
+    TEST_Check(0 == PIR1bits.CCP1IF, "CCP1 flag cleared");
+    INTI_EnableInterrupts();
+
+    TEST_Wave(3000, 500, 10);
+
+    TEST_Check(0 == PIR1bits.CCP1IF, "no capture once stopped");
+    TEST_Check(E_OK == CCP1_Capture_GetPeriod(&TEST_Ccp1, &loc_period), "measurements readable once stopped");
+    TEST_Check(TEST_Near(loc_period, 1000), "period measured before the stop");
+}
@@ -0,0 +1,253 @@
+/**
+ * @file TEST_CCP1_Scheduler.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the CCP1 compare event scheduler, built with CCP1 in compare mode.
+ *
+ * Every callback records when it ran and the level of RC2. A callback runs from the CCP1 interrupt, within
+ * TEST_LATENCY_TICKS of the match.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_EVENTS                         16
+#define TEST_LATENCY_TICKS                  200UL
+#define TEST_CYCLES_PER_TICK                ((FOSC / 4UL) / TIME_TICKS_PER_SECOND)
+
+typedef struct
+{
+    uint8 Id;
+    uint32 Time;
+    uint8 Level;
+
+} TEST_EventTypeDef;
+
+static CCP1_InitTypeDef TEST_Ccp1 = {
+    .Mode = CCP1_MODE_GENERATE_SW_INTERRUPT_ON_MATCH,
+    .CCPxTIMERx = CCPx_TIMER1_FOR_CCPx,
+    .InterruptHandler = NULL_PTR
+};
+
+static TEST_EventTypeDef TEST_Events[TEST_EVENTS];
+static uint8 TEST_EventCount = 0;
+static uint8 TEST_TrainPulses = 0;
+
+static void TEST_Setup(void);
+static void TEST_WaitTicks(const uint32 Ticks);
+static boolean TEST_RanAt(const uint8 Event, const uint8 Id, const uint32 Time);
+static void TEST_Record(const uint8 Id);
+static void TEST_CallbackA(void);
+static void TEST_CallbackB(void);
+static void TEST_CallbackC(void);
+static void TEST_CallbackTrain(void);
+
+static void TEST_Ordering(void);
+static void TEST_BeyondTimerPeriod(void);
+static void TEST_LateEvents(void);
+static void TEST_QueueFullAndStop(void);
+static void TEST_PulseTrain(void);
+
+int main(void)
+{
+    TEST_Run("scheduler runs the events in time order", TEST_Ordering);
+    TEST_Run("scheduler event further than a TIMER1 period", TEST_BeyondTimerPeriod);
+    TEST_Run("scheduler late and close events", TEST_LateEvents);
+    TEST_Run("scheduler full queue and stop", TEST_QueueFullAndStop);
+    TEST_Run("scheduler callbacks queue the next events", TEST_PulseTrain);
+
+    return TEST_Summary();
+}
+
+static void TEST_Setup(void)
+{
+    TEST_EventCount = 0;
+    TEST_TrainPulses = 0;
+
+    TEST_Check(E_OK == TIME_Init(), "TIME_Init");
+    TEST_Check(E_OK == CCP1_Init(&TEST_Ccp1), "CCP1_Init");
+    TEST_Check(E_OK == CCP1_Scheduler_Start(&TEST_Ccp1), "CCP1_Scheduler_Start");
+}
+
+static void TEST_WaitTicks(const uint32 Ticks)
+{
+    SIM_DelayCycles(Ticks * TEST_CYCLES_PER_TICK);
+}
+
+/* The Event-th callback was Id, run at Time or within the interrupt latency after it */
+static boolean TEST_RanAt(const uint8 Event, const uint8 Id, const uint32 Time)
+{
+    return (Event < TEST_EventCount) && (Id == TEST_Events[Event].Id) &&
+           ((sint32)(TEST_Events[Event].Time - Time) >= 0) &&
+           ((TEST_Events[Event].Time - Time) <= TEST_LATENCY_TICKS);
+}
+
+static void TEST_Record(const uint8 Id)
+{
+    if (TEST_EventCount < TEST_EVENTS)
+    {
+        TEST_Events[TEST_EventCount].Id = Id;
+        TEST_Events[TEST_EventCount].Time = TIME_GetTicks32();
+        TEST_Events[TEST_EventCount].Level = LATCbits.LATC2;
+        TEST_EventCount++;
+    }
+}
+
+static void TEST_CallbackA(void)
+{
+    TEST_Record('A');
+}
+
+static void TEST_CallbackB(void)
+{
+    TEST_Record('B');
+}
+
+static void TEST_CallbackC(void)
+{
+    TEST_Record('C');
+}
+
+static void TEST_CallbackTrain(void)
+{
+    TEST_Record('T');
+
+    if (++TEST_TrainPulses < 10)
+    {
+        (void)CCP1_Scheduler_AddEvent(&TEST_Ccp1, TIME_GetTicks32() + 1000, CCP1_EVENT_TOGGLE, TEST_CallbackTrain);
+    }
+}
+
+static void TEST_Ordering(void)
+{
+    uint32 loc_now = 0;
+    uint8 loc_pending = 0;
+
+    TEST_Setup();
+    loc_now = TIME_GetTicks32();
+
+    // Queued out of order, the last one armed ahead of the others.
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 3000, CCP1_EVENT_SET_HIGH, TEST_CallbackA),
+               "add A at +3000");
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 2000, CCP1_EVENT_SET_LOW, TEST_CallbackC),
+               "add C at +2000");
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 1000, CCP1_EVENT_TOGGLE, TEST_CallbackB),
+               "add B at +1000");
+    TEST_Check((E_OK == CCP1_Scheduler_GetPendingEvents(&TEST_Ccp1, &loc_pending)) && (3 == loc_pending),
+               "3 pending events");
+
+    TEST_WaitTicks(4000);
+
+    TEST_Check(3 == TEST_EventCount, "3 callbacks");
+    TEST_Check(TEST_RanAt(0, 'B', loc_now + 1000), "B first, at +1000");
+    TEST_Check(TEST_RanAt(1, 'C', loc_now + 2000), "C second, at +2000");
+    TEST_Check(TEST_RanAt(2, 'A', loc_now + 3000), "A last, at +3000");
+    TEST_Check((1 == TEST_Events[0].Level) && (0 == TEST_Events[1].Level) && (1 == TEST_Events[2].Level),
+               "RC2 toggled high, set low, set high");
+    TEST_Check((E_OK == CCP1_Scheduler_GetPendingEvents(&TEST_Ccp1, &loc_pending)) && (0 == loc_pending),
+               "no pending event left");
+}
+
+static void TEST_BeyondTimerPeriod(void)
+{
+    uint32 loc_now = 0;
+
+    TEST_Setup();
+    loc_now = TIME_GetTicks32();
+
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 200000, CCP1_EVENT_SET_HIGH, TEST_CallbackA),
+               "add A at +200000");
+
+    TEST_WaitTicks(199000);
+    TEST_Check(0 == TEST_EventCount, "no callback on the intermediate matches");
+    TEST_Check(0 == LATCbits.LATC2, "RC2 still low");
+
+    TEST_WaitTicks(2000);
+    TEST_Check(TEST_RanAt(0, 'A', loc_now + 200000), "A at +200000");
+    TEST_Check(1 == LATCbits.LATC2, "RC2 set high");
+}
+
+static void TEST_LateEvents(void)
+{
+    uint32 loc_now = 0;
+
+    TEST_Setup();
+    loc_now = TIME_GetTicks32();
+
+    TEST_Check(E_NOT_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now - 10, CCP1_EVENT_SET_HIGH, TEST_CallbackA),
+               "event in the past rejected");
+    TEST_Check(E_NOT_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now, CCP1_EVENT_SET_HIGH, TEST_CallbackA),
+               "event now rejected");
+
+    // Both closer than the minimum lead, A to the time it is armed, B to A which is armed already.
+    loc_now = TIME_GetTicks32();
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 5, CCP1_EVENT_SET_HIGH, TEST_CallbackA),
+               "add A at +5");
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, TIME_GetTicks32() + 5, CCP1_EVENT_SET_LOW,
+                                               TEST_CallbackB), "add B at +5, before A is due");
+
+    TEST_WaitTicks(1000);
+
+    TEST_Check(2 == TEST_EventCount, "2 callbacks");
+    TEST_Check(TEST_RanAt(0, 'A', loc_now + CCPx_SCHEDULER_MIN_LEAD_TICKS), "A delayed to the minimum lead");
+    TEST_Check((2 == TEST_EventCount) &&
+               ((TEST_Events[1].Time - TEST_Events[0].Time) >= CCPx_SCHEDULER_MIN_LEAD_TICKS),
+               "B delayed to the minimum lead after A");
+    TEST_Check((1 == TEST_Events[0].Level) && (0 == TEST_Events[1].Level), "RC2 set high then low");
+}
+
+static void TEST_QueueFullAndStop(void)
+{
+    uint32 loc_now = 0;
+    uint8 loc_event = 0;
+    uint8 loc_pending = 0;
+    Std_ReturnType loc_ret = E_OK;
+
+    TEST_Setup();
+    loc_now = TIME_GetTicks32();
+
+    for (loc_event = 0; loc_event < CCPx_SCHEDULER_QUEUE_SIZE; loc_event++)
+    {
+        loc_ret |= CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 1000 + (loc_event * 100UL), CCP1_EVENT_TOGGLE,
+                                           TEST_CallbackA);
+    }
+
+    TEST_Check(E_OK == loc_ret, "queue filled");
+    TEST_Check(E_NOT_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, loc_now + 5000, CCP1_EVENT_TOGGLE, TEST_CallbackA),
+               "event rejected by the full queue");
+
+    TEST_Check(E_OK == CCP1_Scheduler_Stop(&TEST_Ccp1), "CCP1_Scheduler_Stop");
+    TEST_Check((E_OK == CCP1_Scheduler_GetPendingEvents(&TEST_Ccp1, &loc_pending)) && (0 == loc_pending),
+               "pending events dropped");
+
+    TEST_WaitTicks(3000);
+    TEST_Check(0 == TEST_EventCount, "no callback once stopped");
+    TEST_Check(E_NOT_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, TIME_GetTicks32() + 1000, CCP1_EVENT_TOGGLE,
+                                                   TEST_CallbackA), "event rejected once stopped");
+}
+
+static void TEST_PulseTrain(void)
+{
+    uint8 loc_event = 0;
+    boolean loc_spaced = TRUE;
+    boolean loc_toggled = TRUE;
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == CCP1_Scheduler_AddEvent(&TEST_Ccp1, TIME_GetTicks32() + 1000, CCP1_EVENT_TOGGLE,
+                                               TEST_CallbackTrain), "add the first pulse edge");
+
+    TEST_WaitTicks(12000);
+
+    for (loc_event = 1; loc_event < TEST_EventCount; loc_event++)
+    {
+        loc_spaced &= ((TEST_Events[loc_event].Time - TEST_Events[loc_event - 1].Time) >= 1000);
+        loc_toggled &= (TEST_Events[loc_event].Level != TEST_Events[loc_event - 1].Level);
+    }
+
+    TEST_Check(10 == TEST_EventCount, "10 pulse edges");
+    TEST_Check(loc_spaced, "edges at least 1000 ticks apart");
+    TEST_Check(loc_toggled, "RC2 toggled on every edge");
+}
@@ -0,0 +1,176 @@
+/**
+ * @file TEST_FORMAT.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the number formatting library, built with the default configuration.
+ *
+ * Every check formats into a buffer filled with TEST_FILL beforehand, and compares the string, its NUL terminator
+ * and the length returned.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_FILL                           '#'
+#define TEST_Q8(Integer)                    ((sint32)(Integer) << 8)
+#define TEST_Q16(Integer)                   ((sint32)(Integer) << 16)
+
+static uint8 TEST_Buffer[FORMAT_BUFFER_SIZE];
+static uint8 TEST_Length = 0;
+
+static uint8 * TEST_Clear(void);
+static boolean TEST_Is(const Std_ReturnType Status, const char * const Expected);
+
+static void TEST_DigitsAcrossWidths(void);
+static void TEST_Limits(void);
+static void TEST_SignAndPadding(void);
+static void TEST_FixedRounding(void);
+static void TEST_FixedNegativeZero(void);
+static void TEST_InvalidParameters(void);
+
+int main(void)
+{
+    TEST_Run("FORMAT digits around the 16-bit and 32-bit conversions", TEST_DigitsAcrossWidths);
+    TEST_Run("FORMAT limits of the integer types", TEST_Limits);
+    TEST_Run("FORMAT sign placement with the padding", TEST_SignAndPadding);
+    TEST_Run("FORMAT fixed-point rounding carried into the integer part", TEST_FixedRounding);
+    TEST_Run("FORMAT fixed-point negative rounded to zero", TEST_FixedNegativeZero);
+    TEST_Run("FORMAT invalid parameters", TEST_InvalidParameters);
+
+    return TEST_Summary();
+}
+
+static uint8 * TEST_Clear(void)
+{
+    uint8 loc_index = 0;
+
+    for (loc_index = 0; loc_index < FORMAT_BUFFER_SIZE; loc_index++)
+    {
+        TEST_Buffer[loc_index] = TEST_FILL;
+    }
+
+    TEST_Length = 0xFF;
+
+    return TEST_Buffer;
+}
+
+/* The last formatting succeeded and left exactly Expected, NUL-terminated, in the buffer */
+static boolean TEST_Is(const Std_ReturnType Status, const char * const Expected)
+{
+    boolean loc_same = (E_OK == Status) ? TRUE : FALSE;
+    uint8 loc_index = 0;
+
+    for (loc_index = 0; (TRUE == loc_same) && ('\0' != Expected[loc_index]); loc_index++)
+    {
+        loc_same = ((uint8)Expected[loc_index] == TEST_Buffer[loc_index]) ? TRUE : FALSE;
+    }
+
+    return loc_same && ('\0' == TEST_Buffer[loc_index]) && (loc_index == TEST_Length);
+}
+
+static void TEST_DigitsAcrossWidths(void)
+{
+    // FORMAT_Digits32 hands the values below 10000 to the 16-bit conversion, and keeps the inner zeros above.
+    TEST_Check(TEST_Is(FORMAT_Uint32(0, 0, ' ', TEST_Clear(), &TEST_Length), "0"), "0");
+    TEST_Check(TEST_Is(FORMAT_Uint32(7, 0, ' ', TEST_Clear(), &TEST_Length), "7"), "7");
+    TEST_Check(TEST_Is(FORMAT_Uint32(9999, 0, ' ', TEST_Clear(), &TEST_Length), "9999"), "9999");
+    TEST_Check(TEST_Is(FORMAT_Uint32(10000, 0, ' ', TEST_Clear(), &TEST_Length), "10000"), "10000");
+    TEST_Check(TEST_Is(FORMAT_Uint32(10001, 0, ' ', TEST_Clear(), &TEST_Length), "10001"), "10001");
+    TEST_Check(TEST_Is(FORMAT_Uint32(65536, 0, ' ', TEST_Clear(), &TEST_Length), "65536"), "65536");
+    TEST_Check(TEST_Is(FORMAT_Uint32(100005UL, 0, ' ', TEST_Clear(), &TEST_Length), "100005"), "100005");
+    TEST_Check(TEST_Is(FORMAT_Uint32(1000000000UL, 0, ' ', TEST_Clear(), &TEST_Length), "1000000000"),
+               "1000000000");
+
+    TEST_Check(TEST_Is(FORMAT_Uint16(10000, 0, ' ', TEST_Clear(), &TEST_Length), "10000"), "16-bit 10000");
+    TEST_Check(TEST_Is(FORMAT_Uint16(909, 0, ' ', TEST_Clear(), &TEST_Length), "909"), "16-bit 909");
+    TEST_Check(TEST_Is(FORMAT_Uint8(100, 0, ' ', TEST_Clear(), &TEST_Length), "100"), "8-bit 100");
+    TEST_Check(TEST_Is(FORMAT_Uint8(10, 0, ' ', TEST_Clear(), &TEST_Length), "10"), "8-bit 10");
+}
+
+static void TEST_Limits(void)
+{
+    TEST_Check(TEST_Is(FORMAT_Uint32(4294967295UL, 0, ' ', TEST_Clear(), &TEST_Length), "4294967295"),
+               "largest uint32");
+    TEST_Check(TEST_Is(FORMAT_Sint32((-2147483647L - 1L), 0, ' ', TEST_Clear(), &TEST_Length), "-2147483648"),
+               "smallest sint32");
+    TEST_Check(TEST_Is(FORMAT_Sint32(2147483647L, 0, ' ', TEST_Clear(), &TEST_Length), "2147483647"),
+               "largest sint32");
+    TEST_Check(TEST_Is(FORMAT_Uint16(65535U, 0, ' ', TEST_Clear(), &TEST_Length), "65535"), "largest uint16");
+    TEST_Check(TEST_Is(FORMAT_Sint16((-32767 - 1), 0, ' ', TEST_Clear(), &TEST_Length), "-32768"),
+               "smallest sint16");
+    TEST_Check(TEST_Is(FORMAT_Uint8(255, 0, ' ', TEST_Clear(), &TEST_Length), "255"), "largest uint8");
+    TEST_Check(TEST_Is(FORMAT_Sint8((-127 - 1), 0, ' ', TEST_Clear(), &TEST_Length), "-128"), "smallest sint8");
+    TEST_Check(TEST_Is(FORMAT_Hex(0xDEADBEEFUL, 8, TEST_Clear(), &TEST_Length), "DEADBEEF"), "8 hex digits");
+}
+
+static void TEST_SignAndPadding(void)
+{
+    // The sign goes before the zeros and after the spaces.
+    TEST_Check(TEST_Is(FORMAT_Sint16(-42, 6, '0', TEST_Clear(), &TEST_Length), "-00042"), "'0' padded negative");
+    TEST_Check(TEST_Is(FORMAT_Sint16(-42, 6, ' ', TEST_Clear(), &TEST_Length), "   -42"), "' ' padded negative");
+    TEST_Check(TEST_Is(FORMAT_Sint16(42, 6, '0', TEST_Clear(), &TEST_Length), "000042"), "'0' padded positive");
+    TEST_Check(TEST_Is(FORMAT_Sint32(-42, 3, '0', TEST_Clear(), &TEST_Length), "-42"), "width taken by the sign");
+    TEST_Check(TEST_Is(FORMAT_Sint32(-42, 2, '0', TEST_Clear(), &TEST_Length), "-42"), "width below the number");
+    TEST_Check(TEST_Is(FORMAT_Sint8(-5, 4, '0', TEST_Clear(), &TEST_Length), "-005"), "'0' padded sint8");
+
+    // -1.5 in Q8, the decimal point counts in the width.
+    TEST_Check(TEST_Is(FORMAT_Fixed(-TEST_Q8(3) / 2, 8, 1, 7, '0', TEST_Clear(), &TEST_Length), "-0001.5"),
+               "'0' padded negative fixed-point");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-TEST_Q8(3) / 2, 8, 1, 7, ' ', TEST_Clear(), &TEST_Length), "   -1.5"),
+               "' ' padded negative fixed-point");
+    TEST_Check(TEST_Is(FORMAT_Uint8(7, FORMAT_MAX_WIDTH, '0', TEST_Clear(), &TEST_Length),
+                       "00000000000000000000007"), "widest field");
+}
+
+static void TEST_FixedRounding(void)
+{
+    // 1.99609375 and 9.99609375 to 2 decimals, the carry ripples through both decimals.
+    TEST_Check(TEST_Is(FORMAT_Fixed(TEST_Q8(2) - 1, 8, 2, 0, ' ', TEST_Clear(), &TEST_Length), "2.00"),
+               "1.996 rounded to 2.00");
+    TEST_Check(TEST_Is(FORMAT_Fixed(TEST_Q8(10) - 1, 8, 2, 0, ' ', TEST_Clear(), &TEST_Length), "10.00"),
+               "9.996 rounded to 10.00, one more integer digit");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-(TEST_Q8(10) - 1), 8, 2, 0, ' ', TEST_Clear(), &TEST_Length), "-10.00"),
+               "-9.996 rounded on its magnitude to -10.00");
+    TEST_Check(TEST_Is(FORMAT_Fixed(TEST_Q16(9999) + 0xFFFF, 16, 3, 0, ' ', TEST_Clear(), &TEST_Length),
+                       "10000.000"), "9999.99998 rounded across the 16-bit conversion");
+
+    // Exactly half way rounds up, just below it rounds down.
+    TEST_Check(TEST_Is(FORMAT_Fixed(32, 8, 2, 0, ' ', TEST_Clear(), &TEST_Length), "0.13"), "0.125 rounded up");
+    TEST_Check(TEST_Is(FORMAT_Fixed(31, 8, 2, 0, ' ', TEST_Clear(), &TEST_Length), "0.12"), "0.121 rounded down");
+    TEST_Check(TEST_Is(FORMAT_Fixed(TEST_Q8(5) / 2, 8, 0, 0, ' ', TEST_Clear(), &TEST_Length), "3"),
+               "2.5 to no decimal");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-TEST_Q8(5) / 2, 8, 0, 0, ' ', TEST_Clear(), &TEST_Length), "-3"),
+               "-2.5 to no decimal");
+    TEST_Check(TEST_Is(FORMAT_Fixed(1234, 0, 2, 0, ' ', TEST_Clear(), &TEST_Length), "1234.00"),
+               "integer with no fraction bits");
+    TEST_Check(TEST_Is(FORMAT_Fixed(0x7FFFFFFFL, 8, 1, 0, ' ', TEST_Clear(), &TEST_Length), "8388608.0"),
+               "largest Q8 value rounded up");
+}
+
+static void TEST_FixedNegativeZero(void)
+{
+    // -0.001 in Q16 rounds to zero and loses its sign, -0.005 rounds away from zero and keeps it.
+    TEST_Check(TEST_Is(FORMAT_Fixed(-66, 16, 2, 0, ' ', TEST_Clear(), &TEST_Length), "0.00"), "-0.001 as 0.00");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-66, 16, 2, 6, '0', TEST_Clear(), &TEST_Length), "000.00"),
+               "-0.001 as 000.00, no sign before the zeros");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-66, 16, 0, 0, ' ', TEST_Clear(), &TEST_Length), "0"), "-0.001 as 0");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-328, 16, 2, 0, ' ', TEST_Clear(), &TEST_Length), "-0.01"), "-0.005 as -0.01");
+    TEST_Check(TEST_Is(FORMAT_Fixed(-TEST_Q16(1) / 2, 16, 0, 0, ' ', TEST_Clear(), &TEST_Length), "-1"),
+               "-0.5 as -1");
+}
+
+static void TEST_InvalidParameters(void)
+{
+    TEST_Check(E_NOT_OK == FORMAT_Uint32(1, 0, ' ', NULL_PTR, &TEST_Length), "NULL buffer");
+    TEST_Check(E_NOT_OK == FORMAT_Uint32(1, FORMAT_MAX_WIDTH + 1, ' ', TEST_Clear(), &TEST_Length),
+               "width above FORMAT_MAX_WIDTH");
+    TEST_Check(E_NOT_OK == FORMAT_Fixed(1, FORMAT_MAX_FRACTION_BITS + 1, 2, 0, ' ', TEST_Clear(), &TEST_Length),
+               "too many fraction bits");
+    TEST_Check(E_NOT_OK == FORMAT_Fixed(1, 8, FORMAT_MAX_DECIMALS + 1, 0, ' ', TEST_Clear(), &TEST_Length),
+               "too many decimals");
+    TEST_Check(E_NOT_OK == FORMAT_Hex(1, 9, TEST_Clear(), &TEST_Length), "more than 8 hex digits");
+    TEST_Check((E_OK == FORMAT_Uint8(42, 0, ' ', TEST_Clear(), NULL_PTR)) && ('4' == TEST_Buffer[0]) &&
+               ('2' == TEST_Buffer[1]) && ('\0' == TEST_Buffer[2]), "NULL length pointer accepted");
+}
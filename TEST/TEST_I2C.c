@@ -0,0 +1,231 @@
+/**
+ * @file TEST_I2C.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the I2C master transaction engine, built with the default configuration.
+ *
+ * The simulated device answers at TEST_ADDRESS and records every bus event. It reads back TEST_READ_BASE plus the
+ * index of the byte, and does not acknowledge the data byte TEST_NackByte of a frame when it is set.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_ADDRESS                        0x50
+#define TEST_ABSENT_ADDRESS                 0x51
+#define TEST_READ_BASE                      0xC0
+#define TEST_EVENTS                         32
+#define TEST_NO_NACK                        0xFF
+#define TEST_TRANSACTION_CYCLES             20000UL
+
+typedef struct
+{
+    SIM_I2cEventTypeDef Event;
+    uint8 Data;
+
+} TEST_BusEventTypeDef;
+
+static const I2C_InitTypeDef TEST_I2c = {
+    .Speed = I2C_SPEED_100KHZ
+};
+
+static TEST_BusEventTypeDef TEST_Events[TEST_EVENTS];
+static uint8 TEST_EventCount = 0;
+static uint8 TEST_FrameBytes = 0;       /* Bytes written since the last START, the address included */
+static boolean TEST_Addressed = FALSE;
+static uint8 TEST_NackByte = TEST_NO_NACK;
+static uint8 TEST_ReadIndex = 0;
+static uint8 TEST_Callbacks = 0;
+
+static void TEST_Setup(void);
+static boolean TEST_Device(const SIM_I2cEventTypeDef Event, uint8 * const Data);
+static boolean TEST_EventIs(const uint8 Index, const SIM_I2cEventTypeDef Event, const uint8 Data);
+static void TEST_Callback(void);
+
+static void TEST_WriteThenRead(void);
+static void TEST_AddressNack(void);
+static void TEST_DataNack(void);
+static void TEST_BusCollision(void);
+
+int main(void)
+{
+    TEST_Run("I2C write then read transaction", TEST_WriteThenRead);
+    TEST_Run("I2C address not acknowledged", TEST_AddressNack);
+    TEST_Run("I2C data byte not acknowledged", TEST_DataNack);
+    TEST_Run("I2C bus collision", TEST_BusCollision);
+
+    return TEST_Summary();
+}
+
+static void TEST_Setup(void)
+{
+    TEST_EventCount = 0;
+    TEST_FrameBytes = 0;
+    TEST_Addressed = FALSE;
+    TEST_NackByte = TEST_NO_NACK;
+    TEST_ReadIndex = 0;
+    TEST_Callbacks = 0;
+
+    SIM_SetI2cDevice(TEST_Device);
+
+    TEST_Check(E_OK == I2C_Init(&TEST_I2c), "I2C_Init");
+}
+
+static boolean TEST_Device(const SIM_I2cEventTypeDef Event, uint8 * const Data)
+{
+    boolean loc_acknowledge = FALSE;
+
+    switch (Event)
+    {
+        case SIM_I2C_START:
+            TEST_FrameBytes = 0;
+            TEST_Addressed = FALSE;
+            break;
+
+        case SIM_I2C_WRITE:
+            if (0 == TEST_FrameBytes)
+            {
+                TEST_Addressed = ((*Data >> 1) == TEST_ADDRESS) ? TRUE : FALSE;
+                loc_acknowledge = TEST_Addressed;
+            }
+            else
+            {
+                loc_acknowledge = (TRUE == TEST_Addressed) && (TEST_FrameBytes != TEST_NackByte);
+            }
+
+            TEST_FrameBytes++;
+            break;
+
+        case SIM_I2C_READ:
+            *Data = TEST_READ_BASE + TEST_ReadIndex;
+            TEST_ReadIndex++;
+            break;
+
+        default:
+            break;
+    }
+
+    if (TEST_EventCount < TEST_EVENTS)
+    {
+        TEST_Events[TEST_EventCount].Event = Event;
+        TEST_Events[TEST_EventCount].Data = (SIM_I2C_WRITE == Event) ? *Data : 0;
+        TEST_EventCount++;
+    }
+
+    return loc_acknowledge;
+}
+
+static boolean TEST_EventIs(const uint8 Index, const SIM_I2cEventTypeDef Event, const uint8 Data)
+{
+    return (Index < TEST_EventCount) && (Event == TEST_Events[Index].Event) && (Data == TEST_Events[Index].Data);
+}
+
+static void TEST_Callback(void)
+{
+    TEST_Callbacks++;
+}
+
+static void TEST_WriteThenRead(void)
+{
+    static const uint8 loc_tx[2] = {0x00, 0x10};
+    uint8 loc_rx[3] = {0};
+    uint8 loc_pending = 0;
+
+    I2C_TransactionTypeDef loc_transaction = {TEST_ADDRESS, loc_tx, 2, loc_rx, 3, TEST_Callback, I2C_STATUS_DONE};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_transaction), "I2C_AddTransaction");
+    TEST_Check(I2C_STATUS_PENDING == loc_transaction.Status, "transaction pending");
+
+    SIM_DelayCycles(TEST_TRANSACTION_CYCLES);
+
+    TEST_Check(I2C_STATUS_DONE == loc_transaction.Status, "transaction done");
+    TEST_Check(1 == TEST_Callbacks, "callback called");
+    TEST_Check((E_OK == I2C_GetPendingTransactions(&TEST_I2c, &loc_pending)) && (0 == loc_pending),
+               "queue empty");
+    TEST_Check(TEST_EventIs(0, SIM_I2C_START, 0) && TEST_EventIs(1, SIM_I2C_WRITE, TEST_ADDRESS << 1) &&
+               TEST_EventIs(2, SIM_I2C_WRITE, 0x00) && TEST_EventIs(3, SIM_I2C_WRITE, 0x10),
+               "START, address for write and the 2 bytes");
+    TEST_Check(TEST_EventIs(4, SIM_I2C_START, 0) && TEST_EventIs(5, SIM_I2C_WRITE, (TEST_ADDRESS << 1) | 0x01),
+               "repeated START and address for read");
+    TEST_Check((10 == TEST_EventCount) && TEST_EventIs(9, SIM_I2C_STOP, 0), "3 bytes read then STOP");
+    TEST_Check((0xC0 == loc_rx[0]) && (0xC1 == loc_rx[1]) && (0xC2 == loc_rx[2]), "bytes read from the device");
+}
+
+static void TEST_AddressNack(void)
+{
+    static const uint8 loc_tx[1] = {0x20};
+    uint8 loc_rx[1] = {0};
+
+    I2C_TransactionTypeDef loc_absent = {TEST_ABSENT_ADDRESS, loc_tx, 1, loc_rx, 1, TEST_Callback, I2C_STATUS_DONE};
+    I2C_TransactionTypeDef loc_present = {TEST_ADDRESS, NULL_PTR, 0, loc_rx, 1, TEST_Callback, I2C_STATUS_DONE};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_absent), "queue a transaction to an absent device");
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_present), "queue a read from the device");
+
+    SIM_DelayCycles(TEST_TRANSACTION_CYCLES);
+
+    TEST_Check(I2C_STATUS_NACK == loc_absent.Status, "address not acknowledged");
+    TEST_Check(TEST_EventIs(0, SIM_I2C_START, 0) && TEST_EventIs(1, SIM_I2C_WRITE, TEST_ABSENT_ADDRESS << 1) &&
+               TEST_EventIs(2, SIM_I2C_STOP, 0), "STOP right after the address");
+    TEST_Check(I2C_STATUS_DONE == loc_present.Status, "next transaction run");
+    TEST_Check(TEST_READ_BASE == loc_rx[0], "byte read by the next transaction");
+    TEST_Check(2 == TEST_Callbacks, "callbacks of both transactions");
+}
+
+static void TEST_DataNack(void)
+{
+    static const uint8 loc_tx[3] = {0x01, 0x02, 0x03};
+    uint8 loc_rx[2] = {0x55, 0x55};
+
+    I2C_TransactionTypeDef loc_transaction = {TEST_ADDRESS, loc_tx, 3, loc_rx, 2, TEST_Callback, I2C_STATUS_DONE};
+
+    TEST_Setup();
+    TEST_NackByte = 2;
+
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_transaction), "I2C_AddTransaction");
+
+    SIM_DelayCycles(TEST_TRANSACTION_CYCLES);
+
+    TEST_Check(I2C_STATUS_NACK == loc_transaction.Status, "second byte not acknowledged");
+    TEST_Check((5 == TEST_EventCount) && TEST_EventIs(3, SIM_I2C_WRITE, 0x02) && TEST_EventIs(4, SIM_I2C_STOP, 0),
+               "STOP right after the second byte");
+    TEST_Check((0x55 == loc_rx[0]) && (0x55 == loc_rx[1]), "nothing read");
+    TEST_Check(1 == TEST_Callbacks, "callback called");
+}
+
+static void TEST_BusCollision(void)
+{
+    static const uint8 loc_tx[4] = {0x01, 0x02, 0x03, 0x04};
+    uint8 loc_rx[1] = {0};
+    uint8 loc_pending = 0;
+
+    I2C_TransactionTypeDef loc_lost = {TEST_ADDRESS, loc_tx, 4, NULL_PTR, 0, TEST_Callback, I2C_STATUS_DONE};
+    I2C_TransactionTypeDef loc_next = {TEST_ADDRESS, NULL_PTR, 0, loc_rx, 1, TEST_Callback, I2C_STATUS_DONE};
+
+    TEST_Setup();
+
+    TEST_Check(E_NOT_OK == SIM_I2cBusCollision(), "no collision while the bus is idle");
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_lost), "queue 4 bytes");
+    TEST_Check(E_OK == I2C_AddTransaction(&TEST_I2c, &loc_next), "queue a read");
+
+    // In the middle of the data bytes of the first transaction.
+    SIM_DelayCycles(500);
+    TEST_Check(I2C_STATUS_PENDING == loc_lost.Status, "first transaction in progress");
+    TEST_Check(E_OK == SIM_I2cBusCollision(), "SIM_I2cBusCollision");
+
+    SIM_DelayCycles(TEST_TRANSACTION_CYCLES);
+
+    TEST_Check(I2C_STATUS_BUS_COLLISION == loc_lost.Status, "first transaction lost the bus");
+    TEST_Check(0 == PIR2bits.BCLIF, "bus collision flag cleared");
+    TEST_Check(I2C_STATUS_DONE == loc_next.Status, "next transaction run");
+    TEST_Check(TEST_READ_BASE == loc_rx[0], "byte read by the next transaction");
+    TEST_Check(2 == TEST_Callbacks, "callbacks of both transactions");
+    TEST_Check((E_OK == I2C_GetPendingTransactions(&TEST_I2c, &loc_pending)) && (0 == loc_pending),
+               "queue empty");
+}
@@ -0,0 +1,235 @@
+/**
+ * @file TEST_SPI_Queue.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the SPI transaction queue, built with the SPI interrupts on.
+ *
+ * Two devices share the bus, each with its own clock mode and chip select. The simulated device records, for every
+ * byte, the clock mode loaded in the MSSP and the chip selects, and answers with the complement of the byte.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_BYTES                          32
+#define TEST_DEVICE_A_CS                    0x01
+#define TEST_DEVICE_B_CS                    0x02
+
+typedef struct
+{
+    uint8 Mosi;
+    uint8 Mode;
+    uint8 ClockPolarity;
+    uint8 SetupTime;
+    uint8 ChipSelects;      /* Levels of RD1 and RD0 */
+
+} TEST_ByteTypeDef;
+
+static SPI_InitTypeDef TEST_Spi = {
+    .Mode = SPI_MODE_MASTER_PRESCALER_4,
+    .ClockPolarity = SPI_CLOCK_POLARITY_LOW,
+    .SetupTime = SPI_SETUP_TIME_LEADING_EDGE,
+    .SampleTime = SPI_SAMPLE_TIME_MIDDLE_OF_DATA,
+    .InterruptHandler = NULL_PTR
+};
+
+static const SPI_DeviceTypeDef TEST_DeviceA = {
+    .ChipSelect = GPIO_PIN_CHANNEL_PASTE(D, 0, GPIO_OUTPUT, GPIO_HIGH),
+    .Mode = SPI_MODE_MASTER_PRESCALER_4,
+    .ClockPolarity = SPI_CLOCK_POLARITY_LOW,
+    .SetupTime = SPI_SETUP_TIME_TRAILING_EDGE,
+    .SampleTime = SPI_SAMPLE_TIME_MIDDLE_OF_DATA
+};
+
+static const SPI_DeviceTypeDef TEST_DeviceB = {
+    .ChipSelect = GPIO_PIN_CHANNEL_PASTE(D, 1, GPIO_OUTPUT, GPIO_HIGH),
+    .Mode = SPI_MODE_MASTER_PRESCALER_64,
+    .ClockPolarity = SPI_CLOCK_POLARITY_HIGH,
+    .SetupTime = SPI_SETUP_TIME_LEADING_EDGE,
+    .SampleTime = SPI_SAMPLE_TIME_MIDDLE_OF_DATA
+};
+
+static TEST_ByteTypeDef TEST_Bytes[TEST_BYTES];
+static uint8 TEST_ByteCount = 0;
+static uint8 TEST_Callbacks[4];
+static uint8 TEST_CallbackCount = 0;
+
+static void TEST_Setup(void);
+static uint8 TEST_Device(const uint8 Mosi);
+static boolean TEST_SentTo(const uint8 First, const uint8 Count, const uint8 * const Data,
+                           const SPI_DeviceTypeDef * const Device, const uint8 ChipSelects);
+static void TEST_Record(const uint8 Id);
+static void TEST_CallbackA(void);
+static void TEST_CallbackB(void);
+
+static void TEST_DeviceSwitching(void);
+static void TEST_BlockingRejectedWhileBusy(void);
+static void TEST_DeInitDropsQueue(void);
+
+int main(void)
+{
+    TEST_Run("SPI queue switches the clock mode and chip select per device", TEST_DeviceSwitching);
+    TEST_Run("SPI blocking transfers rejected while the queue is busy", TEST_BlockingRejectedWhileBusy);
+    TEST_Run("SPI deinit drops the queue and deselects the device", TEST_DeInitDropsQueue);
+
+    return TEST_Summary();
+}
+
+static void TEST_Setup(void)
+{
+    TEST_ByteCount = 0;
+    TEST_CallbackCount = 0;
+
+    SIM_SetSpiDevice(TEST_Device);
+
+    TEST_Check(E_OK == SPI_Init(&TEST_Spi), "SPI_Init");
+    TEST_Check(E_OK == SPI_Device_Init(&TEST_DeviceA), "SPI_Device_Init A");
+    TEST_Check(E_OK == SPI_Device_Init(&TEST_DeviceB), "SPI_Device_Init B");
+}
+
+static uint8 TEST_Device(const uint8 Mosi)
+{
+    if (TEST_ByteCount < TEST_BYTES)
+    {
+        TEST_Bytes[TEST_ByteCount].Mosi = Mosi;
+        TEST_Bytes[TEST_ByteCount].Mode = SSPCON1bits.SSPM;
+        TEST_Bytes[TEST_ByteCount].ClockPolarity = SSPCON1bits.CKP;
+        TEST_Bytes[TEST_ByteCount].SetupTime = SSPSTATbits.CKE;
+        TEST_Bytes[TEST_ByteCount].ChipSelects = LATD & (TEST_DEVICE_A_CS | TEST_DEVICE_B_CS);
+        TEST_ByteCount++;
+    }
+
+    return (uint8)~Mosi;
+}
+
+/* Count bytes from the First one were Data, clocked in the mode of Device with the chip selects at ChipSelects */
+static boolean TEST_SentTo(const uint8 First, const uint8 Count, const uint8 * const Data,
+                           const SPI_DeviceTypeDef * const Device, const uint8 ChipSelects)
+{
+    boolean loc_sent = ((First + Count) <= TEST_ByteCount) ? TRUE : FALSE;
+    uint8 loc_byte = 0;
+
+    for (loc_byte = First; (TRUE == loc_sent) && (loc_byte < (First + Count)); loc_byte++)
+    {
+        loc_sent = (Data[loc_byte - First] == TEST_Bytes[loc_byte].Mosi) &&
+                   (Device->Mode == TEST_Bytes[loc_byte].Mode) &&
+                   (Device->ClockPolarity == TEST_Bytes[loc_byte].ClockPolarity) &&
+                   (Device->SetupTime == TEST_Bytes[loc_byte].SetupTime) &&
+                   (ChipSelects == TEST_Bytes[loc_byte].ChipSelects);
+    }
+
+    return loc_sent;
+}
+
+static void TEST_Record(const uint8 Id)
+{
+    if (TEST_CallbackCount < sizeof(TEST_Callbacks))
+    {
+        TEST_Callbacks[TEST_CallbackCount] = Id;
+        TEST_CallbackCount++;
+    }
+}
+
+static void TEST_CallbackA(void)
+{
+    TEST_Record('A');
+}
+
+static void TEST_CallbackB(void)
+{
+    TEST_Record('B');
+}
+
+static void TEST_DeviceSwitching(void)
+{
+    static const uint8 loc_txA[3] = {0x11, 0x22, 0x33};
+    static const uint8 loc_txB[2] = {0x44, 0x55};
+    static const uint8 loc_fill[2] = {0xA5, 0xA5};
+    uint8 loc_rxA[3] = {0};
+    uint8 loc_rxB[2] = {0};
+    uint8 loc_pending = 0;
+
+    const SPI_TransactionTypeDef loc_first = {&TEST_DeviceA, loc_txA, loc_rxA, 3, 0x00, TEST_CallbackA};
+    const SPI_TransactionTypeDef loc_second = {&TEST_DeviceB, loc_txB, loc_rxB, 2, 0x00, TEST_CallbackB};
+    const SPI_TransactionTypeDef loc_third = {&TEST_DeviceA, NULL_PTR, NULL_PTR, 2, 0xA5, NULL_PTR};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_first), "queue 3 bytes to A");
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_second), "queue 2 bytes to B");
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_third), "queue 2 fill bytes to A");
+
+    SIM_DelayCycles(5000);
+
+    TEST_Check((E_OK == SPI_Queue_GetPendingTransactions(&TEST_Spi, &loc_pending)) && (0 == loc_pending),
+               "queue empty");
+    TEST_Check(7 == TEST_ByteCount, "7 bytes clocked");
+    TEST_Check(TEST_SentTo(0, 3, loc_txA, &TEST_DeviceA, TEST_DEVICE_B_CS), "A bytes in the mode of A, A selected");
+    TEST_Check(TEST_SentTo(3, 2, loc_txB, &TEST_DeviceB, TEST_DEVICE_A_CS), "B bytes in the mode of B, B selected");
+    TEST_Check(TEST_SentTo(5, 2, loc_fill, &TEST_DeviceA, TEST_DEVICE_B_CS), "fill bytes in the mode of A again");
+    TEST_Check((0xEE == loc_rxA[0]) && (0xDD == loc_rxA[1]) && (0xCC == loc_rxA[2]), "bytes received from A");
+    TEST_Check((0xBB == loc_rxB[0]) && (0xAA == loc_rxB[1]), "bytes received from B");
+    TEST_Check((2 == TEST_CallbackCount) && ('A' == TEST_Callbacks[0]) && ('B' == TEST_Callbacks[1]),
+               "callbacks of A then B");
+    TEST_Check((TEST_DEVICE_A_CS | TEST_DEVICE_B_CS) == (LATD & (TEST_DEVICE_A_CS | TEST_DEVICE_B_CS)),
+               "both devices deselected");
+}
+
+static void TEST_BlockingRejectedWhileBusy(void)
+{
+    static const uint8 loc_tx[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8 loc_rx[8] = {0};
+    uint8 loc_data = 0;
+    uint8 loc_pending = 0;
+
+    const SPI_TransactionTypeDef loc_transaction = {&TEST_DeviceB, loc_tx, NULL_PTR, 8, 0x00, TEST_CallbackB};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_transaction), "queue 8 bytes to B");
+
+    TEST_Check(E_NOT_OK == SPI_SendData(&TEST_Spi, 0x99), "SPI_SendData rejected");
+    TEST_Check(E_NOT_OK == SPI_ReadData(&TEST_Spi, &loc_data), "SPI_ReadData rejected");
+    TEST_Check(E_NOT_OK == SPI_ExchangeData(&TEST_Spi, 0x99, &loc_data), "SPI_ExchangeData rejected");
+    TEST_Check(E_NOT_OK == SPI_TransferBuffer(&TEST_Spi, loc_tx, loc_rx, 8), "SPI_TransferBuffer rejected");
+    TEST_Check(E_NOT_OK == SPI_WriteBuffer(&TEST_Spi, loc_tx, 8), "SPI_WriteBuffer rejected");
+    TEST_Check(E_NOT_OK == SPI_ReadBuffer(&TEST_Spi, loc_rx, 8, 0xFF), "SPI_ReadBuffer rejected");
+
+    SIM_DelayCycles(5000);
+
+    TEST_Check((E_OK == SPI_Queue_GetPendingTransactions(&TEST_Spi, &loc_pending)) && (0 == loc_pending),
+               "queue empty");
+    TEST_Check((8 == TEST_ByteCount) && TEST_SentTo(0, 8, loc_tx, &TEST_DeviceB, TEST_DEVICE_A_CS),
+               "only the queued bytes clocked");
+    TEST_Check((1 == TEST_CallbackCount) && ('B' == TEST_Callbacks[0]), "transaction completed");
+
+    TEST_Check(E_OK == SPI_ExchangeData(&TEST_Spi, 0x99, &loc_data), "SPI_ExchangeData once the queue is empty");
+    TEST_Check((9 == TEST_ByteCount) && (0x66 == loc_data), "byte exchanged");
+}
+
+static void TEST_DeInitDropsQueue(void)
+{
+    static const uint8 loc_tx[16] = {0};
+    uint8 loc_pending = 0;
+
+    const SPI_TransactionTypeDef loc_transaction = {&TEST_DeviceB, loc_tx, NULL_PTR, 16, 0x00, TEST_CallbackB};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_transaction), "queue 16 bytes to B");
+    TEST_Check(E_OK == SPI_Queue_AddTransaction(&TEST_Spi, &loc_transaction), "queue 16 more bytes to B");
+    TEST_Check(0 == (LATD & TEST_DEVICE_B_CS), "B selected");
+
+    SIM_DelayCycles(300);
+    TEST_Check(E_OK == SPI_DeInit(&TEST_Spi), "SPI_DeInit");
+
+    TEST_Check((E_OK == SPI_Queue_GetPendingTransactions(&TEST_Spi, &loc_pending)) && (0 == loc_pending),
+               "transactions dropped");
+    TEST_Check(0 != (LATD & TEST_DEVICE_B_CS), "B deselected");
+
+    SIM_DelayCycles(5000);
+    TEST_Check(TEST_ByteCount < 16, "transfer stopped");
+    TEST_Check(0 == TEST_CallbackCount, "no callback");
+}
@@ -0,0 +1,213 @@
+/**
+ * @file TEST_SPI_Slave.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the buffered SPI slave mode, built with the SPI interrupts on.
+ *
+ * The external master clocks one byte at a time and leaves TEST_GAP_CYCLES between bytes for the SPI interrupt to
+ * load the next response byte. SS (RA5) is held low during the frames.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_PORTA                          0
+#define TEST_SS_PIN                         0x20
+#define TEST_GAP_CYCLES                     200
+
+static SPI_InitTypeDef TEST_Spi = {
+    .Mode = SPI_MODE_SLAVE_SS_ENABLED,
+    .ClockPolarity = SPI_CLOCK_POLARITY_LOW,
+    .SetupTime = SPI_SETUP_TIME_TRAILING_EDGE,
+    .SampleTime = SPI_SAMPLE_TIME_MIDDLE_OF_DATA,
+    .InterruptHandler = NULL_PTR
+};
+
+static void TEST_Setup(void);
+static boolean TEST_Exchange(const uint8 * const Mosi, uint8 * const Miso, const uint8 Length);
+static boolean TEST_Received(const uint8 * const Data, const uint8 Length);
+
+static void TEST_FrameExchange(void);
+static void TEST_Overrun(void);
+static void TEST_EndOfFrameServicesPendingByte(void);
+static void TEST_ReceiveBufferFull(void);
+static void TEST_LateResponseDropped(void);
+static void TEST_SlaveSelectHigh(void);
+
+int main(void)
+{
+    TEST_Run("SPI slave frame with a response", TEST_FrameExchange);
+    TEST_Run("SPI slave overrun", TEST_Overrun);
+    TEST_Run("SPI slave end of frame stores the pending byte", TEST_EndOfFrameServicesPendingByte);
+    TEST_Run("SPI slave full receive buffer", TEST_ReceiveBufferFull);
+    TEST_Run("SPI slave response left at the end of frame", TEST_LateResponseDropped);
+    TEST_Run("SPI slave ignores the master while SS is high", TEST_SlaveSelectHigh);
+
+    return TEST_Summary();
+}
+
+static void TEST_Setup(void)
+{
+    (void)SIM_SetPortInput(TEST_PORTA, 0x00);
+
+    TEST_Check(E_OK == SPI_Init(&TEST_Spi), "SPI_Init");
+}
+
+/* Clocks Length bytes as the external master, the bytes shifted out by the slave are stored in Miso */
+static boolean TEST_Exchange(const uint8 * const Mosi, uint8 * const Miso, const uint8 Length)
+{
+    boolean loc_exchanged = TRUE;
+    uint8 loc_byte = 0;
+
+    for (loc_byte = 0; loc_byte < Length; loc_byte++)
+    {
+        loc_exchanged &= (E_OK == SIM_SpiSlaveExchange(Mosi[loc_byte], &Miso[loc_byte]));
+        SIM_DelayCycles(TEST_GAP_CYCLES);
+    }
+
+    return loc_exchanged;
+}
+
+/* The receive buffer holds exactly the Length bytes of Data */
+static boolean TEST_Received(const uint8 * const Data, const uint8 Length)
+{
+    boolean loc_received = TRUE;
+    uint8 loc_available = 0;
+    uint8 loc_data = 0;
+    uint8 loc_byte = 0;
+
+    loc_received &= (E_OK == SPI_Slave_GetRxAvailable(&TEST_Spi, &loc_available)) && (Length == loc_available);
+
+    for (loc_byte = 0; (TRUE == loc_received) && (loc_byte < Length); loc_byte++)
+    {
+        loc_received = (E_OK == SPI_Slave_Read(&TEST_Spi, &loc_data)) && (Data[loc_byte] == loc_data);
+    }
+
+    loc_received &= (E_NOT_OK == SPI_Slave_Read(&TEST_Spi, &loc_data));
+
+    return loc_received;
+}
+
+static void TEST_FrameExchange(void)
+{
+    static const uint8 loc_mosi[4] = {0xA1, 0xA2, 0xA3, 0xA4};
+    static const uint8 loc_response[3] = {0x10, 0x20, 0x30};
+    uint8 loc_miso[4] = {0};
+    uint8 loc_length = 0;
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == SPI_Slave_Write(&TEST_Spi, loc_response, 3), "SPI_Slave_Write");
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 4), "4 bytes clocked");
+    TEST_Check(E_OK == SPI_Slave_EndOfFrame(&TEST_Spi, &loc_length), "SPI_Slave_EndOfFrame");
+
+    TEST_Check(4 == loc_length, "frame of 4 bytes");
+    TEST_Check((0x10 == loc_miso[0]) && (0x20 == loc_miso[1]) && (0x30 == loc_miso[2]), "response shifted out");
+    TEST_Check(SPI_SLAVE_FILL_BYTE == loc_miso[3], "fill byte once the response is sent");
+    TEST_Check(TEST_Received(loc_mosi, 4), "bytes of the master received");
+    TEST_Check(0 == SSPCON1bits.SSPOV, "no overrun");
+}
+
+static void TEST_Overrun(void)
+{
+    static const uint8 loc_mosi[3] = {0xB1, 0xB2, 0xB3};
+    static const uint8 loc_kept[2] = {0xB1, 0xB3};
+    uint8 loc_miso[3] = {0};
+    uint8 loc_length = 0;
+
+    TEST_Setup();
+
+    // The second byte arrives before the first one is serviced, the MSSP drops it.
+    INTI_DisableInterrupts();
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 2), "2 bytes clocked with the interrupts off");
+    TEST_Check(1 == SSPCON1bits.SSPOV, "overrun flagged");
+    INTI_EnableInterrupts();
+    SIM_DelayCycles(TEST_GAP_CYCLES);
+
+    TEST_Check(0 == SSPCON1bits.SSPOV, "overrun cleared by the SPI interrupt");
+
+    TEST_Check(TEST_Exchange(&loc_mosi[2], &loc_miso[2], 1), "next byte clocked");
+    TEST_Check(E_OK == SPI_Slave_EndOfFrame(&TEST_Spi, &loc_length), "SPI_Slave_EndOfFrame");
+
+    TEST_Check(2 == loc_length, "frame of the 2 bytes kept");
+    TEST_Check(TEST_Received(loc_kept, 2), "first and third bytes received");
+    TEST_Check(0 == SSPCON1bits.SSPOV, "no overrun left");
+}
+
+static void TEST_EndOfFrameServicesPendingByte(void)
+{
+    static const uint8 loc_mosi[1] = {0xC1};
+    uint8 loc_miso[1] = {0};
+    uint8 loc_length = 0;
+
+    TEST_Setup();
+
+    // SS rises before the SPI interrupt of the last byte is serviced.
+    INTI_DisableInterrupts();
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 1), "byte clocked with the interrupts off");
+    TEST_Check(E_OK == SPI_Slave_EndOfFrame(&TEST_Spi, &loc_length), "SPI_Slave_EndOfFrame");
+    INTI_EnableInterrupts();
+    SIM_DelayCycles(TEST_GAP_CYCLES);
+
+    TEST_Check(1 == loc_length, "frame of 1 byte");
+    TEST_Check(TEST_Received(loc_mosi, 1), "byte received once");
+}
+
+static void TEST_ReceiveBufferFull(void)
+{
+    uint8 loc_mosi[SPI_SLAVE_RX_BUFFER_SIZE + 8] = {0};
+    uint8 loc_miso[SPI_SLAVE_RX_BUFFER_SIZE + 8] = {0};
+    uint8 loc_length = 0;
+    uint8 loc_byte = 0;
+
+    TEST_Setup();
+
+    for (loc_byte = 0; loc_byte < sizeof(loc_mosi); loc_byte++)
+    {
+        loc_mosi[loc_byte] = loc_byte;
+    }
+
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, sizeof(loc_mosi)), "bytes clocked");
+    TEST_Check(E_OK == SPI_Slave_EndOfFrame(&TEST_Spi, &loc_length), "SPI_Slave_EndOfFrame");
+
+    TEST_Check(sizeof(loc_mosi) == loc_length, "every byte counted in the frame");
+    TEST_Check(TEST_Received(loc_mosi, SPI_SLAVE_RX_BUFFER_SIZE), "bytes past the full buffer dropped");
+}
+
+static void TEST_LateResponseDropped(void)
+{
+    static const uint8 loc_mosi[2] = {0xD1, 0xD2};
+    static const uint8 loc_response[5] = {0x01, 0x02, 0x03, 0x04, 0x05};
+    uint8 loc_miso[2] = {0};
+
+    TEST_Setup();
+
+    TEST_Check(E_OK == SPI_Slave_Write(&TEST_Spi, loc_response, 5), "SPI_Slave_Write");
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 2), "2 bytes of the first frame");
+    TEST_Check((0x01 == loc_miso[0]) && (0x02 == loc_miso[1]), "start of the response");
+    TEST_Check(E_OK == SPI_Slave_EndOfFrame(&TEST_Spi, NULL_PTR), "SPI_Slave_EndOfFrame");
+
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 2), "2 bytes of the next frame");
+    TEST_Check((SPI_SLAVE_FILL_BYTE == loc_miso[0]) && (SPI_SLAVE_FILL_BYTE == loc_miso[1]),
+               "rest of the response dropped");
+}
+
+static void TEST_SlaveSelectHigh(void)
+{
+    static const uint8 loc_mosi[1] = {0xE1};
+    uint8 loc_miso[1] = {0};
+    uint8 loc_available = 0;
+
+    TEST_Setup();
+
+    (void)SIM_SetPortInput(TEST_PORTA, TEST_SS_PIN);
+    TEST_Check(FALSE == TEST_Exchange(loc_mosi, loc_miso, 1), "byte not clocked in");
+    TEST_Check((E_OK == SPI_Slave_GetRxAvailable(&TEST_Spi, &loc_available)) && (0 == loc_available),
+               "nothing received");
+
+    (void)SIM_SetPortInput(TEST_PORTA, 0x00);
+    TEST_Check(TEST_Exchange(loc_mosi, loc_miso, 1), "byte clocked once SS is low");
+    TEST_Check(TEST_Received(loc_mosi, 1), "byte received");
+}
@@ -0,0 +1,303 @@
+/**
+ * @file TEST_SWTIMER.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Tests of the software timer wheel, built with the default configuration.
+ *
+ * The tick is driven by the test, which calls SWTIMER_Tick() itself with the global interrupts off so that TIMER0
+ * never adds a tick of its own. The wheel has 4 levels of 16 slots, a timer is handed down a level when the levels
+ * below it wrap around, every 16, 256 and 4096 ticks.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "TEST.h"
+
+#define TEST_FIRES                          16
+
+typedef struct
+{
+    uint32 Ticks[TEST_FIRES];       /* Tick of each expiry, counted from the setup */
+    uint8 Count;
+
+} TEST_TimerTypeDef;
+
+static TEST_TimerTypeDef TEST_Timers[SWTIMER_NUMBER_OF_TIMERS];
+static uint32 TEST_Now = 0;
+
+static void TEST_Setup(void);
+static void TEST_Advance(const uint32 Ticks);
+static boolean TEST_FiredOnceAt(const SWTIMER_IdTypeDef Id, const uint32 Tick);
+static void TEST_Boundaries(const uint32 Offset);
+static void TEST_Record(const SWTIMER_IdTypeDef Id);
+static void TEST_Callback0(void);
+static void TEST_Callback1(void);
+static void TEST_Callback2(void);
+static void TEST_Callback3(void);
+static void TEST_Callback4(void);
+static void TEST_Callback5(void);
+static void TEST_Callback6(void);
+static void TEST_Callback7(void);
+static void TEST_StopOthers(void);
+static void TEST_StopItself(void);
+static void TEST_RestartItself(void);
+
+static void TEST_LevelBoundaries(void);
+static void TEST_LevelBoundariesFromMidSlot(void);
+static void TEST_CounterWrap(void);
+static void TEST_PeriodicRearm(void);
+static void TEST_StopFromCallback(void);
+static void TEST_StartFromCallback(void);
+
+static void (* const TEST_Callbacks[SWTIMER_NUMBER_OF_TIMERS])(void) = {
+    TEST_Callback0, TEST_Callback1, TEST_Callback2, TEST_Callback3,
+    TEST_Callback4, TEST_Callback5, TEST_Callback6, TEST_Callback7
+};
+
+int main(void)
+{
+    TEST_Run("SWTIMER expiry at the level boundaries", TEST_LevelBoundaries);
+    TEST_Run("SWTIMER expiry at the level boundaries from the middle of a slot", TEST_LevelBoundariesFromMidSlot);
+    TEST_Run("SWTIMER expiry across the wrap of the tick counter", TEST_CounterWrap);
+    TEST_Run("SWTIMER periodic timers re-armed without drift", TEST_PeriodicRearm);
+    TEST_Run("SWTIMER timers stopped from a callback", TEST_StopFromCallback);
+    TEST_Run("SWTIMER timer restarted from its callback", TEST_StartFromCallback);
+
+    return TEST_Summary();
+}
+
+static void TEST_Setup(void)
+{
+    uint8 loc_id = 0;
+
+    for (loc_id = 0; loc_id < SWTIMER_NUMBER_OF_TIMERS; loc_id++)
+    {
+        TEST_Timers[loc_id].Count = 0;
+    }
+
+    TEST_Now = 0;
+
+    TEST_Check(E_OK == SWTIMER_Init(), "SWTIMER_Init");
+    INTI_DisableInterrupts();
+}
+
+static void TEST_Advance(const uint32 Ticks)
+{
+    uint32 loc_tick = 0;
+
+    for (loc_tick = 0; loc_tick < Ticks; loc_tick++)
+    {
+        TEST_Now++;
+        SWTIMER_Tick();
+    }
+}
+
+static boolean TEST_FiredOnceAt(const SWTIMER_IdTypeDef Id, const uint32 Tick)
+{
+    return (1 == TEST_Timers[Id].Count) && (Tick == TEST_Timers[Id].Ticks[0]);
+}
+
+/* One-shot timers one tick either side of each level boundary, started Offset ticks after the setup */
+static void TEST_Boundaries(const uint32 Offset)
+{
+    static const uint16 loc_periods[2][SWTIMER_NUMBER_OF_TIMERS] = {
+        {1, 15, 16, 17, 255, 256, 257, 4095},
+        {4096, 4097, 4111, 4112, 8192, 61440, 65534, 65535}
+    };
+    boolean loc_exact = TRUE;
+    uint8 loc_batch = 0;
+    uint8 loc_id = 0;
+    uint32 loc_start = 0;
+
+    for (loc_batch = 0; loc_batch < 2; loc_batch++)
+    {
+        TEST_Setup();
+        TEST_Advance(Offset);
+        loc_start = TEST_Now;
+
+        for (loc_id = 0; loc_id < SWTIMER_NUMBER_OF_TIMERS; loc_id++)
+        {
+            TEST_Check(E_OK == SWTIMER_Start(loc_id, loc_periods[loc_batch][loc_id], SWTIMER_MODE_ONE_SHOT,
+                                             TEST_Callbacks[loc_id]), "SWTIMER_Start");
+        }
+
+        TEST_Advance(SWTIMER_MAX_PERIOD_TICKS + 100UL);
+
+        for (loc_id = 0; loc_id < SWTIMER_NUMBER_OF_TIMERS; loc_id++)
+        {
+            loc_exact &= TEST_FiredOnceAt(loc_id, loc_start + loc_periods[loc_batch][loc_id]);
+        }
+    }
+
+    TEST_Check(loc_exact, "every timer expired once, on its tick");
+}
+
+static void TEST_Record(const SWTIMER_IdTypeDef Id)
+{
+    if (TEST_Timers[Id].Count < TEST_FIRES)
+    {
+        TEST_Timers[Id].Ticks[TEST_Timers[Id].Count] = TEST_Now;
+    }
+
+    TEST_Timers[Id].Count++;
+}
+
+static void TEST_Callback0(void)
+{
+    TEST_Record(0);
+}
+
+static void TEST_Callback1(void)
+{
+    TEST_Record(1);
+}
+
+static void TEST_Callback2(void)
+{
+    TEST_Record(2);
+}
+
+static void TEST_Callback3(void)
+{
+    TEST_Record(3);
+}
+
+static void TEST_Callback4(void)
+{
+    TEST_Record(4);
+}
+
+static void TEST_Callback5(void)
+{
+    TEST_Record(5);
+}
+
+static void TEST_Callback6(void)
+{
+    TEST_Record(6);
+}
+
+static void TEST_Callback7(void)
+{
+    TEST_Record(7);
+}
+
+/* Timer 0, stops timers 1 and 2 */
+static void TEST_StopOthers(void)
+{
+    TEST_Record(0);
+
+    (void)SWTIMER_Stop(1);
+    (void)SWTIMER_Stop(2);
+}
+
+/* Timer 3, periodic, stops itself on its third expiry */
+static void TEST_StopItself(void)
+{
+    TEST_Record(3);
+
+    if (3 == TEST_Timers[3].Count)
+    {
+        (void)SWTIMER_Stop(3);
+    }
+}
+
+/* Timer 4, one-shot, started again from its callback with a longer period twice */
+static void TEST_RestartItself(void)
+{
+    TEST_Record(4);
+
+    if (TEST_Timers[4].Count < 3)
+    {
+        (void)SWTIMER_Start(4, 100UL * TEST_Timers[4].Count, SWTIMER_MODE_ONE_SHOT, TEST_RestartItself);
+    }
+}
+
+static void TEST_LevelBoundaries(void)
+{
+    TEST_Boundaries(0);
+}
+
+static void TEST_LevelBoundariesFromMidSlot(void)
+{
+    // Started from a tick that is not a multiple of any level, the timers are handed down by every level.
+    TEST_Boundaries(4096UL + 256UL + 16UL + 7UL);
+}
+
+static void TEST_CounterWrap(void)
+{
+    TEST_Boundaries(65536UL - 20UL);
+}
+
+static void TEST_PeriodicRearm(void)
+{
+    boolean loc_exact = TRUE;
+    boolean loc_running = FALSE;
+    uint8 loc_fire = 0;
+
+    TEST_Setup();
+    TEST_Advance(5);
+
+    TEST_Check(E_OK == SWTIMER_Start(0, 300, SWTIMER_MODE_PERIODIC, TEST_Callback0), "start a 300 ticks timer");
+    TEST_Check(E_OK == SWTIMER_Start(1, 4096, SWTIMER_MODE_PERIODIC, TEST_Callback1), "start a 4096 ticks timer");
+    TEST_Check(E_OK == SWTIMER_Start(2, 7, SWTIMER_MODE_ONE_SHOT, TEST_Callback2), "start a 7 ticks one-shot");
+
+    TEST_Advance(3000);
+
+    for (loc_fire = 0; loc_fire < 10; loc_fire++)
+    {
+        loc_exact &= (TEST_Timers[0].Ticks[loc_fire] == (5UL + (300UL * (loc_fire + 1))));
+    }
+
+    TEST_Check((10 == TEST_Timers[0].Count) && loc_exact, "300 ticks timer every 300 ticks");
+    TEST_Check(TEST_FiredOnceAt(2, 12), "one-shot once");
+
+    TEST_Advance(16384UL - 3000UL);
+
+    loc_exact = TRUE;
+
+    for (loc_fire = 0; loc_fire < 4; loc_fire++)
+    {
+        loc_exact &= (TEST_Timers[1].Ticks[loc_fire] == (5UL + (4096UL * (loc_fire + 1))));
+    }
+
+    TEST_Check((4 == TEST_Timers[1].Count) && loc_exact, "4096 ticks timer every 4096 ticks");
+    TEST_Check((E_OK == SWTIMER_IsRunning(0, &loc_running)) && (TRUE == loc_running), "periodic timer still armed");
+    TEST_Check((E_OK == SWTIMER_IsRunning(2, &loc_running)) && (FALSE == loc_running), "one-shot disarmed");
+}
+
+static void TEST_StopFromCallback(void)
+{
+    boolean loc_running = TRUE;
+
+    TEST_Setup();
+
+    // Timer 1 shares the slot of timer 0 and comes after it once both are handed down to level 0, the hand down
+    // reverses the order of the slot. Timer 2 expires on a later level.
+    TEST_Check(E_OK == SWTIMER_Start(0, 20, SWTIMER_MODE_ONE_SHOT, TEST_StopOthers), "start timer 0");
+    TEST_Check(E_OK == SWTIMER_Start(1, 20, SWTIMER_MODE_ONE_SHOT, TEST_Callback1), "start timer 1");
+    TEST_Check(E_OK == SWTIMER_Start(2, 300, SWTIMER_MODE_PERIODIC, TEST_Callback2), "start timer 2");
+    TEST_Check(E_OK == SWTIMER_Start(3, 16, SWTIMER_MODE_PERIODIC, TEST_StopItself), "start timer 3");
+
+    TEST_Advance(1000);
+
+    TEST_Check(TEST_FiredOnceAt(0, 20), "timer 0 expired");
+    TEST_Check(0 == TEST_Timers[1].Count, "timer 1 stopped in the slot being expired");
+    TEST_Check(0 == TEST_Timers[2].Count, "timer 2 stopped before it was handed down");
+    TEST_Check((3 == TEST_Timers[3].Count) && (48 == TEST_Timers[3].Ticks[2]), "timer 3 stopped by its own callback");
+    TEST_Check((E_OK == SWTIMER_IsRunning(3, &loc_running)) && (FALSE == loc_running), "timer 3 disarmed");
+}
+
+static void TEST_StartFromCallback(void)
+{
+    TEST_Setup();
+
+    TEST_Check(E_OK == SWTIMER_Start(4, 16, SWTIMER_MODE_ONE_SHOT, TEST_RestartItself), "start timer 4");
+
+    TEST_Advance(1000);
+
+    TEST_Check(3 == TEST_Timers[4].Count, "timer 4 expired 3 times");
+    TEST_Check((16 == TEST_Timers[4].Ticks[0]) && (116 == TEST_Timers[4].Ticks[1]) &&
+               (316 == TEST_Timers[4].Ticks[2]), "restarted from its expiry tick");
+}
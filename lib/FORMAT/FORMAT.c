@@ -0,0 +1,326 @@
+/**
+ * @file FORMAT.c
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#include "FORMAT.h"
+
+/* Longest decimal body, 10 integer digits, the decimal point and the decimals */
+#define FORMAT_MAX_BODY                     (10 + 1 + FORMAT_MAX_DECIMALS)
+
+static const uint32 FORMAT_Powers32[6] = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL};
+static const uint16 FORMAT_Powers16[4] = {10000U, 1000U, 100U, 10U};
+static const uint8 FORMAT_HexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                           '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+static uint8 FORMAT_Digits8(uint8 loc_value, uint8 * const loc_digits);
+static uint8 FORMAT_Digits16(uint16 loc_value, uint8 * const loc_digits);
+static uint8 FORMAT_Digits32(uint32 loc_value, uint8 * const loc_digits);
+static Std_ReturnType FORMAT_Emit(const uint8 * const loc_body, const uint8 loc_length, const boolean loc_negative,
+                                  const uint8 loc_width, const uint8 loc_pad, uint8 * const loc_buffer,
+                                  uint8 * const loc_length_ret);
+
+Std_ReturnType FORMAT_Uint8(const uint8 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                            uint8 * const Length_ret)
+{
+    uint8 loc_digits[3];
+    uint8 loc_length = FORMAT_Digits8(Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Uint16(const uint16 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret)
+{
+    uint8 loc_digits[5];
+    uint8 loc_length = FORMAT_Digits16(Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Uint32(const uint32 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret)
+{
+    uint8 loc_digits[10];
+    uint8 loc_length = FORMAT_Digits32(Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Sint8(const sint8 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                            uint8 * const Length_ret)
+{
+    uint8 loc_digits[3];
+    uint8 loc_length = FORMAT_Digits8((Value < 0) ? (uint8)(0U - (uint8)Value) : (uint8)Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, (Value < 0) ? TRUE : FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Sint16(const sint16 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret)
+{
+    uint8 loc_digits[5];
+    uint8 loc_length = FORMAT_Digits16((Value < 0) ? (uint16)(0U - (uint16)Value) : (uint16)Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, (Value < 0) ? TRUE : FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Sint32(const sint32 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret)
+{
+    uint8 loc_digits[10];
+    uint8 loc_length = FORMAT_Digits32((Value < 0) ? (uint32)(0UL - (uint32)Value) : (uint32)Value, loc_digits);
+
+    return FORMAT_Emit(loc_digits, loc_length, (Value < 0) ? TRUE : FALSE, Width, Pad, Buffer, Length_ret);
+}
+
+Std_ReturnType FORMAT_Hex(const uint32 Value, const uint8 Digits, uint8 * const Buffer, uint8 * const Length_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != Buffer) && (0 != Digits) && (Digits <= 8))
+    {
+        for (loc_index = 0; loc_index < Digits; loc_index++)
+        {
+            Buffer[loc_index] = FORMAT_HexDigits[(Value >> ((Digits - 1 - loc_index) << 2)) & 0x0F];
+        }
+
+        Buffer[Digits] = '\0';
+
+        if (NULL_PTR != Length_ret)
+        {
+            *Length_ret = Digits;
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+Std_ReturnType FORMAT_Fixed(const sint32 Value, const uint8 FractionBits, const uint8 Decimals, const uint8 Width,
+                            const uint8 Pad, uint8 * const Buffer, uint8 * const Length_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_body[FORMAT_MAX_BODY];
+    uint8 loc_decimals[FORMAT_MAX_DECIMALS];
+    uint32 loc_magnitude = (Value < 0) ? (uint32)(0UL - (uint32)Value) : (uint32)Value;
+    uint32 loc_mask = 0;
+    uint32 loc_fraction = 0;
+    uint32 loc_integer = 0;
+    uint8 loc_length = 0;
+    uint8 loc_index = 0;
+    boolean loc_carry = FALSE;
+    boolean loc_zero = TRUE;
+
+    if ((FractionBits <= FORMAT_MAX_FRACTION_BITS) && (Decimals <= FORMAT_MAX_DECIMALS))
+    {
+        loc_mask = (1UL << FractionBits) - 1UL;
+        loc_integer = loc_magnitude >> FractionBits;
+        loc_fraction = loc_magnitude & loc_mask;
+
+        // Each decimal is the integer part of the remaining fraction times ten, the product fits up to 28 bits.
+        for (loc_index = 0; loc_index < Decimals; loc_index++)
+        {
+            loc_fraction = (loc_fraction << 3) + (loc_fraction << 1);
+            loc_decimals[loc_index] = '0' + (uint8)(loc_fraction >> FractionBits);
+            loc_fraction &= loc_mask;
+        }
+
+        // Rounded half up on the magnitude, the carry ripples through the decimals into the integer part.
+        loc_carry = ((0 != FractionBits) && ((loc_fraction << 1) > loc_mask)) ? TRUE : FALSE;
+
+        for (loc_index = Decimals; (loc_index > 0) && (TRUE == loc_carry); loc_index--)
+        {
+            if ('9' == loc_decimals[loc_index - 1])
+            {
+                loc_decimals[loc_index - 1] = '0';
+            }
+            else
+            {
+                loc_decimals[loc_index - 1]++;
+                loc_carry = FALSE;
+            }
+        }
+
+        if (TRUE == loc_carry)
+        {
+            loc_integer++;
+        }
+
+        loc_length = FORMAT_Digits32(loc_integer, loc_body);
+        loc_zero = (0 == loc_integer) ? TRUE : FALSE;
+
+        if (0 != Decimals)
+        {
+            loc_body[loc_length++] = '.';
+
+            for (loc_index = 0; loc_index < Decimals; loc_index++)
+            {
+                loc_zero = ('0' != loc_decimals[loc_index]) ? FALSE : loc_zero;
+                loc_body[loc_length++] = loc_decimals[loc_index];
+            }
+        }
+
+        // A negative number rounded to zero is printed without its sign.
+        loc_ret = FORMAT_Emit(loc_body, loc_length, ((Value < 0) && (FALSE == loc_zero)) ? TRUE : FALSE, Width, Pad,
+                              Buffer, Length_ret);
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
+
+static uint8 FORMAT_Digits8(uint8 loc_value, uint8 * const loc_digits)
+{
+    uint8 loc_length = 0;
+    uint8 loc_digit = '0';
+
+    while (loc_value >= 100)
+    {
+        loc_value -= 100;
+        loc_digit++;
+    }
+
+    if ('0' != loc_digit)
+    {
+        loc_digits[loc_length++] = loc_digit;
+    }
+
+    for (loc_digit = '0'; loc_value >= 10; loc_digit++)
+    {
+        loc_value -= 10;
+    }
+
+    if ((0 != loc_length) || ('0' != loc_digit))
+    {
+        loc_digits[loc_length++] = loc_digit;
+    }
+
+    loc_digits[loc_length++] = '0' + loc_value;
+
+    return loc_length;
+}
+
+static uint8 FORMAT_Digits16(uint16 loc_value, uint8 * const loc_digits)
+{
+    uint8 loc_length = 0;
+    uint8 loc_index = 0;
+    uint8 loc_digit = 0;
+
+    for (loc_index = 0; loc_index < 4; loc_index++)
+    {
+        for (loc_digit = '0'; loc_value >= FORMAT_Powers16[loc_index]; loc_digit++)
+        {
+            loc_value -= FORMAT_Powers16[loc_index];
+        }
+
+        if ((0 != loc_length) || ('0' != loc_digit))
+        {
+            loc_digits[loc_length++] = loc_digit;
+        }
+    }
+
+    loc_digits[loc_length++] = '0' + (uint8)loc_value;
+
+    return loc_length;
+}
+
+static uint8 FORMAT_Digits32(uint32 loc_value, uint8 * const loc_digits)
+{
+    uint8 loc_length = 0;
+    uint8 loc_index = 0;
+    uint8 loc_digit = 0;
+
+    // The powers above the value are skipped, values below 10000 are left to the 16-bit conversion.
+    while ((loc_index < 6) && (loc_value < FORMAT_Powers32[loc_index]))
+    {
+        loc_index++;
+    }
+
+    for (; loc_index < 6; loc_index++)
+    {
+        for (loc_digit = '0'; loc_value >= FORMAT_Powers32[loc_index]; loc_digit++)
+        {
+            loc_value -= FORMAT_Powers32[loc_index];
+        }
+
+        loc_digits[loc_length++] = loc_digit;
+    }
+
+    if (0 != loc_length)
+    {
+        // Below 10000, the last three digits with their leading zeros in 16-bit arithmetic.
+        for (loc_index = 1; loc_index < 4; loc_index++)
+        {
+            for (loc_digit = '0'; (uint16)loc_value >= FORMAT_Powers16[loc_index]; loc_digit++)
+            {
+                loc_value -= FORMAT_Powers16[loc_index];
+            }
+
+            loc_digits[loc_length++] = loc_digit;
+        }
+
+        loc_digits[loc_length++] = '0' + (uint8)loc_value;
+    }
+    else
+    {
+        loc_length = FORMAT_Digits16((uint16)loc_value, loc_digits);
+    }
+
+    return loc_length;
+}
+
+static Std_ReturnType FORMAT_Emit(const uint8 * const loc_body, const uint8 loc_length, const boolean loc_negative,
+                                  const uint8 loc_width, const uint8 loc_pad, uint8 * const loc_buffer,
+                                  uint8 * const loc_length_ret)
+{
+    Std_ReturnType loc_ret = E_OK;
+    uint8 loc_size = loc_length + ((TRUE == loc_negative) ? 1 : 0);
+    uint8 loc_position = 0;
+    uint8 loc_index = 0;
+
+    if ((NULL_PTR != loc_buffer) && (loc_width <= FORMAT_MAX_WIDTH))
+    {
+        if ((TRUE == loc_negative) && ('0' == loc_pad))
+        {
+            loc_buffer[loc_position++] = '-';
+        }
+
+        for (; loc_size < loc_width; loc_size++)
+        {
+            loc_buffer[loc_position++] = loc_pad;
+        }
+
+        if ((TRUE == loc_negative) && ('0' != loc_pad))
+        {
+            loc_buffer[loc_position++] = '-';
+        }
+
+        for (loc_index = 0; loc_index < loc_length; loc_index++)
+        {
+            loc_buffer[loc_position++] = loc_body[loc_index];
+        }
+
+        loc_buffer[loc_position] = '\0';
+
+        if (NULL_PTR != loc_length_ret)
+        {
+            *loc_length_ret = loc_position;
+        }
+    }
+    else
+    {
+        loc_ret = E_NOT_OK;
+    }
+
+    return loc_ret;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file FORMAT.h
+ * @author Ahmed Alaa (4hmedalaa@gmail.com)
+ *
+ * @brief Number Formatting Interface
+ *
+ * The formatting interface converts integers and Q-format fixed-point numbers to NUL-terminated strings for the LCD,
+ * the EUSART or any other text output. The decimal digits are found by subtracting powers of ten, so no division
+ * is performed and the 8-bit and 16-bit conversions stay in 8-bit and 16-bit arithmetic.
+ *
+ * @note Include this header file in your application code to access the formatting interface.
+ * @note Every output buffer must hold at least FORMAT_BUFFER_SIZE bytes.
+ *
+ * @version 0.1
+ * @date 18.10.26
+ */
+
+#ifndef _FORMAT_H_
+#define _FORMAT_H_
+
+#include "../Std_Types.h"
+
+/**
+ * @brief Size of the output buffers, the widest field and its NUL terminator.
+ */
+#define FORMAT_BUFFER_SIZE                                      24
+
+/**
+ * @brief Widest field, in characters, accepted as a minimum width.
+ */
+#define FORMAT_MAX_WIDTH                                        (FORMAT_BUFFER_SIZE - 1)
+
+/**
+ * @brief Largest number of fraction bits of a fixed-point number.
+ */
+#define FORMAT_MAX_FRACTION_BITS                                27
+
+/**
+ * @brief Largest number of decimals printed for a fixed-point number.
+ */
+#define FORMAT_MAX_DECIMALS                                     9
+
+/**
+ * @brief Formats an unsigned integer in decimal.
+ *
+ * @param Value The value to be formatted.
+ * @param Width Minimum number of characters, the number is right-aligned and padded on the left, 0 for none.
+ * @param Pad The padding character, usually ' ' or '0'.
+ * @param Buffer Pointer to the output buffer, at least FORMAT_BUFFER_SIZE bytes.
+ * @param Length_ret Pointer to a variable where the number of characters written is stored, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The value was formatted successfully.
+ *     - E_NOT_OK: NULL @param Buffer or @param Width above FORMAT_MAX_WIDTH.
+ */
+Std_ReturnType FORMAT_Uint8(const uint8 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                            uint8 * const Length_ret);
+Std_ReturnType FORMAT_Uint16(const uint16 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret);
+Std_ReturnType FORMAT_Uint32(const uint32 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret);
+
+/**
+ * @brief Formats a signed integer in decimal.
+ *
+ * Negative numbers start with '-', placed before the zeros when @param Pad is '0' and after the spaces otherwise.
+ *
+ * @param Value The value to be formatted.
+ * @param Width Minimum number of characters, including the sign, 0 for none.
+ * @param Pad The padding character, usually ' ' or '0'.
+ * @param Buffer Pointer to the output buffer, at least FORMAT_BUFFER_SIZE bytes.
+ * @param Length_ret Pointer to a variable where the number of characters written is stored, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The value was formatted successfully.
+ *     - E_NOT_OK: NULL @param Buffer or @param Width above FORMAT_MAX_WIDTH.
+ */
+Std_ReturnType FORMAT_Sint8(const sint8 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                            uint8 * const Length_ret);
+Std_ReturnType FORMAT_Sint16(const sint16 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret);
+Std_ReturnType FORMAT_Sint32(const sint32 Value, const uint8 Width, const uint8 Pad, uint8 * const Buffer,
+                             uint8 * const Length_ret);
+
+/**
+ * @brief Formats an unsigned integer in upper case hexadecimal, without prefix.
+ *
+ * @param Value The value to be formatted, only its @param Digits lowest nibbles are printed.
+ * @param Digits Number of hexadecimal digits, from 1 to 8.
+ * @param Buffer Pointer to the output buffer, at least FORMAT_BUFFER_SIZE bytes.
+ * @param Length_ret Pointer to a variable where the number of characters written is stored, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The value was formatted successfully.
+ *     - E_NOT_OK: NULL @param Buffer or @param Digits out of range.
+ */
+Std_ReturnType FORMAT_Hex(const uint32 Value, const uint8 Digits, uint8 * const Buffer, uint8 * const Length_ret);
+
+/**
+ * @brief Formats a signed Q-format fixed-point number in decimal, rounded to the nearest last decimal.
+ *
+ * The number is @param Value / 2^@param FractionBits, e.g. a Q15 duty cycle is printed with @param FractionBits 15.
+ *
+ * @param Value The fixed-point value to be formatted.
+ * @param FractionBits Number of fraction bits of @param Value, from 0 to FORMAT_MAX_FRACTION_BITS.
+ * @param Decimals Number of decimals printed, from 0 (no decimal point) to FORMAT_MAX_DECIMALS.
+ * @param Width Minimum number of characters, including the sign and the decimal point, 0 for none.
+ * @param Pad The padding character, usually ' ' or '0'.
+ * @param Buffer Pointer to the output buffer, at least FORMAT_BUFFER_SIZE bytes.
+ * @param Length_ret Pointer to a variable where the number of characters written is stored, or NULL_PTR.
+ * @return Std_ReturnType Error status indicating the success of the operation.
+ *     - E_OK: The value was formatted successfully.
+ *     - E_NOT_OK: NULL @param Buffer or a parameter out of range.
+ */
+Std_ReturnType FORMAT_Fixed(const sint32 Value, const uint8 FractionBits, const uint8 Decimals, const uint8 Width,
+                            const uint8 Pad, uint8 * const Buffer, uint8 * const Length_ret);
+
+#endif /* _FORMAT_H_ */
@@ -68,10 +68,18 @@ typedef unsigned short          uint16_least;
 typedef signed short            sint16;
 typedef signed short            sint16_least;
 
+#if defined(__LP64__)
+/* 64-bit hosts (the SIM build) have a 64-bit long, the 32-bit types must keep wrapping as on the target */
+typedef unsigned int            uint32;
+typedef unsigned int            uint32_least;
+typedef signed int              sint32;
+typedef signed int              sint32_least;
+#else
 typedef unsigned long           uint32;
 typedef unsigned long           uint32_least;
 typedef signed long             sint32;
 typedef signed long             sint32_least;
+#endif
 
 typedef unsigned long long      uint64;
 typedef signed long long        sint64;
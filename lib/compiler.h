@@ -12,6 +12,10 @@
 #ifndef _COMPILER_H_
 #define _COMPILER_H_
 
+#if defined(__XC8)
 #include <xc.h>
+#else
+#include "../SIM/SIM_Compiler.h"
+#endif
 
 #endif /* _COMPILER_H_ */
\ No newline at end of file